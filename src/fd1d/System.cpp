@@ -10,7 +10,7 @@
 #include <fd1d/iterator/Iterator.h>
 #include <fd1d/sweep/Sweep.h>
 #include <fd1d/sweep/SweepFactory.h>
-#include <fd1d/iterator/NrIterator.h>
+#include <fd1d/iterator/IteratorFactory.h>
 #include <fd1d/misc/HomogeneousComparison.h>
 #include <fd1d/misc/FieldIo.h>
 
@@ -41,6 +41,7 @@ namespace Fd1d
       homogeneous_(),
       interactionPtr_(0),
       iteratorPtr_(0),
+      iteratorFactoryPtr_(0),
       sweepPtr_(0),
       sweepFactoryPtr_(0),
       wFields_(),
@@ -57,7 +58,7 @@ namespace Fd1d
       setClassName("System"); 
 
       interactionPtr_ = new ChiInteraction(); 
-      iteratorPtr_ = new NrIterator(*this); 
+      iteratorFactoryPtr_ = new IteratorFactory(*this); 
       sweepFactoryPtr_ = new SweepFactory(*this);
    }
 
@@ -65,7 +66,12 @@ namespace Fd1d
    * Destructor.
    */
    System::~System()
-   {}
+   {
+      if (iteratorPtr_) {
+         delete iteratorPtr_;
+      }
+      delete iteratorFactoryPtr_;
+   }
 
    /*
    * Process command line options.
@@ -163,14 +169,18 @@ namespace Fd1d
       hasDomain_ = true;
       allocateFields();
 
-      // Initialize iterator
-      readParamComposite(in, iterator());
+      // Instantiate and initialize an Iterator
+      std::string className;
+      bool isEnd;
+      iteratorPtr_ = 
+         iteratorFactoryPtr_->readObject(in, *this, className, isEnd);
+      if (!iteratorPtr_) {
+         UTIL_THROW("Unrecognized Iterator subclass name");
+      }
 
       // Optionally instantiate a Sweep object
       readOptional<bool>(in, "hasSweep", hasSweep_);
       if (hasSweep_) {
-         std::string className;
-         bool isEnd;
          sweepPtr_ = 
             sweepFactoryPtr_->readObject(in, *this, className, isEnd);
          if (!sweepPtr_) {
@@ -24,6 +24,7 @@ namespace Fd1d
 {
 
    class Iterator;
+   class IteratorFactory;
    class Sweep;
    class SweepFactory;
    using namespace Util;
@@ -232,6 +233,11 @@ namespace Fd1d
       */
       Iterator* iteratorPtr_;
 
+      /**
+      * Pointer to associated iterator factory.
+      */
+      IteratorFactory* iteratorFactoryPtr_;
+
       /**
       * Pointer to associated Sweep object
       */
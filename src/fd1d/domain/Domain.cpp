@@ -202,17 +202,16 @@ namespace Fd1d
       UTIL_CHECK(nx_ > 1);
       UTIL_CHECK(nx_ == f.capacity());
       UTIL_CHECK(nx_ == g.capacity());
-      if (!work_.isAllocated()) {
-         work_.allocate(nx_);
-      } else {
-         UTIL_ASSERT(nx_ == work_.capacity());
-      } 
+
+      // Use local work space, so that threads may share a Domain
+      DArray<double> work;
+      work.allocate(nx_);
 
       // Compute average of f(x)*g(x)
       for (int i = 0; i < nx_; ++i) {
-         work_[i] = f[i]*g[i];
+         work[i] = f[i]*g[i];
       }
-      return spatialAverage(work_);
+      return spatialAverage(work);
    }
 
 }
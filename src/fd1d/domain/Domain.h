@@ -133,6 +133,9 @@ namespace Fd1d
       /**
       * Compute inner product of two real fields.
       *
+      * This function is thread safe, and may be called concurrently
+      * by threads that share one Domain.
+      *
       * \param f first field
       * \param g second field
       * \return spatial average of product of two fields.
@@ -178,11 +181,6 @@ namespace Fd1d
       */
       bool isShell_;
 
-      /**
-      * Work space vector.
-      */
-      mutable DArray<double> work_;
-
       /**
       * Compute generalized volume, called by each set function.
       */
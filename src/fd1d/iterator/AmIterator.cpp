@@ -0,0 +1,228 @@
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "AmIterator.h"
+#include <fd1d/System.h>
+#include <pscf/inter/Interaction.h>
+
+#include <math.h>
+
+namespace Pscf {
+namespace Fd1d
+{
+
+   using namespace Util;
+
+   AmIterator::AmIterator()
+    : Iterator(),
+      epsilon_(0.0),
+      maxItr_(200),
+      maxHist_(20),
+      nIteration_(0),
+      isAllocated_(false)
+   {  setClassName("AmIterator"); }
+
+   AmIterator::AmIterator(System& system)
+    : Iterator(system),
+      epsilon_(0.0),
+      maxItr_(200),
+      maxHist_(20),
+      nIteration_(0),
+      isAllocated_(false)
+   {  setClassName("AmIterator"); }
+
+   AmIterator::~AmIterator()
+   {}
+
+   void AmIterator::readParameters(std::istream& in)
+   {
+      read(in, "epsilon", epsilon_);
+      maxItr_ = 200;
+      readOptional(in, "maxItr", maxItr_);
+      maxHist_ = 20;
+      readOptional(in, "maxHist", maxHist_);
+      UTIL_CHECK(maxItr_ > 0);
+      UTIL_CHECK(maxHist_ >= 0);
+      if (domain().nx() > 0) {
+         allocate();
+      }
+   }
+
+   void AmIterator::allocate()
+   {
+      int nm = mixture().nMonomer();   // number of monomer types
+      int nx = domain().nx();          // number of grid points
+      UTIL_CHECK(nm > 0);
+      UTIL_CHECK(nx > 0);
+      if (isAllocated_) {
+         UTIL_CHECK(dev_.capacity() == nm);
+         UTIL_CHECK(dev_[0].capacity() == nx);
+      } else {
+         wHists_.allocate(maxHist_ + 1);
+         devHists_.allocate(maxHist_ + 1);
+         histMat_.allocate(maxHist_ + 1);
+         if (maxHist_ > 0) {
+            coeffs_.allocate(maxHist_);
+         }
+         dev_.allocate(nm);
+         for (int i = 0; i < nm; ++i) {
+            dev_[i].allocate(nx);
+         }
+         cArray_.allocate(nm);
+         wArray_.allocate(nm);
+         wPredicted_.allocate(nm);
+         isAllocated_ = true;
+      }
+   }
+
+   int AmIterator::solve(bool isContinuation)
+   {
+      // Allocate memory if needed or, if allocated, check array sizes.
+      allocate();
+
+      // Determine ensemble, and shift w fields if canonical
+      setupEnsemble();
+
+      // Discard histories from any previous solution
+      wHists_.clear();
+      devHists_.clear();
+      histMat_.clear();
+
+      // Compute initial state
+      mixture().compute(system().wFields(), system().cFields());
+
+      // Iterative loop
+      double error, lambda;
+      int i, k, nHist;
+      for (i = 0; i < maxItr_; ++i) {
+
+         // Add current w fields and deviation to histories
+         error = computeDeviation();
+         wHists_.append(system().wFields());
+         devHists_.append(dev_);
+
+         std::cout << "iteration " << i
+                   << " , error = " << error
+                   << std::endl;
+
+         if (error < epsilon_) {
+            std::cout << "Converged" << std::endl;
+            system().computeFreeEnergy();
+            nIteration_ = i;
+            // Success
+            return 0;
+         }
+
+         // Add inner products of the newest deviation with all others.
+         // All other inner products are retained from previous steps.
+         histMat_.advance();
+         for (k = 0; k < histMat_.size(); ++k) {
+            histMat_.set(k, computeInnerProduct(0, k));
+         }
+         nHist = histMat_.size() - 1;
+         if (nHist > 0) {
+            histMat_.computeCoefficients(coeffs_);
+         }
+
+         // Mix histories to obtain new w fields
+         if (i < maxHist_) {
+            lambda = 1.0 - pow(0.9, i + 1);
+         } else {
+            lambda = 1.0;
+         }
+         buildOmega(lambda, nHist);
+
+         // If canonical, shift so that the last element is zero. The
+         // deviation is invariant under this shift.
+         if (isCanonical_) {
+            setupEnsemble();
+         }
+
+         // Solve MDE for new w fields
+         mixture().compute(system().wFields(), system().cFields());
+      }
+
+      // Failure 
+      nIteration_ = maxItr_;
+      return 1;
+   }
+
+   /*
+   * Compute the deviation of current fields from self-consistency.
+   */
+   double AmIterator::computeDeviation()
+   {
+      int nm = mixture().nMonomer();  // number of monomer types
+      int nx = domain().nx();         // number of grid points
+      Interaction const & interaction = system().interaction();
+      double xi, value;
+      double error = 0.0;
+      int i, j;
+      for (j = 0; j < nx; ++j) {
+         for (i = 0; i < nm; ++i) {
+            cArray_[i] = system().cField(i)[j];
+            wArray_[i] = system().wField(i)[j];
+         }
+         interaction.computeW(cArray_, wPredicted_);
+         interaction.computeXi(wArray_, xi);
+         for (i = 0; i < nm; ++i) {
+            value = wPredicted_[i] + xi - wArray_[i];
+            dev_[i][j] = value;
+            if (fabs(value) > error) {
+               error = fabs(value);
+            }
+         }
+      }
+      return error;
+   }
+
+   /*
+   * Compute inner product of deviation histories i and j.
+   */
+   double AmIterator::computeInnerProduct(int i, int j)
+   {
+      int nm = mixture().nMonomer();  // number of monomer types
+      int nx = domain().nx();         // number of grid points
+      double product = 0.0;
+      int k, l;
+      for (k = 0; k < nm; ++k) {
+         WField const & di = devHists_[i][k];
+         WField const & dj = devHists_[j][k];
+         for (l = 0; l < nx; ++l) {
+            product += di[l]*dj[l];
+         }
+      }
+      return product;
+   }
+
+   /*
+   * Set new w fields by mixing the histories of fields and deviations.
+   */
+   void AmIterator::buildOmega(double lambda, int nHist)
+   {
+      int nm = mixture().nMonomer();  // number of monomer types
+      int nx = domain().nx();         // number of grid points
+      double w, d;
+      int i, j, m;
+      for (i = 0; i < nm; ++i) {
+         WField const & w0 = wHists_[0][i];
+         WField const & d0 = devHists_[0][i];
+         WField& wNew = system().wField(i);
+         for (j = 0; j < nx; ++j) {
+            w = w0[j];
+            d = d0[j];
+            for (m = 0; m < nHist; ++m) {
+               w += coeffs_[m]*(wHists_[m+1][i][j] - w0[j]);
+               d += coeffs_[m]*(devHists_[m+1][i][j] - d0[j]);
+            }
+            wNew[j] = w + lambda*d;
+         }
+      }
+   }
+
+} // namespace Fd1d
+} // namespace Pscf
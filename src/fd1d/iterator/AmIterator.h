@@ -0,0 +1,190 @@
+#ifndef FD1D_AM_ITERATOR_H
+#define FD1D_AM_ITERATOR_H
+
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "Iterator.h"
+#include <fd1d/solvers/Mixture.h>
+#include <pscf/math/GramMatrix.h>
+#include <util/containers/Array.h>
+#include <util/containers/DArray.h>
+#include <util/containers/RingBuffer.h>
+
+namespace Pscf {
+namespace Fd1d
+{
+
+   using namespace Util;
+
+   /**
+   * Anderson mixing iterator for SCF equations.
+   *
+   * Each iteration requires only one solution of the modified diffusion
+   * equation, and memory usage is proportional to maxHist*nMonomer*nx.
+   * This iterator is thus suitable for fine grids, for which the cost
+   * of constructing and factorizing the Jacobian used by NrIterator is 
+   * prohibitive, though it usually requires more iterations.
+   *
+   * The deviation for monomer type i at each grid point is given by
+   * w_i(pred) + xi - w_i, in which w_i(pred) is computed from the c 
+   * fields by Interaction::computeW and xi is the Lagrange multiplier 
+   * computed from the w fields by Interaction::computeXi. This vanishes
+   * if and only if the w fields are self-consistent and the c fields 
+   * are incompressible. Inner products of the deviation history and the
+   * least squares problem for the mixing coefficients are handled by a 
+   * GramMatrix, which is shared with Pspc::AmIterator.
+   *
+   * \ingroup Fd1d_Iterator_Module
+   */
+   class AmIterator : public Iterator
+   {
+
+   public:
+
+      /**
+      * Default constructor.
+      */
+      AmIterator();
+
+      /**
+      * Constructor.
+      *
+      * \param system parent System object.
+      */
+      AmIterator(System& system);
+
+      /**
+      * Destructor.
+      */
+      virtual ~AmIterator();
+
+      /**
+      * Read all parameters and initialize.
+      *
+      * \param in input parameter stream
+      */
+      void readParameters(std::istream& in);
+
+      /**
+      * Iterate self-consistent field equations to solution.
+      * 
+      * \param isContinuation True if part of sweep, and not first step.
+      * \return error code: 0 for success, 1 for failure.
+      */
+      int solve(bool isContinuation = false);
+
+      /**
+      * Get error tolerance.
+      */
+      double epsilon() const;
+
+      /**
+      * Get the maximum number of previous states used for mixing.
+      */
+      int maxHist() const;
+
+      /**
+      * Get the maximum number of iterations.
+      */
+      int maxItr() const;
+
+      /**
+      * Get the number of iterations in the last solve().
+      *
+      * Equal to maxItr() if the last call to solve() failed.
+      */
+      int nIteration() const;
+
+   private:
+
+      /// History of w fields, most recent first.
+      RingBuffer< DArray<WField> > wHists_;
+
+      /// History of deviations, most recent first.
+      RingBuffer< DArray<WField> > devHists_;
+
+      /// Inner products of deviation histories, updated incrementally.
+      GramMatrix histMat_;
+
+      /// Mixing coefficients.
+      DArray<double> coeffs_;
+
+      /// Deviation of current fields (work space).
+      DArray<WField> dev_;
+
+      /// Concentrations at one grid point (work space).
+      DArray<double> cArray_;
+
+      /// Chemical potentials at one grid point (work space).
+      DArray<double> wArray_;
+
+      /// Predicted chemical potentials at one grid point (work space).
+      DArray<double> wPredicted_;
+
+      /// Error tolerance.
+      double epsilon_;
+
+      /// Maximum number of iterations.
+      int maxItr_;
+
+      /// Maximum number of previous states used for mixing.
+      int maxHist_;
+
+      /// Number of iterations in the last solve().
+      int nIteration_;
+
+      /// Have arrays been allocated?
+      bool isAllocated_;
+
+      /**
+      * Allocate memory if needed. If isAllocated, check array sizes.
+      */
+      void allocate();
+
+      /**
+      * Compute dev_ for the current w and c fields.
+      *
+      * \return maximum absolute value of an element of dev_
+      */
+      double computeDeviation();
+
+      /**
+      * Compute inner product of deviation histories i and j.
+      *
+      * \param i index of first history (0 = current)
+      * \param j index of second history (0 = current)
+      */
+      double computeInnerProduct(int i, int j);
+
+      /**
+      * Set new w fields by mixing the histories.
+      *
+      * \param lambda weight of the mixed deviation
+      * \param nHist number of previous states used
+      */
+      void buildOmega(double lambda, int nHist);
+
+   };
+
+   // Inline functions
+
+   inline double AmIterator::epsilon() const
+   {  return epsilon_; }
+
+   inline int AmIterator::maxHist() const
+   {  return maxHist_; }
+
+   inline int AmIterator::maxItr() const
+   {  return maxItr_; }
+
+   inline int AmIterator::nIteration() const
+   {  return nIteration_; }
+
+} // namespace Fd1d
+} // namespace Pscf
+#endif
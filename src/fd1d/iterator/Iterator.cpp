@@ -9,6 +9,9 @@
 #include <fd1d/System.h>
 #include <fd1d/domain/Domain.h>
 #include <fd1d/solvers/Mixture.h>
+#include <pscf/inter/Interaction.h>
+
+#include <math.h>
 
 namespace Pscf {
 namespace Fd1d
@@ -17,14 +20,156 @@ namespace Fd1d
    using namespace Util;
 
    Iterator::Iterator()
+    : isCanonical_(true)
    {  setClassName("Iterator"); }
 
    Iterator::Iterator(System& system)
-    : SystemAccess(system)
+    : SystemAccess(system),
+      isCanonical_(true)
    {  setClassName("Iterator"); }
 
    Iterator::~Iterator()
    {}
 
+   void Iterator::computeResidual(Array<WField> const & wFields, 
+                                  Array<CField> const & cFields, 
+                                  Array<double>& residual)
+   {
+      int nm = mixture().nMonomer();  // number of monomer types
+      int nx = domain().nx();         // number of grid points
+      int i;                          // grid point index
+      int j;                          // monomer indices
+      int ir;                         // residual index
+
+      // Work space for values at one grid point. These are local, so 
+      // that this function may be called concurrently by threads.
+      DArray<double> cArray;
+      DArray<double> wArray;
+      cArray.allocate(nm);
+      wArray.allocate(nm);
+
+      // Loop over grid points
+      for (i = 0; i < nx; ++i) {
+
+         // Copy volume fractions at grid point i to cArray
+         for (j = 0; j < nm; ++j) {
+            cArray[j] = cFields[j][i];
+         }
+
+         // Compute w fields, without Langrange multiplier, from c fields
+         system().interaction().computeW(cArray, wArray);
+
+         // Initial residual = wPredicted(from above) - actual w
+         for (j = 0; j < nm; ++j) {
+            ir = j*nx + i;
+            residual[ir] = wArray[j] - wFields[j][i];
+         }
+
+         // Residuals j = 1, ..., nm-1 are differences from component j=0
+         for (j = 1; j < nm; ++j) {
+            ir = j*nx + i;
+            residual[ir] = residual[ir] - residual[i];
+         }
+
+         // Residual for component j=0 then imposes incompressiblity
+         residual[i] = -1.0;
+         for (j = 0; j < nm; ++j) {
+            residual[i] += cArray[j];
+         }
+      }
+
+      /*
+      * Note: In canonical ensemble, the spatial integral of the incompressiblity
+      * residual is guaranteed to be zero, as a result of how volume fractions are
+      * computed in SCFT. One of the nx incompressibility constraints is thus 
+      * redundant. To avoid this redundancy, replace the incompressibility residual
+      * at the last grid point by a residual that requires the w field for the last 
+      * monomer type at the last grid point to equal zero. 
+      */
+
+      if (isCanonical_) {
+         residual[nx-1] = wFields[nm-1][nx-1];
+      }
+
+   }
+
+   double Iterator::residualNorm(Array<double> const & residual) const
+   {
+      int nm = mixture().nMonomer();  // number of monomer types
+      int nx = domain().nx();         // number of grid points
+      int nr = nm*nx;                 // number of residual components
+      double value, norm;
+      norm = 0.0;
+      for (int ir = 0; ir <  nr; ++ir) {
+         value = fabs(residual[ir]);
+         if (value > norm) {
+            norm = value;
+         }
+      }
+      return norm;
+   }
+
+   void Iterator::setupEnsemble()
+   {
+      int nm = mixture().nMonomer();  // number of monomer types
+      int np = mixture().nPolymer();  // number of polymer species 
+      int nx = domain().nx();         // number of grid points
+
+      // Determine if isCanonical (iff all species ensembles are closed)
+      isCanonical_ = true;
+      Species::Ensemble ensemble;
+      for (int i = 0; i < np; ++i) {
+         ensemble = mixture().polymer(i).ensemble();
+         if (ensemble == Species::Unknown) {
+            UTIL_THROW("Unknown species ensemble");
+         }
+         if (ensemble == Species::Open) {
+            isCanonical_ = false;
+         }
+      }
+
+      // If isCanonical, shift so that last element is zero.
+      // Note: This is one of the residuals in this case.
+      if (isCanonical_) {
+         double shift = wFields()[nm-1][nx-1];
+         int i, j;
+         for (i = 0; i < nm; ++i) {
+            for (j = 0; j < nx; ++j) {
+               wFields()[i][j] -= shift;
+            }
+         }
+      }
+   }
+
+   void Iterator::incrementWFields(Array<WField> const & wOld, 
+                                   Array<double> const & dW, 
+                                   Array<WField> & wNew)
+   {
+      int nm = mixture().nMonomer(); // number of monomers types
+      int nx = domain().nx();        // number of grid points
+      int i;                         // monomer index
+      int j;                         // grid point index
+      int k = 0;                     // residual element index
+
+      // Add dW
+      for (i = 0; i < nm; ++i) {
+         for (j = 0; j < nx; ++j) {
+            wNew[i][j] = wOld[i][j] - dW[k];
+            ++k;
+         }
+      }
+
+      // If canonical, shift such that last element is exactly zero
+      if (isCanonical_) {
+         double shift = wNew[nm-1][nx-1];
+         for (i = 0; i < nm; ++i) {
+            for (j = 0; j < nx; ++j) {
+               wNew[i][j] -= shift;
+            }
+         }
+      }
+
+   }
+
 } // namespace Fd1d
 } // namespace Pscf
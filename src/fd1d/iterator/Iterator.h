@@ -10,6 +10,9 @@
 
 #include <util/param/ParamComposite.h>    // base class
 #include <fd1d/SystemAccess.h>            // base class
+#include <fd1d/solvers/Mixture.h>
+#include <util/containers/Array.h>
+#include <util/containers/DArray.h>
 #include <util/global.h>                  
 
 namespace Pscf {
@@ -21,6 +24,11 @@ namespace Fd1d
    /**
    * Base class for iterative solvers for SCF equations.
    *
+   * The base class defines the residual vector used by all iterators,
+   * and functions to compute it. The residual has nr = nMonomer*nx 
+   * elements, in which element j*nx + i is associated with monomer 
+   * type j and grid point i.
+   *
    * \ingroup Fd1d_Iterator_Module
    */
    class Iterator : public ParamComposite, public SystemAccess
@@ -28,6 +36,16 @@ namespace Fd1d
 
    public:
 
+      /**
+      * Monomer chemical potential field.
+      */
+      typedef Mixture::WField WField;
+
+      /**
+      * Monomer concentration / volume fraction field.
+      */
+      typedef Mixture::CField CField;
+
       /**
       * Default constructor.
       */
@@ -53,6 +71,61 @@ namespace Fd1d
       */
       virtual int solve(bool isContinuation = false) = 0;
 
+      /**
+      * Get the number of iterations required by the last solve().
+      *
+      * Used by Sweep to adjust the step size along a path.
+      */
+      virtual int nIteration() const = 0;
+
+      /**
+      * Compute the residual vector.
+      *
+      * This function does not modify the Iterator, and may be called
+      * concurrently by several threads with different arguments.
+      *
+      * \param wFields monomer chemical potential fields (input)
+      * \param cFields monomer concentration fields (input)
+      * \param residual vector of residuals (errors) (output)
+      */
+      void computeResidual(Array<WField> const & wFields, 
+                           Array<WField> const & cFields, 
+                           Array<double>& residual);
+
+      /**
+      * Compute and return norm of a residual vector.
+      *
+      * \param residual vector of residuals (errors) (input)
+      */
+      double residualNorm(Array<double> const & residual) const;
+
+      /**
+      * Increment the chemical potential fields.
+      *
+      * Sets wNew = wOld - dW and then, if the ensemble is canonical, 
+      * shifts wNew so that the last element of the last field is zero.
+      *
+      * \param wOld array of old chemical potential fields
+      * \param dW array of increments, indexed as in residual columns
+      * \param wNew array of new chemical potential fields
+      */
+      void incrementWFields(Array<WField> const & wOld,
+                            Array<double> const & dW,
+                            Array<WField>& wNew);
+
+   protected:
+
+      /// Is the ensemble canonical for all species ?
+      bool isCanonical_;
+
+      /**
+      * Determine the ensemble, and shift fields if canonical.
+      *
+      * Sets isCanonical_, and then, if it is true, shifts the system 
+      * w fields so that the last element of the last field is zero.
+      */
+      void setupEnsemble();
+
    };
 
 } // namespace Fd1d
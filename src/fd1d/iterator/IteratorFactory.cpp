@@ -0,0 +1,50 @@
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "IteratorFactory.h"  
+
+// Subclasses of Iterator 
+#include "NrIterator.h"
+#include "NkIterator.h"
+#include "AmIterator.h"
+
+namespace Pscf {
+namespace Fd1d {
+
+   using namespace Util;
+
+   IteratorFactory::IteratorFactory(System& system)
+    : systemPtr_(&system)
+   {}
+
+   /* 
+   * Return a pointer to a instance of Iterator subclass className.
+   */
+   Iterator* IteratorFactory::factory(const std::string &className) const
+   {
+      Iterator *ptr = 0;
+
+      // First if name is known by any subfactories
+      ptr = trySubfactories(className);
+      if (ptr) return ptr;     
+
+      // Explicit class names
+      if (className == "NrIterator") {
+         ptr = new NrIterator(*systemPtr_);
+      } else
+      if (className == "NkIterator") {
+         ptr = new NkIterator(*systemPtr_);
+      } else
+      if (className == "AmIterator") {
+         ptr = new AmIterator(*systemPtr_);
+      }
+
+      return ptr;
+   }
+
+}
+}
@@ -0,0 +1,54 @@
+#ifndef FD1D_ITERATOR_FACTORY_H
+#define FD1D_ITERATOR_FACTORY_H
+
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include <util/param/Factory.h>  
+#include "Iterator.h"
+
+#include <string>
+
+namespace Pscf {
+namespace Fd1d {
+
+   using namespace Util;
+
+   /**
+   * Default Factory for subclasses of Iterator.
+   *
+   * \ingroup Fd1d_Iterator_Module
+   */
+   class IteratorFactory : public Factory<Iterator> 
+   {
+
+   public:
+
+      /**
+      * Constructor.
+      *
+      * \param system parent System object
+      */
+      IteratorFactory(System& system);
+
+      /**
+      * Method to create any Iterator subclass.
+      *
+      * \param className name of the Iterator subclass
+      * \return Iterator* pointer to new instance of className
+      */
+      Iterator* factory(std::string const & className) const;
+
+   private:
+
+      System* systemPtr_;
+
+   };
+
+}
+}
+#endif
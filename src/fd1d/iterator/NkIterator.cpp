@@ -0,0 +1,406 @@
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "NkIterator.h"
+#include <fd1d/System.h>
+
+#include <math.h>
+
+namespace Pscf {
+namespace Fd1d
+{
+
+   using namespace Util;
+
+   NkIterator::NkIterator()
+    : Iterator(),
+      epsilon_(0.0),
+      krylovEpsilon_(0.01),
+      maxItr_(100),
+      maxKrylov_(50),
+      nIteration_(0),
+      nKrylov_(0),
+      isAllocated_(false)
+   {  setClassName("NkIterator"); }
+
+   NkIterator::NkIterator(System& system)
+    : Iterator(system),
+      epsilon_(0.0),
+      krylovEpsilon_(0.01),
+      maxItr_(100),
+      maxKrylov_(50),
+      nIteration_(0),
+      nKrylov_(0),
+      isAllocated_(false)
+   {  setClassName("NkIterator"); }
+
+   NkIterator::~NkIterator()
+   {}
+
+   void NkIterator::readParameters(std::istream& in)
+   {
+      read(in, "epsilon", epsilon_);
+      maxItr_ = 100;
+      readOptional(in, "maxItr", maxItr_);
+      maxKrylov_ = 50;
+      readOptional(in, "maxKrylov", maxKrylov_);
+      krylovEpsilon_ = 0.01;
+      readOptional(in, "krylovEpsilon", krylovEpsilon_);
+      UTIL_CHECK(maxKrylov_ > 0);
+      if (domain().nx() > 0) {
+         allocate();
+      }
+   }
+
+   void NkIterator::allocate()
+   {
+      int nm = mixture().nMonomer();   // number of monomer types
+      int nx = domain().nx();          // number of grid points
+      UTIL_CHECK(nm > 0);
+      UTIL_CHECK(nx > 0);
+      int nr = nm*nx;                  // number of residual components
+      if (isAllocated_) {
+         UTIL_CHECK(residual_.capacity() == nr);
+      } else {
+         residual_.allocate(nr);
+         residualNew_.allocate(nr);
+         dOmega_.allocate(nr);
+         wFieldsNew_.allocate(nm);
+         cFieldsNew_.allocate(nm);
+         for (int i = 0; i < nm; ++i) {
+            wFieldsNew_[i].allocate(nx);
+            cFieldsNew_[i].allocate(nx);
+         }
+         basis_.allocate(maxKrylov_ + 1);
+         for (int i = 0; i <= maxKrylov_; ++i) {
+            basis_[i].allocate(nr);
+         }
+         z_.allocate(nr);
+         v_.allocate(nr);
+         hessenberg_.allocate(maxKrylov_ + 1, maxKrylov_);
+         cs_.allocate(maxKrylov_);
+         sn_.allocate(maxKrylov_);
+         g_.allocate(maxKrylov_ + 1);
+         y_.allocate(maxKrylov_);
+         preconditioner_.allocate(nx*nm*nm);
+         block_.allocate(nm, nm);
+         blockInverse_.allocate(nm, nm);
+         blockSolver_.allocate(nm);
+         isAllocated_ = true;
+      }
+   }
+
+   /*
+   * Compute block diagonal preconditioner.
+   *
+   * The block for grid point i is the local part of the Jacobian 
+   * dR(j)/dW(m) at that point, obtained by approximating dC(k)/dW(m)
+   * by -C(k) for k = m, and zero otherwise, in the incompressibility
+   * residual. The resulting changes in interaction contributions to
+   * w fields are omitted, because this local approximation greatly
+   * overestimates them for polymers.
+   */
+   void NkIterator::computePreconditioner()
+   {
+      int nm = mixture().nMonomer();
+      int nx = domain().nx();
+      int i, j, m;
+      double* ptr;
+      for (i = 0; i < nx; ++i) {
+         // Row 0: Incompressibility constraint
+         for (m = 0; m < nm; ++m) {
+            block_(0, m) = -system().cField(m)[i];
+         }
+
+         // Rows j > 0: Differences of w field residuals
+         for (j = 1; j < nm; ++j) {
+            for (m = 0; m < nm; ++m) {
+               block_(j, m) = 0.0;
+            }
+            block_(j, j) -= 1.0;
+            block_(j, 0) += 1.0;
+         }
+
+         // Residual nx-1 of canonical ensemble is last w field
+         if (isCanonical_ && i == nx - 1) {
+            for (m = 0; m < nm; ++m) {
+               block_(0, m) = 0.0;
+            }
+            block_(0, nm-1) = 1.0;
+         }
+
+         blockSolver_.computeLU(block_);
+         blockSolver_.inverse(blockInverse_);
+         ptr = &preconditioner_[i*nm*nm];
+         for (j = 0; j < nm; ++j) {
+            for (m = 0; m < nm; ++m) {
+               ptr[j*nm + m] = blockInverse_(j, m);
+            }
+         }
+      }
+   }
+
+   /*
+   * Apply inverse of block diagonal preconditioner.
+   */
+   void NkIterator::applyPreconditioner(Array<double> const & in, 
+                                        Array<double>& out)
+   {
+      int nm = mixture().nMonomer();
+      int nx = domain().nx();
+      int i, j, m;
+      double const * ptr;
+      double sum;
+      for (i = 0; i < nx; ++i) {
+         ptr = &preconditioner_[i*nm*nm];
+         for (j = 0; j < nm; ++j) {
+            sum = 0.0;
+            for (m = 0; m < nm; ++m) {
+               sum += ptr[j*nm + m]*in[m*nx + i];
+            }
+            out[j*nx + i] = sum;
+         }
+      }
+   }
+
+   /*
+   * Compute product of Jacobian and a vector by a finite difference.
+   */
+   void NkIterator::multiplyJacobian(Array<double> const & v, 
+                                     Array<double>& product)
+   {
+      int nm = mixture().nMonomer();
+      int nx = domain().nx();
+      int nr = nm*nx;
+      int i, j, k;
+
+      double vNorm = 0.0;
+      double wNorm = 0.0;
+      k = 0;
+      for (i = 0; i < nm; ++i) {
+         for (j = 0; j < nx; ++j) {
+            vNorm += v[k]*v[k];
+            wNorm += system().wField(i)[j]*system().wField(i)[j];
+            ++k;
+         }
+      }
+      if (vNorm == 0.0) {
+         for (k = 0; k < nr; ++k) {
+            product[k] = 0.0;
+         }
+         return;
+      }
+      vNorm = sqrt(vNorm);
+      wNorm = sqrt(wNorm);
+
+      // Step size, relative to magnitudes of w and v
+      double h = 1.0E-7*(1.0 + wNorm)/vNorm;
+
+      k = 0;
+      for (i = 0; i < nm; ++i) {
+         for (j = 0; j < nx; ++j) {
+            wFieldsNew_[i][j] = system().wField(i)[j] + h*v[k];
+            ++k;
+         }
+      }
+      mixture().compute(wFieldsNew_, cFieldsNew_);
+      computeResidual(wFieldsNew_, cFieldsNew_, residualNew_);
+      for (k = 0; k < nr; ++k) {
+         product[k] = (residualNew_[k] - residual_[k])/h;
+      }
+   }
+
+   /*
+   * Solve J dOmega_ = residual_ by right-preconditioned GMRES.
+   */
+   void NkIterator::solveNewtonStep()
+   {
+      int nr = residual_.capacity();
+      int i, j, k;
+      double beta, product, temp, denom;
+
+      beta = 0.0;
+      for (i = 0; i < nr; ++i) {
+         beta += residual_[i]*residual_[i];
+      }
+      beta = sqrt(beta);
+      if (beta == 0.0) {
+         for (i = 0; i < nr; ++i) {
+            dOmega_[i] = 0.0;
+         }
+         return;
+      }
+      for (i = 0; i < nr; ++i) {
+         basis_[0][i] = residual_[i]/beta;
+      }
+      g_[0] = beta;
+
+      // Arnoldi iteration, with least squares solution updated by 
+      // Givens rotations. Upon exit, k is the dimension of the 
+      // Krylov subspace.
+      k = 0;
+      while (k < maxKrylov_) {
+         applyPreconditioner(basis_[k], z_);
+         multiplyJacobian(z_, v_);
+         ++nKrylov_;
+
+         // Modified Gram-Schmidt orthogonalization
+         for (i = 0; i <= k; ++i) {
+            product = 0.0;
+            for (j = 0; j < nr; ++j) {
+               product += v_[j]*basis_[i][j];
+            }
+            hessenberg_(i, k) = product;
+            for (j = 0; j < nr; ++j) {
+               v_[j] -= product*basis_[i][j];
+            }
+         }
+         product = 0.0;
+         for (j = 0; j < nr; ++j) {
+            product += v_[j]*v_[j];
+         }
+         product = sqrt(product);
+         hessenberg_(k+1, k) = product;
+         if (product > 0.0) {
+            for (j = 0; j < nr; ++j) {
+               basis_[k+1][j] = v_[j]/product;
+            }
+         }
+
+         // Apply previous rotations to new column
+         for (i = 0; i < k; ++i) {
+            temp = cs_[i]*hessenberg_(i, k) + sn_[i]*hessenberg_(i+1, k);
+            hessenberg_(i+1, k) = -sn_[i]*hessenberg_(i, k) 
+                                 + cs_[i]*hessenberg_(i+1, k);
+            hessenberg_(i, k) = temp;
+         }
+
+         // Compute and apply new rotation
+         denom = sqrt(hessenberg_(k, k)*hessenberg_(k, k) 
+                      + hessenberg_(k+1, k)*hessenberg_(k+1, k));
+         cs_[k] = hessenberg_(k, k)/denom;
+         sn_[k] = hessenberg_(k+1, k)/denom;
+         hessenberg_(k, k) = denom;
+         hessenberg_(k+1, k) = 0.0;
+         g_[k+1] = -sn_[k]*g_[k];
+         g_[k] = cs_[k]*g_[k];
+         ++k;
+
+         // Test for convergence (g_[k] is the residual norm)
+         if (fabs(g_[k]) <= krylovEpsilon_*beta || product == 0.0) {
+            break;
+         }
+      }
+
+      // Back substitution for coefficients y_
+      for (i = k - 1; i >= 0; --i) {
+         temp = g_[i];
+         for (j = i + 1; j < k; ++j) {
+            temp -= hessenberg_(i, j)*y_[j];
+         }
+         y_[i] = temp/hessenberg_(i, i);
+      }
+
+      // dOmega_ = M^{-1} (sum_i y_[i] basis_[i])
+      for (j = 0; j < nr; ++j) {
+         v_[j] = 0.0;
+      }
+      for (i = 0; i < k; ++i) {
+         for (j = 0; j < nr; ++j) {
+            v_[j] += y_[i]*basis_[i][j];
+         }
+      }
+      applyPreconditioner(v_, dOmega_);
+   }
+
+   int NkIterator::solve(bool isContinuation)
+   {
+      int nm = mixture().nMonomer();  // number of monomer types
+      int nx = domain().nx();         // number of grid points
+      int nr = nm*nx;                 // number of residual elements
+
+      // Allocate memory if needed or, if allocated, check array sizes.
+      allocate();
+
+      // Determine ensemble, and shift w fields if canonical
+      setupEnsemble();
+
+      // Compute initial residual vector and norm
+      mixture().compute(system().wFields(), system().cFields());
+      computeResidual(system().wFields(), system().cFields(), residual_);
+      double norm = residualNorm(residual_);
+      nKrylov_ = 0;
+
+      // Iterative loop
+      double normNew;
+      int i, j, k;
+      for (i = 0; i < maxItr_; ++i) {
+         std::cout << "iteration " << i
+                   << " , error = " << norm
+                   << std::endl;
+
+         if (norm < epsilon_) {
+            std::cout << "Converged" << std::endl;
+            system().computeFreeEnergy();
+            nIteration_ = i;
+            // Success
+            return 0;
+         } 
+
+         // Compute Newton increment dOmega_
+         computePreconditioner();
+         solveNewtonStep();
+
+         // Try full Newton update
+         incrementWFields(system().wFields(), dOmega_, wFieldsNew_);
+         mixture().compute(wFieldsNew_, cFieldsNew_);
+         computeResidual(wFieldsNew_, cFieldsNew_, residualNew_);
+         normNew = residualNorm(residualNew_);
+
+         // Decrease increment if necessary
+         j = 0;
+         while (normNew > norm && j < 5) {
+            std::cout << "      decreasing increment,  error = " 
+                      << normNew << std::endl;
+            for (k = 0; k < nr; ++k) {
+               dOmega_[k] *= 0.5;
+            }
+            incrementWFields(system().wFields(), dOmega_, wFieldsNew_);
+            mixture().compute(wFieldsNew_, cFieldsNew_);
+            computeResidual(wFieldsNew_, cFieldsNew_, residualNew_);
+            normNew = residualNorm(residualNew_);
+            ++j;
+         }
+
+         // Accept or reject update
+         if (normNew < norm) {
+            for (j = 0; j < nm; ++j) {
+               for (k = 0; k < nx; ++k) {
+                  system().wField(j)[k] = wFieldsNew_[j][k];
+                  system().cField(j)[k] = cFieldsNew_[j][k];
+               }
+            }
+            for (j = 0; j < nr; ++j) {
+               residual_[j] = residualNew_[j];
+            }
+            norm = normNew;
+         } else {
+            std::cout << "Iteration failed, norm = " 
+                      << normNew << std::endl;
+            nIteration_ = i;
+            return 1;
+         }
+
+      }
+
+      // Failure 
+      nIteration_ = maxItr_;
+      return 1;
+   }
+
+} // namespace Fd1d
+} // namespace Pscf
@@ -0,0 +1,213 @@
+#ifndef FD1D_NK_ITERATOR_H
+#define FD1D_NK_ITERATOR_H
+
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "Iterator.h"
+#include <fd1d/solvers/Mixture.h>
+#include <pscf/math/LuSolver.h>
+#include <util/containers/Array.h>
+#include <util/containers/DArray.h>
+#include <util/containers/DMatrix.h>
+
+namespace Pscf {
+namespace Fd1d
+{
+
+   using namespace Util;
+
+   /**
+   * Jacobian-free Newton-Krylov iterator for SCF equations.
+   *
+   * Each Newton step solves the linear system J dW = R for the change 
+   * dW in the w fields, where R is the residual vector and J is its 
+   * Jacobian, by the GMRES method. GMRES only requires products of J 
+   * with vectors, each of which is approximated by a finite difference
+   * of residuals along one direction, and thus costs one solution of 
+   * the modified diffusion equation. The Jacobian is never stored, so 
+   * memory usage is proportional to nMonomer*nx*maxKrylov.
+   *
+   * The linear system is right-preconditioned by a block diagonal
+   * approximation of the Jacobian, with one nMonomer x nMonomer block 
+   * per grid point, which is obtained by approximating the response of
+   * each concentration to a change in the corresponding w field at the 
+   * same point by dc/dw = -c in the incompressibility constraint. 
+   *
+   * \ingroup Fd1d_Iterator_Module
+   */
+   class NkIterator : public Iterator
+   {
+
+   public:
+
+      /**
+      * Default constructor.
+      */
+      NkIterator();
+
+      /**
+      * Constructor.
+      *
+      * \param system parent System object.
+      */
+      NkIterator(System& system);
+
+      /**
+      * Destructor.
+      */
+      virtual ~NkIterator();
+
+      /**
+      * Read all parameters and initialize.
+      *
+      * \param in input parameter stream
+      */
+      void readParameters(std::istream& in);
+
+      /**
+      * Iterate self-consistent field equations to solution.
+      * 
+      * \param isContinuation True if part of sweep, and not first step.
+      * \return error code: 0 for success, 1 for failure.
+      */
+      int solve(bool isContinuation = false);
+
+      /**
+      * Get error tolerance.
+      */
+      double epsilon() const;
+
+      /**
+      * Get the number of Newton iterations in the last solve().
+      */
+      int nIteration() const;
+
+      /**
+      * Get the total number of GMRES iterations in the last solve().
+      */
+      int nKrylov() const;
+
+   private:
+
+      /// Residual vector. size = nr = (# monomers)x(# grid points).
+      DArray<double> residual_;
+
+      /// Residual for perturbed or trial fields. size = nr.
+      DArray<double> residualNew_;
+
+      /// Newton increment of w fields. size = nr.
+      DArray<double> dOmega_;
+
+      /// Perturbed chemical potential fields (work space).
+      DArray<WField> wFieldsNew_;
+
+      /// Perturbed monomer concentration fields (work space).
+      DArray<CField> cFieldsNew_;
+
+      /// Orthonormal basis of the Krylov subspace (maxKrylov_ + 1).
+      DArray< DArray<double> > basis_;
+
+      /// Work vectors for GMRES. size = nr.
+      DArray<double> z_;
+      DArray<double> v_;
+
+      /// Upper Hessenberg matrix from the Arnoldi process.
+      DMatrix<double> hessenberg_;
+
+      /// Cosines and sines of Givens rotations.
+      DArray<double> cs_;
+      DArray<double> sn_;
+
+      /// Rotated right hand side of the least squares problem.
+      DArray<double> g_;
+
+      /// Solution of the least squares problem.
+      DArray<double> y_;
+
+      /// Inverse preconditioner blocks, nm x nm for each grid point.
+      DArray<double> preconditioner_;
+
+      /// Preconditioner block (work space).
+      DMatrix<double> block_;
+
+      /// Inverse of preconditioner block (work space).
+      DMatrix<double> blockInverse_;
+
+      /// Solver used to invert preconditioner blocks.
+      LuSolver blockSolver_;
+
+      /// Error tolerance.
+      double epsilon_;
+
+      /// Relative tolerance for the GMRES solution of each Newton step.
+      double krylovEpsilon_;
+
+      /// Maximum number of Newton iterations.
+      int maxItr_;
+
+      /// Maximum dimension of the Krylov subspace in each Newton step.
+      int maxKrylov_;
+
+      /// Number of Newton iterations in the last solve().
+      int nIteration_;
+
+      /// Number of GMRES iterations in the last solve().
+      int nKrylov_;
+
+      /// Have arrays been allocated?
+      bool isAllocated_;
+
+      /**
+      * Allocate memory if needed. If isAllocated, check array sizes.
+      */
+      void allocate();
+
+      /**
+      * Compute the preconditioner from the current system c fields.
+      */
+      void computePreconditioner();
+
+      /**
+      * Apply the inverse of the preconditioner to a vector.
+      *
+      * \param in vector indexed like the residual (input)
+      * \param out preconditioned vector (output)
+      */
+      void applyPreconditioner(Array<double> const & in, 
+                               Array<double>& out);
+
+      /**
+      * Compute a finite difference approximation of a product J*v.
+      *
+      * \param v vector indexed like the residual (input)
+      * \param product approximation of J*v (output)
+      */
+      void multiplyJacobian(Array<double> const & v, 
+                            Array<double>& product);
+
+      /**
+      * Solve J dOmega_ = residual_ approximately by GMRES.
+      */
+      void solveNewtonStep();
+
+   };
+
+   // Inline functions
+
+   inline double NkIterator::epsilon() const
+   {  return epsilon_; }
+
+   inline int NkIterator::nIteration() const
+   {  return nIteration_; }
+
+   inline int NkIterator::nKrylov() const
+   {  return nKrylov_; }
+
+} // namespace Fd1d
+} // namespace Pscf
+#endif
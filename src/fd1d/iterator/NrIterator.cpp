@@ -7,9 +7,11 @@
 
 #include "NrIterator.h"
 #include <fd1d/System.h>
+#include <fd1d/domain/Domain.h>
 #include <pscf/inter/Interaction.h>
 
 #include <math.h>
+#include <sstream>
 
 namespace Pscf {
 namespace Fd1d
@@ -19,20 +21,32 @@ namespace Fd1d
 
    NrIterator::NrIterator()
     : Iterator(),
+      maxBroyden_(0),
+      nBroyden_(0),
+      nJacobian_(0),
+      nBroydenUpdate_(0),
+      nIteration_(0),
+      nThread_(1),
       epsilon_(0.0),
       isAllocated_(false),
       newJacobian_(false),
       needsJacobian_(true),
-      isCanonical_(true)
+      hasJacobian_(false)
    {  setClassName("NrIterator"); }
 
    NrIterator::NrIterator(System& system)
     : Iterator(system),
+      maxBroyden_(0),
+      nBroyden_(0),
+      nJacobian_(0),
+      nBroydenUpdate_(0),
+      nIteration_(0),
+      nThread_(1),
       epsilon_(0.0),
       isAllocated_(false),
       newJacobian_(false),
       needsJacobian_(true),
-      isCanonical_(true)
+      hasJacobian_(false)
    {  setClassName("NrIterator"); }
 
    NrIterator::~NrIterator()
@@ -41,6 +55,17 @@ namespace Fd1d
    void NrIterator::readParameters(std::istream& in)
    {
       read(in, "epsilon", epsilon_);
+      maxBroyden_ = 0; // default (recompute Jacobian when needed)
+      readOptional(in, "maxBroyden", maxBroyden_);
+      UTIL_CHECK(maxBroyden_ >= 0);
+      nThread_ = 1; // default (serial Jacobian)
+      readOptional(in, "nThread", nThread_);
+      UTIL_CHECK(nThread_ > 0);
+      #ifndef PSCF_OPENMP
+      if (nThread_ > 1) {
+         UTIL_THROW("nThread > 1 requires compilation with PSCF_OPENMP");
+      }
+      #endif
       if (domain().nx() > 0) {
          allocate();
       }
@@ -54,11 +79,8 @@ namespace Fd1d
       UTIL_CHECK(nx > 0);
       int nr = nm*nx;                  // number of residual components
       if (isAllocated_) {
-         UTIL_CHECK(cArray_.capacity() == nm);
          UTIL_CHECK(residual_.capacity() == nr);
       } else {
-         cArray_.allocate(nm);
-         wArray_.allocate(nm);
          residual_.allocate(nr);
          jacobian_.allocate(nr, nr);
          residualNew_.allocate(nr);
@@ -70,190 +92,313 @@ namespace Fd1d
             cFieldsNew_[i].allocate(nx);
          }
          solver_.allocate(nr);
+         if (maxBroyden_ > 0) {
+            dResidual_.allocate(nr);
+            broydenU_.allocate(maxBroyden_);
+            broydenV_.allocate(maxBroyden_);
+            for (int i = 0; i < maxBroyden_; ++i) {
+               broydenU_[i].allocate(nr);
+               broydenV_[i].allocate(nr);
+            }
+         }
+         if (nThread_ > 1) {
+            threadWFields_.allocate(nThread_);
+            threadCFields_.allocate(nThread_);
+            threadResiduals_.allocate(nThread_);
+            for (int t = 0; t < nThread_; ++t) {
+               threadWFields_[t].allocate(nm);
+               threadCFields_[t].allocate(nm);
+               for (int i = 0; i < nm; ++i) {
+                  threadWFields_[t][i].allocate(nx);
+                  threadCFields_[t][i].allocate(nx);
+               }
+               threadResiduals_[t].allocate(nr);
+            }
+         }
          isAllocated_ = true;
       }
    }
 
-   void NrIterator::computeResidual(Array<WField> const & wFields, 
-                                    Array<CField> const & cFields, 
-                                    Array<double>& residual)
+   /*
+   * Compute Jacobian matrix numerically, by evaluating finite differences.
+   */
+   void NrIterator::computeJacobian()
    {
-      int nm = mixture().nMonomer();  // number of monomer types
-      int nx = domain().nx();         // number of grid points
-      int i;                          // grid point index
-      int j;                          // monomer indices
-      int ir;                         // residual index
-
-      // Loop over grid points
-      for (i = 0; i < nx; ++i) {
-
-         // Copy volume fractions at grid point i to cArray_
-         for (j = 0; j < nm; ++j) {
-            cArray_[j] = cFields[j][i];
+      int nm = mixture().nMonomer();   // number of monomer types
+      int nx = domain().nx();          // number of grid points
+      int nr = nm*nx;                  // number of residual elements
+
+      if (nThread_ > 1) {
+
+         // Each thread computes a contiguous range of columns, using
+         // its own Mixture clone and work space.
+         setupThreadMixtures();
+         int t;
+         #ifdef PSCF_OPENMP
+         #pragma omp parallel for num_threads(nThread_) schedule(static,1)
+         #endif
+         for (t = 0; t < nThread_; ++t) {
+            computeColumns(threadMixtures_[t], threadWFields_[t], 
+                           threadCFields_[t], threadResiduals_[t], 
+                           (t*nr)/nThread_, ((t+1)*nr)/nThread_);
          }
 
-         // Compute w fields, without Langrange multiplier, from c fields
-         system().interaction().computeW(cArray_, wArray_);
+      } else {
+         computeColumns(mixture(), wFieldsNew_, cFieldsNew_, 
+                        residualNew_, 0, nr);
+      }
 
-         // Initial residual = wPredicted(from above) - actual w
-         for (j = 0; j < nm; ++j) {
-            ir = j*nx + i;
-            residual[ir] = wArray_[j] - wFields[j][i];
-         }
+      // Decompose Jacobian matrix
+      solver_.computeLU(jacobian_);
 
-         // Residuals j = 1, ..., nm-1 are differences from component j=0
-         for (j = 1; j < nm; ++j) {
-            ir = j*nx + i;
-            residual[ir] = residual[ir] - residual[i];
-         }
+      // Discard Broyden updates of the previous Jacobian
+      nBroyden_ = 0;
+      ++nJacobian_;
+      hasJacobian_ = true;
+   }
 
-         // Residual for component j=0 then imposes incompressiblity
-         residual[i] = -1.0;
-         for (j = 0; j < nm; ++j) {
-            residual[i] += cArray_[j];
-         }
+   /*
+   * Compute Jacobian at the current fields, given the residual there.
+   */
+   void NrIterator::computeJacobian(Array<double> const & residual)
+   {
+      allocate();
+      int nr = residual_.capacity();
+      UTIL_CHECK(residual.capacity() == nr);
+      for (int k = 0; k < nr; ++k) {
+         residual_[k] = residual[k];
       }
+      computeJacobian();
+   }
 
-      /*
-      * Note: In canonical ensemble, the spatial integral of the incompressiblity
-      * residual is guaranteed to be zero, as a result of how volume fractions are
-      * computed in SCFT. One of the nx incompressibility constraints is thus 
-      * redundant. To avoid this redundancy, replace the incompressibility residual
-      * at the last grid point by a residual that requires the w field for the last 
-      * monomer type at the last grid point to equal zero. 
-      */
-
-      if (isCanonical_) {
-         residual[nx-1] = wFields[nm-1][nx-1];
+   /*
+   * Solve a bordered linear system by block elimination.
+   */
+   void NrIterator::solveBordered(Array<double>& b, 
+                                  Array<double> const & c, double d,
+                                  Array<double>& r, double g,
+                                  Array<double>& x, double& y)
+   {
+      UTIL_CHECK(hasJacobian_);
+      int nr = residual_.capacity();
+      UTIL_CHECK(b.capacity() == nr);
+      UTIL_CHECK(c.capacity() == nr);
+      UTIL_CHECK(r.capacity() == nr);
+      UTIL_CHECK(x.capacity() == nr);
+
+      // Solve J x = r, and J z = b, using dOmega_ as work space for z
+      applyInverseJacobian(r, x);
+      applyInverseJacobian(b, dOmega_);
+
+      // Eliminate x from the last equation: (d - c.z) y = g - c.x
+      double cx = 0.0;
+      double cz = 0.0;
+      int k;
+      for (k = 0; k < nr; ++k) {
+         cx += c[k]*x[k];
+         cz += c[k]*dOmega_[k];
+      }
+      double denominator = d - cz;
+      if (fabs(denominator) < 1.0E-12) {
+         UTIL_THROW("Singular bordered Jacobian");
+      }
+      y = (g - cx)/denominator;
+      for (k = 0; k < nr; ++k) {
+         x[k] -= y*dOmega_[k];
       }
-
    }
 
    /*
-   * Compute Jacobian matrix numerically, by evaluating finite differences.
+   * Compute columns begin <= jc < end of the Jacobian.
    */
-   void NrIterator::computeJacobian()
+   void NrIterator::computeColumns(Mixture& mixture, 
+                                   DArray<WField>& wFields, 
+                                   DArray<CField>& cFields,
+                                   DArray<double>& residual, 
+                                   int begin, int end)
    {
-      // std::cout << "Begin computeJacobian ... ";
-      int nm = mixture().nMonomer();   // number of monomer types
+      int nm = mixture.nMonomer();     // number of monomer types
       int nx = domain().nx();          // number of grid points
+      int nr = nm*nx;                  // number of residual elements
       int i;                           // monomer index
       int j;                           // grid point index
 
-      // Copy system().wFields to wFieldsNew.
+      // Copy system().wFields to wFields.
       for (i = 0; i < nm; ++i) {
+         UTIL_CHECK(nx == wFields[i].capacity());
+         UTIL_CHECK(nx == system().wField(i).capacity());
          for (j = 0; j < nx; ++j) {
-            UTIL_CHECK(nx == wFieldsNew_[i].capacity());
-            UTIL_CHECK(nx == system().wField(i).capacity());
-            wFieldsNew_[i][j] = system().wField(i)[j];
+            wFields[i][j] = system().wField(i)[j];
          }
       }
 
       // Compute jacobian, column by column
       double delta = 0.001;
-      int nr = nm*nx;              // number of residual elements
       int jr;                      // jacobian row index
-      int jc = 0;                  // jacobian column index
-      for (i = 0; i < nm; ++i) {
-         for (j = 0; j < nx; ++j) {
-            wFieldsNew_[i][j] += delta;
-            mixture().compute(wFieldsNew_, cFieldsNew_);
-            computeResidual(wFieldsNew_, cFieldsNew_, residualNew_);
-            for (jr = 0; jr < nr; ++jr) {
-               jacobian_(jr, jc) = 
-                    (residualNew_[jr] - residual_[jr])/delta;
-            }
-            wFieldsNew_[i][j] = system().wField(i)[j];
-            ++jc;
+      int jc;                      // jacobian column index
+      for (jc = begin; jc < end; ++jc) {
+         i = jc/nx;
+         j = jc - i*nx;
+         wFields[i][j] += delta;
+         mixture.compute(wFields, cFields);
+         computeResidual(wFields, cFields, residual);
+         for (jr = 0; jr < nr; ++jr) {
+            jacobian_(jr, jc) = (residual[jr] - residual_[jr])/delta;
          }
+         wFields[i][j] = system().wField(i)[j];
       }
-
-      // Decompose Jacobian matrix
-      solver_.computeLU(jacobian_);
-
-      // std::cout << "Finish computeJacobian" << std::endl;
    }
 
-   void NrIterator::incrementWFields(Array<WField> const & wOld, 
-                                     Array<double> const & dW, 
-                                     Array<WField> & wNew)
+   /*
+   * Create and update Mixture clones used by threads.
+   */
+   void NrIterator::setupThreadMixtures()
    {
-      int nm = mixture().nMonomer(); // number of monomers types
-      int nx = domain().nx();        // number of grid points
-      int i;                         // monomer index
-      int j;                         // grid point index
-      int k = 0;                     // residual element index
+      Mixture& parent = mixture();
+      int np = parent.nPolymer();
+      int i, j, t;
+
+      if (!threadMixtures_.isAllocated()) {
+
+         // Clone the parent by writing and reading its parameter block
+         std::stringstream buffer;
+         parent.writeParam(buffer);
+         std::string text = buffer.str();
+         bool echo = ParamComponent::echo();
+         ParamComponent::setEcho(false);
+         threadMixtures_.allocate(nThread_);
+         for (t = 0; t < nThread_; ++t) {
+            Mixture& clone = threadMixtures_[t];
+            std::istringstream in(text);
+            clone.readParam(in);
+            UTIL_CHECK(clone.nMonomer() == parent.nMonomer());
+            UTIL_CHECK(clone.nPolymer() == np);
+
+            // Each clone is used by one thread of the column loop in
+            // computeJacobian, so its propagators are solved serially
+            // even if the parent solves them with threads.
+            for (i = 0; i < np; ++i) {
+               clone.polymer(i).setUseThreads(false);
+            }
 
-      // Add dW
-      for (i = 0; i < nm; ++i) {
-         for (j = 0; j < nx; ++j) {
-            wNew[i][j] = wOld[i][j] - dW[k];
-            ++k;
+            // Set block lengths that yield the same number of contour 
+            // steps as the parent, which may differ from that obtained
+            // from the current length if the length has been swept.
+            for (i = 0; i < np; ++i) {
+               Polymer& polymer = clone.polymer(i);
+               for (j = 0; j < polymer.nBlock(); ++j) {
+                  Block const & block = parent.polymer(i).block(j);
+                  polymer.block(j).setLength(parent.ds()*(block.ns() - 1));
+               }
+            }
+            clone.setDomain(domain());
+            for (i = 0; i < np; ++i) {
+               Polymer& polymer = clone.polymer(i);
+               for (j = 0; j < polymer.nBlock(); ++j) {
+                  UTIL_CHECK(polymer.block(j).ns() 
+                             == parent.polymer(i).block(j).ns());
+               }
+            }
          }
+         ParamComponent::setEcho(echo);
       }
 
-      // If canonical, shift such that last element is exactly zero
-      if (isCanonical_) {
-         double shift = wNew[nm-1][nx-1];
-         for (i = 0; i < nm; ++i) {
-            for (j = 0; j < nx; ++j) {
-               wNew[i][j] -= shift;
+      // Copy exact current values of parameters that a sweep may change
+      for (t = 0; t < nThread_; ++t) {
+         for (i = 0; i < np; ++i) {
+            Polymer& original = parent.polymer(i);
+            Polymer& polymer = threadMixtures_[t].polymer(i);
+            if (original.ensemble() == Species::Closed) {
+               polymer.setPhi(original.phi());
+            } else {
+               polymer.setMu(original.mu());
+            }
+            for (j = 0; j < polymer.nBlock(); ++j) {
+               polymer.block(j).setLength(original.block(j).length());
+               polymer.block(j).setKuhn(original.block(j).kuhn());
             }
          }
       }
+   }
 
+   /*
+   * Multiply a vector by the approximate inverse Jacobian.
+   */
+   void NrIterator::applyInverseJacobian(Array<double>& in, 
+                                         Array<double>& out)
+   {
+      // Inverse of finite difference Jacobian
+      solver_.solve(in, out);
+
+      // Broyden corrections, out += u (v^T in)
+      int nr = in.capacity();
+      double product;
+      int i, k;
+      for (k = 0; k < nBroyden_; ++k) {
+         DArray<double> const & u = broydenU_[k];
+         DArray<double> const & v = broydenV_[k];
+         product = 0.0;
+         for (i = 0; i < nr; ++i) {
+            product += v[i]*in[i];
+         }
+         for (i = 0; i < nr; ++i) {
+            out[i] += product*u[i];
+         }
+      }
    }
-   
-   double NrIterator::residualNorm(Array<double> const & residual) const
+
+   /*
+   * Add a Broyden update H -> H + u v^T of the inverse Jacobian H.
+   *
+   * The update satisfies the secant condition H dR = dW, in which dW
+   * is the change in w fields and dR is the change in residual, and 
+   * v = dR / |dR|^2 ("bad" Broyden update of the inverse).
+   */
+   bool NrIterator::updateBroyden()
    {
-      int nm = mixture().nMonomer();  // number of monomer types
-      int nx = domain().nx();         // number of grid points
-      int nr = nm*nx;                 // number of residual components
-      double value, norm;
-      norm = 0.0;
-      for (int ir = 0; ir <  nr; ++ir) {
-         value = fabs(residual[ir]);
-         if (value > norm) {
-            norm = value;
+      if (nBroyden_ >= maxBroyden_) return false;
+
+      int nm = mixture().nMonomer();
+      int nx = domain().nx();
+      int nr = nm*nx;
+
+      double norm2 = 0.0;
+      for (int i = 0; i < nr; ++i) {
+         norm2 += dResidual_[i]*dResidual_[i];
+      }
+      if (norm2 <= 0.0) return false;
+
+      // Use dOmega_ as work space for H dR
+      applyInverseJacobian(dResidual_, dOmega_);
+
+      DArray<double>& u = broydenU_[nBroyden_];
+      DArray<double>& v = broydenV_[nBroyden_];
+      int i, j, k;
+      k = 0;
+      for (i = 0; i < nm; ++i) {
+         for (j = 0; j < nx; ++j) {
+            u[k] = (wFieldsNew_[i][j] - system().wField(i)[j] 
+                    - dOmega_[k])/norm2;
+            v[k] = dResidual_[k];
+            ++k;
          }
       }
-      return norm;
+      ++nBroyden_;
+      ++nBroydenUpdate_;
+      return true;
    }
 
    int NrIterator::solve(bool isContinuation)
    {
       int nm = mixture().nMonomer();  // number of monomer types
-      int np = mixture().nPolymer();  // number of polymer species 
       int nx = domain().nx();         // number of grid points
       int nr = nm*nx;                 // number of residual elements
 
       // Allocate memory if needed or, if allocated, check array sizes.
       allocate();
 
-      // Determine if isCanonical (iff all species ensembles are closed)
-      isCanonical_ = true;
-      Species::Ensemble ensemble;
-      for (int i = 0; i < np; ++i) {
-         ensemble = mixture().polymer(i).ensemble();
-         if (ensemble == Species::Unknown) {
-            UTIL_THROW("Unknown species ensemble");
-         }
-         if (ensemble == Species::Open) {
-            isCanonical_ = false;
-         }
-      }
-
-      // If isCanonical, shift so that last element is zero.
-      // Note: This is one of the residuals in this case.
-      if (isCanonical_) {
-         double shift = wFields()[nm-1][nx-1];
-         int i, j;
-         for (i = 0; i < nm; ++i) {
-            for (j = 0; j < nx; ++j) {
-               wFields()[i][j] -= shift;
-            }
-         }
-      }
+      // Determine ensemble, and shift w fields if canonical
+      setupEnsemble();
 
       // Compute initial residual vector and norm
       mixture().compute(system().wFields(), system().cFields());
@@ -262,6 +407,9 @@ namespace Fd1d
 
       // Set Jacobian status
       newJacobian_ = false;
+      nJacobian_ = 0;
+      nBroydenUpdate_ = 0;
+      nIteration_ = 0;
       if (!isContinuation) {
          needsJacobian_ = true;
       }
@@ -278,6 +426,7 @@ namespace Fd1d
             std::cout << "Converged" << std::endl;
             system().computeFreeEnergy();
             // Success
+            nIteration_ = i;
             return 0;
          } 
 
@@ -289,7 +438,7 @@ namespace Fd1d
          }
 
          // Compute Newton-Raphson increment dOmega_
-         solver_.solve(residual_, dOmega_);
+         applyInverseJacobian(residual_, dOmega_);
 
          // Try full Newton-Raphson update
          incrementWFields(system().wFields(), dOmega_, wFieldsNew_);
@@ -302,7 +451,9 @@ namespace Fd1d
          while (normNew > norm && j < 3) {
             std::cout << "      decreasing increment,  error = " 
                       << normNew << std::endl;
-            needsJacobian_ = true;
+            if (maxBroyden_ == 0) {
+               needsJacobian_ = true;
+            }
             for (k = 0; k < nr; ++k) {
                dOmega_[k] *= 0.66666666;
             }
@@ -317,7 +468,9 @@ namespace Fd1d
          if (normNew > norm) {
             std::cout << "      reversing increment,  norm = " 
                       << normNew << std::endl;
-            needsJacobian_ = true;
+            if (maxBroyden_ == 0) {
+               needsJacobian_ = true;
+            }
             for (k = 0; k < nr; ++k) {
                dOmega_[k] *= -1.000;
             }
@@ -330,6 +483,16 @@ namespace Fd1d
          // Accept or reject update
          if (normNew < norm) {
 
+            // Update inverse Jacobian, before changing system fields
+            if (maxBroyden_ > 0) {
+               for (j = 0; j < nr; ++j) {
+                  dResidual_[j] = residualNew_[j] - residual_[j];
+               }
+               if (!updateBroyden()) {
+                  needsJacobian_ = true;
+               }
+            }
+
             // Update system fields and residual vector
             for (j = 0; j < nm; ++j) {
                for (k = 0; k < nx; ++k) {
@@ -342,8 +505,15 @@ namespace Fd1d
             }
             newJacobian_ = false;
             if (!needsJacobian_) {
-               if (normNew/norm > 0.5) {
-                  needsJacobian_ = true;
+               if (maxBroyden_ == 0) {
+                  if (normNew/norm > 0.5) {
+                     needsJacobian_ = true;
+                  }
+               } else {
+                  // Quasi-Newton updates tolerate slower convergence
+                  if (normNew/norm > 0.9) {
+                     needsJacobian_ = true;
+                  }
                }
             }
             norm = normNew;
@@ -351,6 +521,7 @@ namespace Fd1d
             std::cout << "Iteration failed, norm = " 
                       << normNew << std::endl;
             if (newJacobian_) {
+               nIteration_ = i + 1;
                return 1;
                std::cout << "Unrecoverable failure " << std::endl;
             } else {
@@ -362,6 +533,7 @@ namespace Fd1d
       }
 
       // Failure 
+      nIteration_ = i;
       return 1;
    }
 
@@ -24,6 +24,26 @@ namespace Fd1d
    /**
    * Newton-Raphson Iterator for SCF equations.
    *
+   * The Jacobian is computed by finite differences, which requires one
+   * solution of the modified diffusion equation for each column. If the
+   * optional parameter maxBroyden is positive, the inverse Jacobian is 
+   * instead updated after each accepted step by a rank-one ("bad") 
+   * Broyden update, which requires no additional solutions, and the 
+   * Jacobian is only recomputed after maxBroyden updates or if a step 
+   * fails. The inverse is stored as the LU factorization of the last
+   * finite difference Jacobian plus a sum of rank-one corrections.
+   *
+   * If the optional parameter nThread is greater than 1, the columns
+   * of the finite difference Jacobian are computed by nThread OpenMP 
+   * threads. Each thread uses a private clone of the Mixture and 
+   * private work space, and computes a contiguous range of columns.
+   *
+   * The functions computeJacobian(residual) and solveBordered() allow
+   * a continuation algorithm (e.g., pseudo-arclength continuation in
+   * Sweep) to solve the SCF equations augmented by one additional 
+   * unknown and one additional equation, reusing the factorization of 
+   * the Jacobian.
+   *
    * \ingroup Fd1d_Iterator_Module
    */
    class NrIterator : public Iterator
@@ -31,16 +51,6 @@ namespace Fd1d
 
    public:
 
-      /**
-      * Monomer chemical potential field.
-      */
-      typedef Mixture::WField WField;
-
-      /**
-      * Monomer concentration / volume fraction field.
-      */
-      typedef Mixture::CField CField;
-
       /**
       * Default constructor.
       */
@@ -79,27 +89,64 @@ namespace Fd1d
       double epsilon();
 
       /**
-      * Compute the residual vector.
+      * Compute the Jacobian matrix (stored in class member).
+      */
+      void computeJacobian();
+
+      /**
+      * Compute the Jacobian at the current system w fields.
       *
-      * \param wFields monomer chemical potential fields (input)
-      * \param cFields monomer concentration fields (input)
-      * \param residual vector of residuals (errors) (output)
+      * Equivalent to computeJacobian(), for use outside of solve().
+      *
+      * \param residual residual at the current w and c fields (input)
       */
-      void computeResidual(Array<WField> const & wFields, 
-                           Array<WField> const & cFields, 
-                           Array<double>& residual);
+      void computeJacobian(Array<double> const & residual);
 
       /**
-      * Compute and return norm of a residual vector.
+      * Solve the linear system for the Jacobian bordered by one row 
+      * and one column.
+      *
+      * Solves J x + b y = r and c.x + d y = g for the vector x and the
+      * scalar y, using the current (approximate) inverse Jacobian J^{-1},
+      * by block elimination ("bordering"). This requires two solutions
+      * with the existing LU factorization, and no new factorization.
       *
-      * \param residual vector of residuals (errors) (input)
+      * \param b  last column, excluding the corner (input)
+      * \param c  last row, excluding the corner (input)
+      * \param d  corner element (input)
+      * \param r  right hand side, excluding the last element (input)
+      * \param g  last element of right hand side (input)
+      * \param x  solution, excluding the last element (output)
+      * \param y  last element of the solution (output)
       */
-      double residualNorm(Array<double> const & residual) const;
+      void solveBordered(Array<double>& b, Array<double> const & c, 
+                         double d, Array<double>& r, double g,
+                         Array<double>& x, double& y);
 
       /**
-      * Compute the Jacobian matrix (stored in class member).
+      * Has a Jacobian been computed and factorized?
       */
-      void computeJacobian();
+      bool hasJacobian() const;
+
+      /**
+      * Get the number of Jacobian calculations in the last solve().
+      */
+      int nJacobian() const;
+
+      /**
+      * Get the number of Broyden updates applied in the last solve().
+      */
+      int nBroydenUpdate() const;
+
+      /**
+      * Get the number of Newton iterations in the last solve().
+      */
+      int nIteration() const;
+
+      /**
+      * Get the number of threads used to compute the Jacobian.
+      */
+      int nThread() const;
 
    private:
 
@@ -112,12 +159,6 @@ namespace Fd1d
       /// Perturbed monomer concentration fields (work space).
       DArray<WField> cFieldsNew_;
 
-      /// Concentrations at one point (work space).
-      DArray<double> cArray_;
-
-      /// Chemical potentials at one point (work space).
-      DArray<double> wArray_;
-
       /// Residual vector. size = nr = (# monomers)x(# grid points).
       DArray<double> residual_;
 
@@ -130,6 +171,45 @@ namespace Fd1d
       /// Change in field
       DArray<double> dOmega_;
 
+      /// Vectors u of Broyden updates H += u v^T of inverse Jacobian.
+      DArray< DArray<double> > broydenU_;
+
+      /// Vectors v of Broyden updates H += u v^T of inverse Jacobian.
+      DArray< DArray<double> > broydenV_;
+
+      /// Change in residual over the last accepted step (work space).
+      DArray<double> dResidual_;
+
+      /// Maximum number of Broyden updates (0 for pure Newton-Raphson).
+      int maxBroyden_;
+
+      /// Number of Broyden updates since the Jacobian was computed.
+      int nBroyden_;
+
+      /// Number of Jacobian calculations in the last solve().
+      int nJacobian_;
+
+      /// Number of Broyden updates in the last solve().
+      int nBroydenUpdate_;
+
+      /// Number of Newton iterations in the last solve().
+      int nIteration_;
+
+      /// Mixture clones used by threads to compute Jacobian columns.
+      DArray<Mixture> threadMixtures_;
+
+      /// Perturbed w fields for each thread (work space).
+      DArray< DArray<WField> > threadWFields_;
+
+      /// Perturbed c fields for each thread (work space).
+      DArray< DArray<CField> > threadCFields_;
+
+      /// Perturbed residual for each thread (work space).
+      DArray< DArray<double> > threadResiduals_;
+
+      /// Number of threads used to compute the Jacobian.
+      int nThread_;
+
       /// Error tolerance.
       double epsilon_;
 
@@ -142,8 +222,8 @@ namespace Fd1d
       /// Does the Jacobian need to be re-calculated ?
       bool needsJacobian_;
 
-      /// Is the ensemble canonical for all species ?
-      bool isCanonical_;
+      /// Has a Jacobian ever been computed and factorized ?
+      bool hasJacobian_;
 
       /**
       * Allocate memory if needed. If isAllocated, check array sizes.
@@ -151,23 +231,72 @@ namespace Fd1d
       void allocate();
 
       /**
-      * Increment the chemical potential fields
+      * Compute a range of columns of the Jacobian.
+      *
+      * Perturbs one element of the system w fields for each column, 
+      * using the mixture and work space passed as arguments.
       *
-      * \param wOld array of old chemical potential fields
-      * \param dW array of increments, indexed as in residual columns
-      * \param wNew array of new chemical potential fields
+      * \param mixture Mixture used to solve the MDE
+      * \param wFields perturbed w fields (work space)
+      * \param cFields perturbed c fields (work space)
+      * \param residual perturbed residual (work space)
+      * \param begin index of the first column
+      * \param end index one past the last column
       */
-      void incrementWFields(Array<WField> const & wOld,
-                            Array<double> const & dW,
-                            Array<WField>& wNew);
+      void computeColumns(Mixture& mixture, 
+                          DArray<WField>& wFields, 
+                          DArray<CField>& cFields,
+                          DArray<double>& residual, 
+                          int begin, int end);
+
+      /**
+      * Create Mixture clones for threads if needed, and update them.
+      *
+      * Clones are created on the first call, and copy parameters that
+      * may be modified by a sweep (phi or mu, block lengths and 
+      * statistical segment lengths) from the parent on every call.
+      */
+      void setupThreadMixtures();
+
+      /**
+      * Multiply a vector by the approximate inverse Jacobian.
+      *
+      * \param in vector indexed like the residual (input)
+      * \param out product of inverse Jacobian and in (output)
+      */
+      void applyInverseJacobian(Array<double>& in, Array<double>& out);
+
+      /**
+      * Add a Broyden update of the inverse Jacobian for a step.
+      *
+      * The update maps dResidual_ onto the change in w fields from 
+      * system().wFields() to wFieldsNew_. Returns false if no update 
+      * was added, in which case the Jacobian must be recomputed.
+      */
+      bool updateBroyden();
 
    };
 
-   // Inline function
+   // Inline functions
 
    inline double NrIterator::epsilon()
    {  return epsilon_; }
 
+   inline int NrIterator::nJacobian() const
+   {  return nJacobian_; }
+
+   inline int NrIterator::nBroydenUpdate() const
+   {  return nBroydenUpdate_; }
+
+   inline int NrIterator::nIteration() const
+   {  return nIteration_; }
+
+   inline int NrIterator::nThread() const
+   {  return nThread_; }
+
+   inline bool NrIterator::hasJacobian() const
+   {  return hasJacobian_; }
+
 } // namespace Fd1d
 } // namespace Pscf
 #endif
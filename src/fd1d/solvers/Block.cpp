@@ -285,5 +285,56 @@ namespace Fd1d
       solver_.solve(v_, qNew);
    }
 
+   /*
+   * Propagate several interleaved fields by one step.
+   */
+   void Block::step(Array<double> const & q, Array<double>& qNew, 
+                    int nBatch)
+   {
+      int nx = domain().nx();
+      UTIL_CHECK(nBatch > 0);
+      UTIL_CHECK(q.capacity() >= nx*nBatch);
+      UTIL_CHECK(qNew.capacity() >= nx*nBatch);
+      double const * qp = &q[0];
+      double * vp = &qNew[0];
+      double d, l, u;
+      int i, j, k;
+
+      // Compute v = B q, storing v in qNew
+      d = dB_[0];
+      u = uB_[0];
+      #ifdef PSCF_OPENMP
+      #pragma omp simd
+      #endif
+      for (k = 0; k < nBatch; ++k) {
+         vp[k] = d*qp[k] + u*qp[nBatch + k];
+      }
+      for (i = 1; i < nx - 1; ++i) {
+         d = dB_[i];
+         l = lB_[i-1];
+         u = uB_[i];
+         j = i*nBatch;
+         #ifdef PSCF_OPENMP
+         #pragma omp simd
+         #endif
+         for (k = 0; k < nBatch; ++k) {
+            vp[j + k] = d*qp[j + k] + l*qp[j - nBatch + k] 
+                      + u*qp[j + nBatch + k];
+         }
+      }
+      d = dB_[nx-1];
+      l = lB_[nx-2];
+      j = (nx - 1)*nBatch;
+      #ifdef PSCF_OPENMP
+      #pragma omp simd
+      #endif
+      for (k = 0; k < nBatch; ++k) {
+         vp[j + k] = d*qp[j + k] + l*qp[j - nBatch + k];
+      }
+
+      // Solve A qNew = v in place
+      solver_.solve(qNew, qNew, nBatch);
+   }
+
 }
 }
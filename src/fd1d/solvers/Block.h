@@ -97,6 +97,21 @@ namespace Fd1d
       */
       void step(QField const & q, QField& qNew);
 
+      /**
+      * Compute one step for several propagators together.
+      *
+      * Fields are stored in interleaved order, in which element i 
+      * of field k is element i*nBatch + k of array q or qNew. All 
+      * fields are propagated using the matrices of this block, with 
+      * the same operations as step(q, qNew). Arrays q and qNew must 
+      * be distinct.
+      *
+      * \param q fields at step i (input)
+      * \param qNew fields at step i + 1 (output)
+      * \param nBatch number of fields
+      */
+      void step(Array<double> const & q, Array<double>& qNew, int nBatch);
+
       /**
       * Return associated domain by reference.
       */
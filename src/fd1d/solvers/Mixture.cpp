@@ -17,6 +17,7 @@ namespace Fd1d
    Mixture::Mixture()
     : vMonomer_(1.0),
       ds_(-1.0),
+      threadPropagators_(false),
       domainPtr_(0)
    {  setClassName("Mixture"); }
 
@@ -29,10 +30,17 @@ namespace Fd1d
       vMonomer_ = 1.0; // Default value
       readOptional(in, "vMonomer", vMonomer_);
       read(in, "ds", ds_);
+      threadPropagators_ = false; // Default value
+      readOptional(in, "threadPropagators", threadPropagators_);
 
       UTIL_CHECK(nMonomer() > 0);
       UTIL_CHECK(nPolymer()+ nSolvent() > 0);
       UTIL_CHECK(ds_ > 0);
+
+      // Choose batched or threaded solution of propagators
+      for (int i = 0; i < nPolymer(); ++i) {
+         polymer(i).setUseThreads(threadPropagators_);
+      }
    }
 
    void Mixture::setDomain(Domain const& domain)
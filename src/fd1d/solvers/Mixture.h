@@ -116,6 +116,19 @@ namespace Fd1d
       */
       double vMonomer() const;
 
+      /**
+      * Get optimal contour length step size.
+      */
+      double ds() const;
+
+      /**
+      * Are propagators of different blocks solved by threads?
+      *
+      * If false (the default), propagators of equivalent blocks are
+      * instead solved together in batches, without threads.
+      */
+      bool threadPropagators() const;
+
    private:
 
       /// Monomer reference volume (set to 1.0 by default).
@@ -124,6 +137,9 @@ namespace Fd1d
       /// Optimal contour length step size.
       double ds_;
 
+      /// Solve propagators by threads, rather than in batches?
+      bool threadPropagators_;
+
       /// Pointer to associated Domain object.
       Domain const * domainPtr_;
 
@@ -140,6 +156,18 @@ namespace Fd1d
    inline double Mixture::vMonomer() const
    {  return vMonomer_; }
 
+   /*
+   * Get optimal contour length step size (public).
+   */
+   inline double Mixture::ds() const
+   {  return ds_; }
+
+   /*
+   * Are propagators of different blocks solved by threads (public).
+   */
+   inline bool Mixture::threadPropagators() const
+   {  return threadPropagators_; }
+
    /*
    * Get Domain by constant reference (private).
    */
@@ -6,6 +6,7 @@
 */
 
 #include "Polymer.h"
+#include <fd1d/domain/Domain.h>
 
 namespace Pscf {
 namespace Fd1d 
@@ -47,5 +48,69 @@ namespace Fd1d
       solve();
    }
 
+   /*
+   * Solve MDE for all propagators, in waves of batched propagators.
+   */
+   void Polymer::solveUnthreaded()
+   {
+      int np = nPropagator();
+      int nx = block(0).domain().nx();
+      if (!qBatch_.isAllocated()) {
+         qBatch_.allocate(nx*np);
+         qNewBatch_.allocate(nx*np);
+      }
+      UTIL_CHECK(qBatch_.capacity() == nx*np);
+
+      int nSolved = 0;
+      int i, j, k, n;
+      while (nSolved < np) {
+
+         // Collect all unsolved propagators that are ready, in plan order
+         wave_.clear();
+         for (j = 0; j < np; ++j) {
+            if (!propagator(j).isSolved() && propagator(j).isReady()) {
+               wave_.append(j);
+            }
+         }
+         n = wave_.size();
+         UTIL_CHECK(n > 0);
+
+         // Solve groups of propagators with identical matrices. Plan
+         // indices in wave_ are set to -1 when added to a batch.
+         for (i = 0; i < n; ++i) {
+            if (wave_[i] < 0) continue;
+            Propagator& first = propagator(wave_[i]);
+            batch_.clear();
+            batch_.append(&first);
+            for (k = i + 1; k < n; ++k) {
+               if (wave_[k] < 0) continue;
+               Propagator& other = propagator(wave_[k]);
+               if (haveSameMatrices(first.block(), other.block())) {
+                  batch_.append(&other);
+                  wave_[k] = -1;
+               }
+            }
+            if (batch_.size() == 1) {
+               first.solve();
+            } else {
+               Propagator::solveBatch(batch_, qBatch_, qNewBatch_);
+            }
+         }
+         nSolved += n;
+      }
+   }
+
+   /*
+   * Do two blocks have identical Crank-Nicholson matrices?
+   */
+   bool Polymer::haveSameMatrices(Block const & a, Block const & b)
+   {
+      if (&a == &b) return true;
+      return (a.monomerId() == b.monomerId()
+              && a.kuhn() == b.kuhn()
+              && a.length() == b.length()
+              && a.ns() == b.ns());
+   }
+
 }
 }
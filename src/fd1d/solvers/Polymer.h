@@ -10,6 +10,8 @@
 
 #include "Block.h"
 #include <pscf/solvers/PolymerTmpl.h>
+#include <util/containers/DArray.h>
+#include <util/containers/GArray.h>
 
 namespace Pscf { 
 namespace Fd1d
@@ -54,6 +56,47 @@ namespace Fd1d
       */ 
       void compute(const DArray<Block::WField>& wFields);
 
+   protected:
+
+      /**
+      * Solve the MDE for all propagators, in batches.
+      *
+      * Propagators are solved in a sequence of waves, each of which
+      * contains all unsolved propagators whose sources have all been
+      * solved. Propagators within a wave that belong to blocks with
+      * identical Crank-Nicholson matrices (the same block, or blocks
+      * with equal monomer type, statistical segment length, length 
+      * and number of contour steps) are solved together by 
+      * Propagator::solveBatch. Results are identical to those 
+      * obtained by solving each propagator separately.
+      *
+      * This is used unless threads are enabled by setUseThreads(true),
+      * which is called by Mixture if parameter threadPropagators is 1.
+      */
+      virtual void solveUnthreaded();
+
+   private:
+
+      /// Interleaved q fields for batched steps (work space).
+      DArray<double> qBatch_;
+
+      /// Interleaved q fields for batched steps (work space).
+      DArray<double> qNewBatch_;
+
+      /// Plan indices of unsolved propagators in the current wave.
+      GArray<int> wave_;
+
+      /// Pointers to propagators in the current batch.
+      GArray<Propagator*> batch_;
+
+      /**
+      * Do two blocks have identical Crank-Nicholson matrices?
+      *
+      * \param a first block
+      * \param b second block
+      */
+      static bool haveSameMatrices(Block const & a, Block const & b);
+
    };
 
 } 
@@ -102,6 +102,55 @@ namespace Fd1d
       setIsSolved(true);
    }
 
+   /*
+   * Solve the modified diffusion equation for several propagators.
+   */
+   void Propagator::solveBatch(GArray<Propagator*> const & group,
+                               DArray<double>& q, DArray<double>& qNew)
+   {
+      int nBatch = group.size();
+      UTIL_CHECK(nBatch > 0);
+      Propagator& first = *group[0];
+      int ns = first.ns_;
+      int nx = first.nx_;
+      UTIL_CHECK(q.capacity() >= nx*nBatch);
+      UTIL_CHECK(qNew.capacity() >= nx*nBatch);
+
+      // Compute heads, and copy them to interleaved array q
+      int i, k;
+      for (k = 0; k < nBatch; ++k) {
+         Propagator& p = *group[k];
+         UTIL_CHECK(p.ns_ == ns);
+         UTIL_CHECK(p.nx_ == nx);
+         p.computeHead();
+         QField const & qh = p.qFields_[0];
+         for (i = 0; i < nx; ++i) {
+            q[i*nBatch + k] = qh[i];
+         }
+      }
+
+      // Step all propagators together, copying out each new step
+      DArray<double>* inPtr = &q;
+      DArray<double>* outPtr = &qNew;
+      DArray<double>* tmpPtr;
+      for (int iStep = 0; iStep < ns - 1; ++iStep) {
+         first.block().step(*inPtr, *outPtr, nBatch);
+         for (k = 0; k < nBatch; ++k) {
+            QField& qf = group[k]->qFields_[iStep + 1];
+            for (i = 0; i < nx; ++i) {
+               qf[i] = (*outPtr)[i*nBatch + k];
+            }
+         }
+         tmpPtr = inPtr;
+         inPtr = outPtr;
+         outPtr = tmpPtr;
+      }
+
+      for (k = 0; k < nBatch; ++k) {
+         group[k]->setIsSolved(true);
+      }
+   }
+
    /*
    * Integrate to calculate monomer concentration for this block
    */
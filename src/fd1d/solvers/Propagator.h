@@ -10,6 +10,7 @@
 
 #include <pscf/solvers/PropagatorTmpl.h> // base class template
 #include <util/containers/DArray.h>      // member template
+#include <util/containers/GArray.h>      // function argument
 
 namespace Pscf { 
 namespace Fd1d
@@ -99,6 +100,27 @@ namespace Fd1d
       * \param head initial condition of QField at head of block
       */
       void solve(const QField& head);
+
+      /**
+      * Solve the MDE for several propagators together.
+      *
+      * The propagators in the group must all be ready to be solved,
+      * and must belong to blocks with identical Crank-Nicholson 
+      * matrices and equal numbers of contour steps, e.g., the two 
+      * propagators of one block. The head of each propagator is 
+      * computed from its sources, after which all propagators are 
+      * advanced together by batched steps of the first block.
+      *
+      * The work arrays q and qNew are used to store interleaved 
+      * fields, and must each have a capacity of at least nx times 
+      * the number of propagators.
+      *
+      * \param group pointers to the propagators to be solved
+      * \param q work array
+      * \param qNew work array
+      */
+      static void solveBatch(GArray<Propagator*> const & group, 
+                             DArray<double>& q, DArray<double>& qNew);
  
       /**
       * Compute and return partition function for the molecule.
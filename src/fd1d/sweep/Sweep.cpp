@@ -10,10 +10,14 @@
 #include <fd1d/domain/Domain.h>
 #include <fd1d/solvers/Mixture.h>
 #include <fd1d/iterator/Iterator.h>
+#include <fd1d/iterator/NrIterator.h>
+#include <pscf/math/continuation.h>
 #include <util/misc/ioUtil.h>
 #include <util/format/Int.h>
 #include <util/format/Dbl.h>
 
+#include <math.h>
+
 namespace Pscf {
 namespace Fd1d
 {
@@ -26,7 +30,16 @@ namespace Fd1d
       homogeneousMode_(-1),
       baseFileName_(),
       comparison_(),
-      fieldIo_()
+      fieldIo_(),
+      historyCapacity_(3),
+      nItrTarget_(0),
+      dsMin_(0.0),
+      dsMax_(0.0),
+      useArclength_(false),
+      nrIteratorPtr_(0),
+      tangentS_(0.0),
+      constraintS_(0.0),
+      weightW_(0.0)
    {  setClassName("Sweep"); }
 
    Sweep::Sweep(System& system)
@@ -35,7 +48,16 @@ namespace Fd1d
       homogeneousMode_(-1),
       baseFileName_(),
       comparison_(system),
-      fieldIo_(system)
+      fieldIo_(system),
+      historyCapacity_(3),
+      nItrTarget_(0),
+      dsMin_(0.0),
+      dsMax_(0.0),
+      useArclength_(false),
+      nrIteratorPtr_(0),
+      tangentS_(0.0),
+      constraintS_(0.0),
+      weightW_(0.0)
    {  setClassName("Sweep"); }
 
    Sweep::~Sweep()
@@ -55,35 +77,49 @@ namespace Fd1d
    {
       read<int>(in, "ns", ns_);
       read<std::string>(in, "baseFileName", baseFileName_);
+      UTIL_CHECK(ns_ > 0);
       homogeneousMode_ = -1; // default value
       readOptional<int>(in, "homogeneousMode", homogeneousMode_);
+
+      historyCapacity_ = 3; // default value (quadratic extrapolation)
+      readOptional<int>(in, "historyCapacity", historyCapacity_);
+      UTIL_CHECK(historyCapacity_ > 0);
+
+      nItrTarget_ = 0; // default value (fixed step size)
+      readOptional<int>(in, "nItrTarget", nItrTarget_);
+      UTIL_CHECK(nItrTarget_ >= 0);
+
+      double ds = 1.0/double(ns_);
+      dsMin_ = 0.2*ds; // default value 
+      readOptional<double>(in, "dsMin", dsMin_);
+      dsMax_ = (nItrTarget_ > 0) ? 4.0*ds : ds; // default value
+      if (dsMax_ > 1.0) dsMax_ = 1.0;
+      readOptional<double>(in, "dsMax", dsMax_);
+      UTIL_CHECK(dsMin_ > 0.0);
+      UTIL_CHECK(dsMax_ >= dsMin_);
+
+      useArclength_ = false; // default value
+      readOptional<bool>(in, "useArclength", useArclength_);
+
+      sHistory_.allocate(historyCapacity_);
+      wHistory_.allocate(historyCapacity_);
+      sValues_.allocate(historyCapacity_);
+      coeffs_.allocate(historyCapacity_);
    }
 
    void Sweep::solve()
    {
+      UTIL_CHECK(mixture().nMonomer() > 0);
+      UTIL_CHECK(domain().nx() > 0);
+      UTIL_CHECK(sHistory_.capacity() > 0);
 
-      int nm = mixture().nMonomer();
-      int nx = domain().nx();
-      UTIL_CHECK(nm > 0);
-      UTIL_CHECK(nx > 0);
-
-      // Allocate memory for solutions
-      if (!wFields0_.isAllocated()) {
-         wFields0_.allocate(nm);
-         for (int i = 0; i < nm; ++i) {
-            wFields0_[i].allocate(nx);
-         }
-      }
-      if (!wFields1_.isAllocated()) {
-         wFields1_.allocate(nm);
-         for (int i = 0; i < nm; ++i) {
-            wFields1_[i].allocate(nx);
-         }
-      }
+      // Discard any states from a previous sweep
+      sHistory_.clear();
+      wHistory_.clear();
 
       // Compute and output ds
       double ds = 1.0/double(ns_);
-      double ds0 = ds;
+      if (ds > dsMax_) ds = dsMax_;
       std::cout << std::endl;
       std::cout << "ns = " << ns_ << std::endl;
       std::cout << "ds = " << ds  << std::endl;
@@ -108,7 +144,7 @@ namespace Fd1d
       if (error) {
          UTIL_THROW("Failure to converge initial state of sweep");
       } else {
-         assignFields(wFields0_, wFields());
+         saveState(s);
          if (homogeneousMode_ >= 0) {
             comparison_.compute(homogeneousMode_);
          }
@@ -118,78 +154,427 @@ namespace Fd1d
          outputSummary(outFile, i, s);
       }
 
-      // Loop over states on path
-      bool finished = false;   // Are we finished with the loop?
-      int  nPrev = 0;          // Number of previous solutions stored
-      double s1 = 0.0;         // Value of s at previous solution (if any)
-      while (!finished) {
-         error = 1;
-         while (error) {
-
-            std::cout << std::endl;
-            std::cout << "Attempt s = " << s + ds << std::endl;
-
-            // Setup guess for fields
-            if (nPrev == 0) {
-               std::cout << "Zeroth order continuation" << std::endl;
-            } else {
-               // std::cout << "1st order continuation" << std::endl;
-               double f1 = ds/(s - s1);
-               double f0 = 1.0 + f1;
-               // std::cout << " ds = " << ds << std::endl;
-               // std::cout << "  s = " << s  << ", s1 = " << s1 << std::endl;
-               // std::cout << " f1 = " << f1 << ", f0 = " << f0 << std::endl;
-               int i, j;
-               for (i = 0; i < nm; ++i) {
-                  for (j = 0; j < nx; ++j) {
-                     wFields()[i][j] = f0*wFields0_[i][j] - f1*wFields1_[i][j];
+      if (useArclength_) {
+         solveArclength(outFile, ds);
+      } else {
+
+         // Loop over states on path
+         int nItr;
+         while (s < 1.0 - 1.0E-8) {
+
+            // Do not step past the end of the path
+            if (s + ds > 1.0) {
+               ds = 1.0 - s;
+            }
+
+            error = 1;
+            while (error) {
+
+               std::cout << std::endl;
+               std::cout << "Attempt s = " << s + ds << std::endl;
+
+               // Set parameters and initial guess for the new state
+               setState(s + ds);
+               setGuess(s + ds, sHistory_.size());
+
+               // Attempt solution
+               isContinuation = true;
+               error = system().iterator().solve(isContinuation);
+
+               if (error) {
+
+                  // Upon failure, decrease ds by half
+                  ds *= 0.50;
+                  if (ds < dsMin_) {
+                     // Restore the last converged state before throwing
+                     setState(s);
+                     setGuess(s, 1);
+                     UTIL_THROW("Step size too small in sweep");
+                  }
+
+               } else {
+
+                  // Upon success, save new state
+                  s += ds;
+                  ++i;
+                  saveState(s);
+
+                  // Compare to homogeneous reference system
+                  if (homogeneousMode_ >= 0) {
+                     comparison_.compute(homogeneousMode_);
+                  }
+
+                  // Output
+                  fileName = baseFileName_;
+                  fileName += toString(i);
+                  outputSolution(fileName, s);
+                  outputSummary(outFile, i, s);
+
+                  // Adjust step size to the target number of iterations
+                  if (nItrTarget_ > 0) {
+                     nItr = system().iterator().nIteration();
+                     ds = adjustStepSize(ds, nItr, nItrTarget_, 
+                                         dsMin_, dsMax_);
                   }
+
                }
             }
+         }
+      }
+      outFile.close();
+   }
 
-            // Attempt solution
-            setState(s+ds);
-            isContinuation = true;
-            error = system().iterator().solve(isContinuation);
+   /*
+   * Store the current converged state.
+   */
+   void Sweep::saveState(double s)
+   {
+      sHistory_.append(s);
+      wHistory_.append(wFields());
+   }
 
-            if (error) {
+   /*
+   * Set w fields by extrapolation from previous states.
+   */
+   void Sweep::setGuess(double s, int nPoint)
+   {
+      UTIL_CHECK(nPoint > 0);
+      UTIL_CHECK(nPoint <= sHistory_.size());
 
-               // Upon failure, reset to fields from last converged solution
-               assignFields(wFields(), wFields0_);
+      int k;
+      for (k = 0; k < nPoint; ++k) {
+         sValues_[k] = sHistory_[k];
+      }
+      lagrangeCoefficients(sValues_, nPoint, s, coeffs_);
+      if (nPoint > 1) {
+         std::cout << "Extrapolation order " << nPoint - 1 << std::endl;
+      }
 
-               // Decrease ds by half
-               ds *= 0.50;
-               if (ds < 0.2*ds0) {
-                  UTIL_THROW("Step size too small in sweep");
-               }
+      int nm = mixture().nMonomer();
+      int nx = domain().nx();
+      int i, j;
+      double w;
+      for (i = 0; i < nm; ++i) {
+         for (j = 0; j < nx; ++j) {
+            w = 0.0;
+            for (k = 0; k < nPoint; ++k) {
+               w += coeffs_[k]*wHistory_[k][i][j];
+            }
+            wFields()[i][j] = w;
+         }
+      }
+   }
+
+   /*
+   * Solve states after the first by pseudo-arclength continuation.
+   */
+   void Sweep::solveArclength(std::ofstream& outFile, double ds)
+   {
+      nrIteratorPtr_ = dynamic_cast<NrIterator*>(&system().iterator());
+      if (!nrIteratorPtr_) {
+         UTIL_THROW("Arclength continuation requires an NrIterator");
+      }
+      NrIterator& iterator = *nrIteratorPtr_;
+
+      int nm = mixture().nMonomer();
+      int nx = domain().nx();
+      int nr = nm*nx;
+      int i, j, k;
+
+      // Allocate memory, if needed
+      if (!residual_.isAllocated()) {
+         residual_.allocate(nr);
+         dResidualDs_.allocate(nr);
+         residualWork_.allocate(nr);
+         dW_.allocate(nr);
+         tangentW_.allocate(nr);
+         constraintW_.allocate(nr);
+         wOld_.allocate(nm);
+         cWork_.allocate(nm);
+         for (i = 0; i < nm; ++i) {
+            wOld_[i].allocate(nx);
+            cWork_[i].allocate(nx);
+         }
+      }
+      UTIL_CHECK(residual_.capacity() == nr);
+
+      // Compute the initial tangent, (dw/ds, 1) with J dw/ds = -dR/ds
+      double s = sHistory_[0];
+      double g;
+      for (k = 0; k < nr; ++k) {
+         constraintW_[k] = 0.0;
+         residualWork_[k] = 0.0;
+      }
+      constraintS_ = 0.0;
+      computeArclengthResidual(s, 0.0, g);
+      if (!iterator.hasJacobian()) {
+         std::cout << "Computing jacobian" << std::endl;
+         iterator.computeJacobian(residual_);
+      }
+      computeDerivativeDs(s);
+      iterator.solveBordered(dResidualDs_, constraintW_, 1.0, 
+                             residualWork_, 1.0, tangentW_, tangentS_);
+
+      // Weight w field components so that they contribute as much as s
+      // to the norm of the initial tangent
+      double norm = 0.0;
+      for (k = 0; k < nr; ++k) {
+         norm += tangentW_[k]*tangentW_[k];
+      }
+      if (norm > 0.0) {
+         weightW_ = 1.0/norm;
+      } else {
+         weightW_ = 1.0/double(nr);
+      }
+      normalizeTangent();
 
-            } else {
+      // Loop over states on path
+      double dSigma = ds;
+      double dSigmaStep, factor, s0;
+      std::string fileName;
+      int iState = 0;
+      int error, nItr;
+      bool isFinal;
+      bool finished = false;
+      while (!finished) {
 
-               // Upon success, save new field
-               s1 = s;
-               nPrev = 1;
-               assignFields(wFields1_, wFields0_);
-               assignFields(wFields0_, wFields());
+         // Last converged state
+         s0 = sHistory_[0];
+         DArray<System::WField> const & w0 = wHistory_[0];
+
+         // Set the step constraint. If a step of length dSigma along 
+         // the tangent would pass s = 1, instead require s = 1.
+         isFinal = (tangentS_ > 0.0 && s0 + dSigma*tangentS_ >= 1.0);
+         if (isFinal) {
+            factor = (1.0 - s0)/tangentS_;
+            dSigmaStep = 1.0 - s0;
+            for (k = 0; k < nr; ++k) {
+               constraintW_[k] = 0.0;
+            }
+            constraintS_ = 1.0;
+         } else {
+            factor = dSigma;
+            dSigmaStep = dSigma;
+            for (k = 0; k < nr; ++k) {
+               constraintW_[k] = weightW_*tangentW_[k];
+            }
+            constraintS_ = tangentS_;
+         }
 
-               // Compare to homogeneous reference system
-               if (homogeneousMode_ >= 0) {
-                  comparison_.compute(homogeneousMode_);
+         // Predictor: step along the tangent
+         s = s0 + factor*tangentS_;
+         k = 0;
+         for (i = 0; i < nm; ++i) {
+            for (j = 0; j < nx; ++j) {
+               wFields()[i][j] = w0[i][j] + factor*tangentW_[k];
+               ++k;
+            }
+         }
+         std::cout << std::endl;
+         std::cout << "Attempt s = " << s << std::endl;
+
+         // Corrector
+         error = correctArclength(s, dSigmaStep, nItr);
+
+         if (error) {
+
+            // Upon failure, decrease step length by half
+            dSigma *= 0.50;
+            if (dSigma < dsMin_) {
+               setState(s0);
+               setGuess(s0, 1);
+               UTIL_THROW("Step size too small in sweep");
+            }
+
+         } else {
+
+            // Secant approximation of the tangent at the new state
+            k = 0;
+            for (i = 0; i < nm; ++i) {
+               for (j = 0; j < nx; ++j) {
+                  tangentW_[k] = wFields()[i][j] - w0[i][j];
+                  ++k;
                }
+            }
+            tangentS_ = s - s0;
+            normalizeTangent();
+
+            // Save new state
+            ++iState;
+            saveState(s);
+
+            // Compare to homogeneous reference system
+            if (homogeneousMode_ >= 0) {
+               comparison_.compute(homogeneousMode_);
+            }
+
+            // Output
+            fileName = baseFileName_;
+            fileName += toString(iState);
+            outputSolution(fileName, s);
+            outputSummary(outFile, iState, s);
+
+            if (isFinal) {
+               finished = true;
+            } else if (s < 0.0) {
+               std::cout << "Path returned to s < 0" << std::endl;
+               finished = true;
+            } else if (nItrTarget_ > 0) {
+               // Adjust step length to the target number of iterations
+               dSigma = adjustStepSize(dSigma, nItr, nItrTarget_, 
+                                       dsMin_, dsMax_);
+            }
+
+         }
+      }
+   }
+
+   /*
+   * Newton iteration for the SCF equations and the step constraint.
+   */
+   int Sweep::correctArclength(double& s, double dSigma, int& nItr)
+   {
+      NrIterator& iterator = *nrIteratorPtr_;
+      int nm = mixture().nMonomer();
+      int nx = domain().nx();
+      bool needsJacobian = !iterator.hasJacobian();
+      bool newJacobian = false;
+      double g, y, norm, normNew, sOld;
+      int i, j, itr;
+
+      norm = computeArclengthResidual(s, dSigma, g);
+      for (itr = 0; itr < 100; ++itr) {
+         std::cout << "iteration " << itr
+                   << " , error = " << norm
+                   << std::endl;
+
+         if (norm < iterator.epsilon()) {
+            std::cout << "Converged" << std::endl;
+            system().computeFreeEnergy();
+            nItr = itr;
+            return 0;
+         }
+
+         if (needsJacobian) {
+            std::cout << "Computing jacobian" << std::endl;
+            iterator.computeJacobian(residual_);
+            newJacobian = true;
+            needsJacobian = false;
+         }
 
-               // Update s and output
-               s += ds;
-               ++i;
-               fileName = baseFileName_;
-               fileName += toString(i);
-               outputSolution(fileName, s);
-               outputSummary(outFile, i, s);
+         // Newton increment, by bordering the Jacobian with dR/ds 
+         // and the step constraint
+         computeDerivativeDs(s);
+         iterator.solveBordered(dResidualDs_, constraintW_, constraintS_,
+                                residual_, g, dW_, y);
 
+         // Update w fields and s
+         for (i = 0; i < nm; ++i) {
+            for (j = 0; j < nx; ++j) {
+               wOld_[i][j] = wFields()[i][j];
             }
          }
-         if (s + ds > 1.0000001) {
-            finished = true;
+         sOld = s;
+         iterator.incrementWFields(wOld_, dW_, wFields());
+         s -= y;
+         normNew = computeArclengthResidual(s, dSigma, g);
+
+         // Accept or reject update
+         if (normNew < norm) {
+            newJacobian = false;
+            if (normNew/norm > 0.5) {
+               needsJacobian = true;
+            }
+            norm = normNew;
+         } else {
+            std::cout << "Iteration failed, norm = " 
+                      << normNew << std::endl;
+            for (i = 0; i < nm; ++i) {
+               for (j = 0; j < nx; ++j) {
+                  wFields()[i][j] = wOld_[i][j];
+               }
+            }
+            s = sOld;
+            if (newJacobian) {
+               nItr = itr + 1;
+               return 1;
+            } 
+            std::cout << "Try rebuilding Jacobian" << std::endl;
+            needsJacobian = true;
+            norm = computeArclengthResidual(s, dSigma, g);
+         }
+      }
+
+      // Failure
+      nItr = itr;
+      return 1;
+   }
+
+   /*
+   * Compute SCF residual and step constraint residual.
+   */
+   double Sweep::computeArclengthResidual(double s, double dSigma, 
+                                          double& g)
+   {
+      NrIterator& iterator = *nrIteratorPtr_;
+      setState(s);
+      mixture().compute(wFields(), cFields());
+      iterator.computeResidual(wFields(), cFields(), residual_);
+      double norm = iterator.residualNorm(residual_);
+
+      // Step constraint, relative to the last converged state
+      int nm = mixture().nMonomer();
+      int nx = domain().nx();
+      DArray<System::WField> const & w0 = wHistory_[0];
+      g = constraintS_*(s - sHistory_[0]) - dSigma;
+      int i, j;
+      int k = 0;
+      for (i = 0; i < nm; ++i) {
+         for (j = 0; j < nx; ++j) {
+            g += constraintW_[k]*(wFields()[i][j] - w0[i][j]);
+            ++k;
          }
       }
+      if (fabs(g) > norm) {
+         norm = fabs(g);
+      }
+      return norm;
+   }
+
+   /*
+   * Compute derivative of residual with respect to s.
+   */
+   void Sweep::computeDerivativeDs(double s)
+   {
+      NrIterator& iterator = *nrIteratorPtr_;
+      double delta = 0.001;
+      setState(s + delta);
+      mixture().compute(wFields(), cWork_);
+      iterator.computeResidual(wFields(), cWork_, residualWork_);
+      int nr = residual_.capacity();
+      for (int k = 0; k < nr; ++k) {
+         dResidualDs_[k] = (residualWork_[k] - residual_[k])/delta;
+      }
+      setState(s);
+   }
+
+   /*
+   * Normalize the tangent vector.
+   */
+   void Sweep::normalizeTangent()
+   {
+      int nr = tangentW_.capacity();
+      double norm = tangentS_*tangentS_;
+      int k;
+      for (k = 0; k < nr; ++k) {
+         norm += weightW_*tangentW_[k]*tangentW_[k];
+      }
+      norm = sqrt(norm);
+      UTIL_CHECK(norm > 0.0);
+      for (k = 0; k < nr; ++k) {
+         tangentW_[k] /= norm;
+      }
+      tangentS_ /= norm;
    }
 
    void Sweep::outputSolution(std::string const & fileName, double s)
@@ -245,26 +630,5 @@ namespace Fd1d
       }
    }
 
-   void Sweep::assignFields(DArray<System::Field>& lhs,
-                            DArray<System::Field> const & rhs) const
-   {
-
-      int nm = mixture().nMonomer();
-      int nx = domain().nx();
-
-      UTIL_CHECK(lhs.capacity() == nm);
-      UTIL_CHECK(rhs.capacity() == nm);
-      int i, j;
-      for (i = 0; i < nm; ++i) {
-         UTIL_CHECK(rhs[i].isAllocated());
-         UTIL_CHECK(rhs[i].capacity() == nx);
-         UTIL_CHECK(lhs[i].isAllocated());
-         UTIL_CHECK(lhs[i].capacity() == nx);
-         for (j = 0; j < nx; ++j) {
-            lhs[i][j] = rhs[i][j];
-         }
-      }
-   }
-
 } // namespace Fd1d
 } // namespace Pscf
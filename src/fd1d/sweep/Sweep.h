@@ -13,18 +13,44 @@
 #include <fd1d/misc/HomogeneousComparison.h>  // member
 #include <fd1d/misc/FieldIo.h>                // member
 #include <util/containers/DArray.h>           // member
+#include <util/containers/RingBuffer.h>       // member
 
 #include <util/global.h>
 
+#include <fstream>
+
 namespace Pscf {
 namespace Fd1d
 {
 
+   class NrIterator;
+
    using namespace Util;
 
    /**
    * Solve a sequence of problems along a line in parameter space.
    *
+   * A sweep solves the SCF equations for a sequence of states along a 
+   * path in parameter space parameterized by a variable s in [0,1], in 
+   * which s = 0 is the initial state of the system. Subclasses define 
+   * the path by implementing setState(s).
+   *
+   * The initial guess for each new state is obtained by polynomial 
+   * extrapolation of the w fields through up to historyCapacity 
+   * previous converged states. The step size is halved after a failure
+   * to converge. If nItrTarget > 0, the step size is also adjusted 
+   * after each converged state, by a factor nItrTarget/nItr (limited 
+   * to [0.5, 2.0]) in which nItr is the number of iterations required 
+   * to converge that state.
+   *
+   * If useArclength is true, the sweep instead uses pseudo-arclength
+   * continuation, in which s is treated as an additional unknown and 
+   * each step is of fixed length along the tangent to the solution 
+   * path. This allows a sweep to follow the path around a turning point
+   * (fold), at which s reaches a maximum or minimum. The extra unknown
+   * is handled by bordering the Jacobian of the NrIterator, which must
+   * be the iterator in this case.
+   *
    * \ingroup Fd1d_Sweep_Module
    */
    class Sweep : public ParamComposite, public SystemAccess
@@ -58,7 +84,11 @@ namespace Fd1d
       void setSystem(System& system);
 
       /**
-      * Read ns and baseFileName parameters.
+      * Read parameters.
+      *
+      * Reads ns and baseFileName, and optional parameters 
+      * homogeneousMode, historyCapacity, nItrTarget, dsMin, dsMax and
+      * useArclength.
       *
       * \param in input stream
       */
@@ -117,14 +147,128 @@ namespace Fd1d
       /// FieldIo object for writing output files
       FieldIo fieldIo_;
 
-      /// Current solution 
-      DArray<System::WField> wFields0_;
+      /// Maximum number of previous states used for extrapolation.
+      int historyCapacity_;
+
+      /// Target number of iterations per state (0 -> fixed step).
+      int nItrTarget_;
+
+      /// Minimum step size. 
+      double dsMin_;
+
+      /// Maximum step size.
+      double dsMax_;
+
+      /// Values of s for previous converged states.
+      RingBuffer<double> sHistory_;
+
+      /// W fields of previous converged states.
+      RingBuffer< DArray<System::WField> > wHistory_;
+
+      /// Work array of s values, in the order of sHistory_.
+      DArray<double> sValues_;
+
+      /// Extrapolation coefficients.
+      DArray<double> coeffs_;
+
+      /// Use pseudo-arclength continuation ?
+      bool useArclength_;
+
+      /// Pointer to iterator, used for pseudo-arclength continuation.
+      NrIterator* nrIteratorPtr_;
+
+      /// Residual of the SCF equations at the current state.
+      DArray<double> residual_;
+
+      /// Derivative of the residual with respect to s.
+      DArray<double> dResidualDs_;
+
+      /// Residual at a perturbed value of s (work space).
+      DArray<double> residualWork_;
+
+      /// Newton increment of w fields (work space).
+      DArray<double> dW_;
+
+      /// W field components of the unit tangent to the path.
+      DArray<double> tangentW_;
+
+      /// Component of the unit tangent to the path along s.
+      double tangentS_;
+
+      /// Coefficients of w field components in the step constraint.
+      DArray<double> constraintW_;
+
+      /// Coefficient of s in the step constraint.
+      double constraintS_;
+
+      /// Weight of w field components in the norm of a tangent.
+      double weightW_;
+
+      /// W fields before a Newton step (work space).
+      DArray<System::WField> wOld_;
+
+      /// C fields at a perturbed value of s (work space).
+      DArray<System::CField> cWork_;
 
-      /// Previous solution (for 1st order continuation)
-      DArray<System::WField> wFields1_;
+      /**
+      * Store the current state, with path length coordinate s.
+      */
+      void saveState(double s);
+
+      /**
+      * Set w fields by extrapolation to s.
+      *
+      * \param s path length coordinate of new state
+      * \param nPoint number of stored states to use (<= size of history)
+      */
+      void setGuess(double s, int nPoint);
+
+      /**
+      * Solve all states after the first by pseudo-arclength continuation.
+      *
+      * \param outFile summary log file
+      * \param ds initial step size
+      */
+      void solveArclength(std::ofstream& outFile, double ds);
+
+      /**
+      * Iterate the SCF equations and the step constraint to solution.
+      *
+      * The constraint is constraintW_.(w - w0) + constraintS_*(s - s0) 
+      * = dSigma, in which w0 and s0 are the last converged state. On 
+      * entry, the system w fields and s must contain an initial guess.
+      *
+      * \param s value of s (input guess and output solution)
+      * \param dSigma step length
+      * \param nItr number of iterations (output)
+      * \return error code: 0 for success, 1 for failure.
+      */
+      int correctArclength(double& s, double dSigma, int& nItr);
 
-      void assignFields(DArray<System::WField>& lhs, 
-                        DArray<System::WField> const & rhs) const;
+      /**
+      * Compute residual_ at the current w fields and s.
+      *
+      * \param s value of s
+      * \param dSigma step length
+      * \param g residual of the step constraint (output)
+      * \return maximum error, including the step constraint
+      */
+      double computeArclengthResidual(double s, double dSigma, double& g);
+
+      /**
+      * Compute dResidualDs_ by finite differences, given residual_.
+      *
+      * \param s value of s
+      */
+      void computeDerivativeDs(double s);
+
+      /**
+      * Normalize tangentW_ and tangentS_ to a unit vector.
+      *
+      * The squares of w field components are weighted by weightW_ in
+      * the norm.
+      */
+      void normalizeTangent();
 
    };
 
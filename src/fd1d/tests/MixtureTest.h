@@ -5,9 +5,15 @@
 #include <test/UnitTestRunner.h>
 
 #include <fd1d/solvers/Mixture.h>
+#include <fd1d/domain/Domain.h>
+#include <util/math/Constants.h>
 
 #include <fstream>
 
+#ifdef PSCF_OPENMP
+#include <omp.h>
+#endif
+
 using namespace Util;
 using namespace Pscf;
 using namespace Pscf::Fd1d;
@@ -103,12 +109,153 @@ public:
       std::cout << "Volume fraction of block 1 = " << sum1 << "\n";
       
    }
+
+   /*
+   * Compare batched solution of an ABA triblock, in which pairs of 
+   * propagators are solved together, to separate solutions.
+   */
+   void testSolveBatch()
+   {
+      printMethod(TEST_FUNC);
+
+      std::ifstream in;
+      openInputFile("in/MixtureABA", in);
+
+      Mixture mix;
+      Domain domain;
+      mix.readParam(in);
+      domain.readParam(in);
+      mix.setDomain(domain);
+
+      int nMonomer = mix.nMonomer();
+      int nx = domain.nx();
+      DArray<Mixture::WField> wFields;
+      DArray<Mixture::CField> cFields;
+      wFields.allocate(nMonomer);
+      cFields.allocate(nMonomer);
+      for (int i = 0; i < nMonomer; ++i) {
+         wFields[i].allocate(nx);
+         cFields[i].allocate(nx);
+      }
+      double cs;
+      for (int i = 0; i < nx; ++i) {
+         cs = cos(Constants::Pi*double(i)/double(nx-1));
+         wFields[0][i] = 0.5 + cs;
+         wFields[1][i] = 0.5 - cs;
+      }
+      mix.compute(wFields, cFields);
+
+      // Re-solve each propagator separately from the same head
+      Polymer& polymer = mix.polymer(0);
+      DArray<double> head, q;
+      head.allocate(nx);
+      q.allocate(nx);
+      for (int j = 0; j < polymer.nPropagator(); ++j) {
+         Propagator& propagator = polymer.propagator(j);
+         int ns = propagator.block().ns();
+         for (int i = 0; i < nx; ++i) {
+            head[i] = propagator.head()[i];
+            q[i] = propagator.tail()[i];
+         }
+         propagator.solve(head);
+         TEST_ASSERT(propagator.block().ns() == ns);
+         for (int i = 0; i < nx; ++i) {
+            TEST_ASSERT(q[i] == propagator.tail()[i]);
+         }
+      }
+
+      // Partition function is independent of block
+      double Q = polymer.propagator(0, 0).computeQ();
+      TEST_ASSERT(eq(polymer.propagator(1, 0).computeQ(), Q));
+      TEST_ASSERT(eq(polymer.propagator(2, 1).computeQ(), Q));
+   }
+
+   /*
+   * Compare batched solution of an ABA triblock to a solution in which
+   * propagators of different blocks are solved by threads.
+   */
+   void testSolveThreaded()
+   {
+      printMethod(TEST_FUNC);
+
+      std::ifstream in;
+      Mixture mix, mixThreaded;
+      Domain domain;
+      openInputFile("in/MixtureABA", in);
+      mix.readParam(in);
+      domain.readParam(in);
+      in.close();
+      openInputFile("in/MixtureABA_threaded", in);
+      mixThreaded.readParam(in);
+      in.close();
+      mix.setDomain(domain);
+      mixThreaded.setDomain(domain);
+
+      TEST_ASSERT(!mix.threadPropagators());
+      TEST_ASSERT(!mix.polymer(0).useThreads());
+      TEST_ASSERT(mixThreaded.threadPropagators());
+      TEST_ASSERT(mixThreaded.polymer(0).useThreads());
+
+      int nMonomer = mix.nMonomer();
+      int nx = domain.nx();
+      DArray<Mixture::WField> wFields;
+      DArray<Mixture::CField> cFields;
+      DArray<Mixture::CField> cFieldsThreaded;
+      wFields.allocate(nMonomer);
+      cFields.allocate(nMonomer);
+      cFieldsThreaded.allocate(nMonomer);
+      for (int i = 0; i < nMonomer; ++i) {
+         wFields[i].allocate(nx);
+         cFields[i].allocate(nx);
+         cFieldsThreaded[i].allocate(nx);
+      }
+      double cs;
+      for (int i = 0; i < nx; ++i) {
+         cs = cos(Constants::Pi*double(i)/double(nx-1));
+         wFields[0][i] = 0.5 + cs;
+         wFields[1][i] = 0.5 - cs;
+      }
+      mix.compute(wFields, cFields);
+
+      // Use several threads, if available, for the threaded solution
+      #ifdef PSCF_OPENMP
+      int nThreadSave = omp_get_max_threads();
+      omp_set_num_threads(3);
+      #endif
+      mixThreaded.compute(wFields, cFieldsThreaded);
+      #ifdef PSCF_OPENMP
+      omp_set_num_threads(nThreadSave);
+      #endif
+
+      // Propagators are identical at all contour steps
+      Polymer& polymer = mix.polymer(0);
+      Polymer& polymerThreaded = mixThreaded.polymer(0);
+      for (int j = 0; j < polymer.nPropagator(); ++j) {
+         Propagator& p = polymer.propagator(j);
+         Propagator& pThreaded = polymerThreaded.propagator(j);
+         int ns = p.block().ns();
+         TEST_ASSERT(pThreaded.block().ns() == ns);
+         for (int k = 0; k < ns; ++k) {
+            for (int i = 0; i < nx; ++i) {
+               TEST_ASSERT(p.q(k)[i] == pThreaded.q(k)[i]);
+            }
+         }
+      }
+      for (int m = 0; m < nMonomer; ++m) {
+         for (int i = 0; i < nx; ++i) {
+            TEST_ASSERT(eq(cFields[m][i], cFieldsThreaded[m][i]));
+         }
+      }
+   }
+
 };
 
 TEST_BEGIN(MixtureTest)
 TEST_ADD(MixtureTest, testConstructor)
 TEST_ADD(MixtureTest, testReadParameters)
 TEST_ADD(MixtureTest, testSolve)
+TEST_ADD(MixtureTest, testSolveBatch)
+TEST_ADD(MixtureTest, testSolveThreaded)
 TEST_END(MixtureTest)
 
 #endif
@@ -8,9 +8,16 @@
 #include <fd1d/domain/Domain.h>
 #include <fd1d/solvers/Mixture.h>
 #include <fd1d/iterator/Iterator.h>
+#include <fd1d/iterator/NrIterator.h>
+#include <fd1d/iterator/NkIterator.h>
+#include <fd1d/iterator/AmIterator.h>
 #include <fd1d/misc/FieldIo.h>
+#include <fd1d/sweep/Sweep.h>
+
+#include <util/math/Constants.h>
 
 #include <fstream>
+#include <vector>
 
 using namespace Util;
 using namespace Pscf;
@@ -184,6 +191,142 @@ public:
 
    }
 
+   /*
+   * Solve the planar problem of testIteratorPlanar from the same guess.
+   */
+   void solvePlanar(const char* paramFileName, System& sys)
+   {
+      std::ifstream in;
+      openInputFile(paramFileName, in);
+      sys.readParam(in);
+      in.close();
+
+      int nx = sys.domain().nx();
+      double cs;
+      double chi = 20.0;
+      for (int i = 0; i < nx; ++i) {
+         cs = cos(Constants::Pi*double(i)/double(nx-1));
+         sys.wField(0)[i] = chi*(-0.5*cs + 0.25*cs*cs);
+         sys.wField(1)[i] = chi*(+0.5*cs + 0.25*cs*cs);
+      }
+      sys.mixture().compute(sys.wFields(), sys.cFields());
+
+      TEST_ASSERT(sys.iterator().solve() == 0);
+   }
+
+   void testIteratorPlanarBroyden()
+   {
+      printMethod(TEST_FUNC);
+
+      System newton;
+      solvePlanar("in/planar2.prm", newton);
+      NrIterator& newtonItr = dynamic_cast<NrIterator&>(newton.iterator());
+
+      System broyden;
+      solvePlanar("in/planar3.prm", broyden);
+      NrIterator& broydenItr = dynamic_cast<NrIterator&>(broyden.iterator());
+
+      // Broyden updates replace most Jacobian calculations
+      TEST_ASSERT(newtonItr.nBroydenUpdate() == 0);
+      TEST_ASSERT(broydenItr.nBroydenUpdate() > 0);
+      TEST_ASSERT(broydenItr.nJacobian() > 0);
+      TEST_ASSERT(broydenItr.nJacobian() <= newtonItr.nJacobian());
+
+      // Both converge to the same solution
+      int nx = newton.domain().nx();
+      for (int j = 0; j < newton.mixture().nMonomer(); ++j) {
+         for (int i = 0; i < nx; ++i) {
+            TEST_ASSERT(std::abs(newton.wField(j)[i] - broyden.wField(j)[i])
+                        < 1.0E-5);
+         }
+      }
+   }
+
+   void testIteratorPlanarNk()
+   {
+      printMethod(TEST_FUNC);
+
+      System newton;
+      solvePlanar("in/planar2.prm", newton);
+
+      System krylov;
+      solvePlanar("in/planar4.prm", krylov);
+      NkIterator& iterator = dynamic_cast<NkIterator&>(krylov.iterator());
+      TEST_ASSERT(iterator.nIteration() > 0);
+      TEST_ASSERT(iterator.nKrylov() > 0);
+
+      // Both converge to the same solution. Fields are compared via
+      // concentrations and differences of w fields, because the result
+      // is only weakly sensitive to w fields near the last grid point,
+      // at which the canonical ensemble constraint is imposed.
+      int nx = newton.domain().nx();
+      double dw;
+      for (int i = 0; i < nx; ++i) {
+         for (int j = 0; j < newton.mixture().nMonomer(); ++j) {
+            TEST_ASSERT(std::abs(newton.cField(j)[i] - krylov.cField(j)[i])
+                        < 1.0E-5);
+         }
+         dw = newton.wField(1)[i] - newton.wField(0)[i]
+            - krylov.wField(1)[i] + krylov.wField(0)[i];
+         TEST_ASSERT(std::abs(dw) < 1.0E-4);
+      }
+   }
+
+   void testIteratorPlanarAm()
+   {
+      printMethod(TEST_FUNC);
+
+      System newton;
+      solvePlanar("in/planar2.prm", newton);
+
+      System anderson;
+      solvePlanar("in/planar6.prm", anderson);
+      AmIterator& iterator = dynamic_cast<AmIterator&>(anderson.iterator());
+      TEST_ASSERT(iterator.nIteration() > 0);
+      TEST_ASSERT(iterator.nIteration() < iterator.maxItr());
+
+      // Compare concentrations and differences of w fields
+      int nx = newton.domain().nx();
+      double dw;
+      for (int i = 0; i < nx; ++i) {
+         for (int j = 0; j < newton.mixture().nMonomer(); ++j) {
+            TEST_ASSERT(std::abs(newton.cField(j)[i] - anderson.cField(j)[i])
+                        < 1.0E-5);
+         }
+         dw = newton.wField(1)[i] - newton.wField(0)[i]
+            - anderson.wField(1)[i] + anderson.wField(0)[i];
+         TEST_ASSERT(std::abs(dw) < 1.0E-4);
+      }
+      TEST_ASSERT(std::abs(newton.fHelmholtz() - anderson.fHelmholtz())
+                  < 1.0E-6);
+   }
+
+   void testIteratorPlanarThreads()
+   {
+      printMethod(TEST_FUNC);
+
+      #ifdef PSCF_OPENMP
+      System serial;
+      solvePlanar("in/planar2.prm", serial);
+      NrIterator& serialItr = dynamic_cast<NrIterator&>(serial.iterator());
+
+      System threaded;
+      solvePlanar("in/planar5.prm", threaded);
+      NrIterator& threadedItr 
+                         = dynamic_cast<NrIterator&>(threaded.iterator());
+      TEST_ASSERT(threadedItr.nThread() == 3);
+
+      // Threaded and serial Jacobians are identical
+      TEST_ASSERT(threadedItr.nJacobian() == serialItr.nJacobian());
+      int nx = serial.domain().nx();
+      for (int j = 0; j < serial.mixture().nMonomer(); ++j) {
+         for (int i = 0; i < nx; ++i) {
+            TEST_ASSERT(eq(serial.wField(j)[i], threaded.wField(j)[i]));
+         }
+      }
+      #endif
+   }
+
    void testIteratorSpherical()
    {
       printMethod(TEST_FUNC);
@@ -344,6 +487,96 @@ public:
       sys.readCommands(in);
       in.close();
    }
+
+   void testReadCommandsSphericalSweepAdaptive()
+   {
+      printMethod(TEST_FUNC);
+
+      System sys;
+      std::ifstream in;
+      std::cout << "\n";
+
+      openInputFile("in/spherical4.prm", in);
+      sys.readParam(in);
+      in.close();
+
+      // Set System filemaster prefixes to unit test file prefix
+      sys.fileMaster().setInputPrefix(filePrefix());
+      sys.fileMaster().setOutputPrefix(filePrefix());
+
+      openInputFile("in/spherical4.cmd", in);
+      sys.readCommands(in);
+      in.close();
+
+      // Read values of s from the first column of the log
+      openInputFile("out/sphericallog", in);
+      std::string line;
+      std::vector<double> sValues;
+      double s;
+      while (in >> s) {
+         sValues.push_back(s);
+         std::getline(in, line);
+      }
+      in.close();
+
+      // The sweep takes 8 steps of varying size, and ends at s = 1
+      int nState = sValues.size();
+      TEST_ASSERT(nState == 9);
+      TEST_ASSERT(eq(sValues[0], 0.0));
+      TEST_ASSERT(eq(sValues[nState-1], 1.0));
+      TEST_ASSERT(eq(sValues[1], 0.25));
+      double ds, dsPrev;
+      double dsMin = sValues[1];
+      bool hasIncrease = false;
+      for (int i = 2; i < nState; ++i) {
+         ds = sValues[i] - sValues[i-1];
+         dsPrev = sValues[i-1] - sValues[i-2];
+         TEST_ASSERT(ds > 0.0);
+         TEST_ASSERT(ds <= 2.0*dsPrev + 1.0E-10);
+         TEST_ASSERT(ds >= 0.5*dsPrev - 1.0E-10 || i == nState - 1);
+         if (ds < dsMin) dsMin = ds;
+         if (ds > dsPrev + 1.0E-10) hasIncrease = true;
+      }
+      TEST_ASSERT(dsMin < 0.125);
+      TEST_ASSERT(hasIncrease);
+   }
+
+   void testSweepArclength()
+   {
+      printMethod(TEST_FUNC);
+
+      System sys;
+      std::ifstream in;
+      std::cout << "\n";
+
+      // Composition sweep through a turning point near s = 0.87, at 
+      // which natural parameter continuation fails
+      openInputFile("in/spherical5.prm", in);
+      sys.readParam(in);
+      in.close();
+
+      sys.fileMaster().setInputPrefix(filePrefix());
+      sys.fileMaster().setOutputPrefix(filePrefix());
+
+      openInputFile("in/spherical5.cmd", in);
+      sys.readCommands(in);
+      in.close();
+
+      // Check that s passed a maximum and then returned below 0. 
+      // The first column of the CompositionSweep log is s.
+      openInputFile("out/arclengthlog", in);
+      std::string line;
+      double s = 0.0;
+      double sMax = 0.0;
+      while (in >> s) {
+         if (s > sMax) sMax = s;
+         std::getline(in, line);
+      }
+      in.close();
+      TEST_ASSERT(sMax > 0.8);
+      TEST_ASSERT(sMax < 1.0);
+      TEST_ASSERT(s < 0.0);
+   }
 };
 
 TEST_BEGIN(SystemTest)
@@ -353,10 +586,16 @@ TEST_ADD(SystemTest, testSolveMdePlanar)
 TEST_ADD(SystemTest, testSolveMdeSpherical)
 TEST_ADD(SystemTest, testIteratorPlanar)
 TEST_ADD(SystemTest, testIteratorSpherical)
+TEST_ADD(SystemTest, testIteratorPlanarBroyden)
+TEST_ADD(SystemTest, testIteratorPlanarNk)
+TEST_ADD(SystemTest, testIteratorPlanarAm)
+TEST_ADD(SystemTest, testIteratorPlanarThreads)
 TEST_ADD(SystemTest, testFieldInput)
 TEST_ADD(SystemTest, testReadCommandsPlanar)
 TEST_ADD(SystemTest, testReadCommandsSpherical)
 TEST_ADD(SystemTest, testReadCommandsSphericalSweep)
+TEST_ADD(SystemTest, testReadCommandsSphericalSweepAdaptive)
+TEST_ADD(SystemTest, testSweepArclength)
 TEST_END(SystemTest)
 
 #endif
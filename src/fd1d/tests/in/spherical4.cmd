@@ -0,0 +1,3 @@
+READ_W     in/spherical2.w
+SWEEP
+FINISH
@@ -0,0 +1,3 @@
+READ_W     in/spherical5.w
+SWEEP
+FINISH
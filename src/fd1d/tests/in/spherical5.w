@@ -0,0 +1,103 @@
+nx     101
+nm     2
+    0    9.117045384990e-02    7.970336550340e+01
+    1    2.728453158290e-01    7.986651779960e+01
+    2    8.107607701530e-01    8.034404242300e+01
+    3    1.683148766160e+00    8.110302021830e+01
+    4    2.838354940440e+00    8.207109836710e+01
+    5    4.210988001470e+00    8.314390056780e+01
+    6    5.714065797600e+00    8.415977475370e+01
+    7    7.209970200650e+00    8.482880263790e+01
+    8    8.431702397660e+00    8.455025376010e+01
+    9    8.804232776490e+00    8.197913552390e+01
+   10    7.194035971150e+00    7.421086232780e+01
+   11    2.438227024240e+00    5.648173090680e+01
+   12   -2.170219756290e+00    2.740784718400e+01
+   13    6.134613073300e+00    9.336405214570e-01
+   14    3.060691318110e+01   -7.221963437720e+00
+   15    5.411457617560e+01   -4.557998646500e+00
+   16    6.784524232760e+01   -1.510351840100e+00
+   17    7.442337608570e+01   -6.726422855870e-02
+   18    7.745053519990e+01    4.415260148110e-01
+   19    7.887625846770e+01    5.736578548610e-01
+   20    7.956948222280e+01    5.730901996980e-01
+   21    7.991025252920e+01    5.300608481470e-01
+   22    8.007262467690e+01    4.760676183190e-01
+   23    8.014152268810e+01    4.218518333720e-01
+   24    8.016079019090e+01    3.709683440170e-01
+   25    8.015400445370e+01    3.244705501770e-01
+   26    8.013416190460e+01    2.825263534350e-01
+   27    8.010850466560e+01    2.449846983830e-01
+   28    8.008105975570e+01    2.115794480750e-01
+   29    8.005402719930e+01    1.820052182330e-01
+   30    8.002855869830e+01    1.559468965860e-01
+   31    8.000520214480e+01    1.330920741230e-01
+   32    7.998415860040e+01    1.131370887040e-01
+   33    7.996543235480e+01    9.579062156370e-02
+   34    7.994891929110e+01    8.077624772380e-02
+   35    7.993445927380e+01    6.783438182440e-02
+   36    7.992186732270e+01    5.672371752690e-02
+   37    7.991095211970e+01    4.722216055550e-02
+   38    7.990152684570e+01    3.912725190540e-02
+   39    7.989341530330e+01    3.225610457830e-02
+   40    7.988645510500e+01    2.644490704650e-02
+   41    7.988049902100e+01    2.154806872150e-02
+   42    7.987541517210e+01    1.743709403260e-02
+   43    7.987108651510e+01    1.399927312120e-02
+   44    7.986740991050e+01    1.113627075130e-02
+   45    7.986429497120e+01    8.762683717030e-03
+   46    7.986166282070e+01    6.804623094750e-03
+   47    7.985944484950e+01    5.198363139880e-03
+   48    7.985758152330e+01    3.889085178130e-03
+   49    7.985602127670e+01    2.829732923170e-03
+   50    7.985471950790e+01    1.979986146830e-03
+   51    7.985363768160e+01    1.305352366340e-03
+   52    7.985274253620e+01    7.763710680960e-04
+   53    7.985200539140e+01    3.679218113420e-04
+   54    7.985140154570e+01    5.862575846730e-05
+   55    7.985090975370e+01   -1.696703523040e-04
+   56    7.985051177390e+01   -3.323386093240e-04
+   57    7.985019197730e+01   -4.423527476940e-04
+   58    7.984993700750e+01   -5.106184395930e-04
+   59    7.984973548460e+01   -5.462589285690e-04
+   60    7.984957774770e+01   -5.568627430600e-04
+   61    7.984945562890e+01   -5.486991436280e-04
+   62    7.984936225470e+01   -5.269060116700e-04
+   63    7.984929187200e+01   -4.956540352330e-04
+   64    7.984923969370e+01   -4.582903615540e-04
+   65    7.984920176360e+01   -4.174643705310e-04
+   66    7.984917483660e+01   -3.752376886620e-04
+   67    7.984915627300e+01   -3.331803083200e-04
+   68    7.984914394650e+01   -2.924543162710e-04
+   69    7.984913616250e+01   -2.538865926150e-04
+   70    7.984913158760e+01   -2.180316312890e-04
+   71    7.984912918790e+01   -1.852255373730e-04
+   72    7.984912817570e+01   -1.556321249750e-04
+   73    7.984912796400e+01   -1.292819906150e-04
+   74    7.984912812700e+01   -1.061053339320e-04
+   75    7.984912836740e+01   -8.595926673090e-05
+   76    7.984912848830e+01   -6.865026838680e-05
+   77    7.984912837010e+01   -5.395241350450e-05
+   78    7.984912795150e+01   -4.162192612090e-05
+   79    7.984912721360e+01   -3.140858865550e-05
+   80    7.984912616770e+01   -2.306448231060e-05
+   81    7.984912484530e+01   -1.635044855330e-05
+   82    7.984912328980e+01   -1.104070226360e-05
+   83    7.984912155150e+01   -6.925886176950e-06
+   84    7.984911968250e+01   -3.814885040950e-06
+   85    7.984911773360e+01   -1.535662475250e-06
+   86    7.984911575270e+01    6.467829095348e-08
+   87    7.984911378280e+01    1.120401963310e-06
+   88    7.984911186160e+01    1.748061721580e-06
+   89    7.984911002110e+01    2.047712488470e-06
+   90    7.984910828800e+01    2.104285513780e-06
+   91    7.984910668360e+01    1.989051958130e-06
+   92    7.984910522430e+01    1.761108954610e-06
+   93    7.984910392260e+01    1.468816128540e-06
+   94    7.984910278730e+01    1.151151845870e-06
+   95    7.984910182420e+01    8.389754624020e-07
+   96    7.984910103650e+01    5.561334989670e-07
+   97    7.984910042560e+01    3.204402997970e-07
+   98    7.984909999150e+01    1.444950425390e-07
+   99    7.984909973270e+01    3.634978484650e-08
+  100    7.984909964700e+01    0.000000000000e+00
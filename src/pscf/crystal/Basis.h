@@ -14,6 +14,9 @@
 #include <util/containers/DArray.h>
 #include <util/containers/GArray.h>
 
+#include <string>
+#include <vector>
+
 namespace Pscf { 
 
    using namespace Util;
@@ -160,6 +163,39 @@ namespace Pscf {
       void makeBasis(const Mesh<D>& mesh, const UnitCell<D>& unitCell, 
                      const SpaceGroup<D>& group);
 
+      /**
+      * Write basis to a binary cache file.
+      *
+      * The file begins with a header that records the space group name,
+      * mesh dimensions and unit cell used to construct the basis, which
+      * is followed by all waves and stars. 
+      *
+      * \param filename  name of cache file
+      * \param groupName  name of space group used to construct basis
+      */
+      void writeCache(std::string const & filename, 
+                      std::string const & groupName) const;
+
+      /**
+      * Read basis from a binary cache file, if the file is valid.
+      *
+      * The file is accepted only if it was written for a basis with
+      * the same space group name and mesh dimensions, and a unit cell
+      * with the same lattice system and parameters. The unit cell is
+      * part of the key because the order of waves of nearly equal norm,
+      * and thus of stars, can depend on the unit cell parameters.
+      *
+      * \param filename  name of cache file
+      * \param mesh  spatial discretization grid
+      * \param unitCell  crystallographic unit cell
+      * \param groupName  name of space group
+      * \return true if basis was read, false otherwise
+      */
+      bool readCache(std::string const & filename, 
+                     Mesh<D> const & mesh, 
+                     UnitCell<D> const & unitCell,
+                     std::string const & groupName);
+
       /**
       * Update values after change in unit cell parameters.
       */
@@ -262,6 +298,28 @@ namespace Pscf {
       */
       void makeStars(const SpaceGroup<D>& group);
 
+      /**
+      * Identify stars within a shell of waves of equal norm.
+      *
+      * \param group  space group
+      * \param rankIds  wave indices, indexed by rank of DFT indices
+      * \param begin  index of first wave in shell
+      * \param end  index of last wave in shell, plus one
+      * \param stars  array of stars in this shell (output)
+      */
+      void makeShellStars(const SpaceGroup<D>& group, 
+                          DArray<int> const & rankIds,
+                          int begin, int end,
+                          std::vector<Star>& stars);
+
+      /**
+      * Write header that identifies the basis in a cache file.
+      */
+      void writeCacheKey(std::ostream& out, 
+                         Mesh<D> const & mesh, 
+                         UnitCell<D> const & unitCell,
+                         std::string const & groupName) const;
+
       /**
       * Access associated Mesh<D> as reference.
       */
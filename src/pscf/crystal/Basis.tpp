@@ -15,8 +15,10 @@
 #include <pscf/mesh/MeshIterator.h>
 #include <algorithm>
 #include <vector>
-#include <set>
 #include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <unistd.h>
 
 namespace Pscf {
 
@@ -48,35 +50,7 @@ namespace Pscf {
                             std::string groupName)
    {
       SpaceGroup<D> group;
-      if (groupName == "I") {
-         // Create identity group by default
-         group.makeCompleteGroup();
-      } else {
-         bool foundFile = false;
-         {
-            std::ifstream in;
-            in.open(groupName);
-            if (in.is_open()) {
-               in >> group;
-               UTIL_CHECK(group.isValid());
-               foundFile = true;
-            }
-         }
-         if (!foundFile) {
-            std::string fileName = makeGroupFileName(D, groupName);
-            std::ifstream in;
-            in.open(fileName);
-            if (in.is_open()) {
-               in >> group;
-               UTIL_CHECK(group.isValid());
-            } else {
-               Log::file() << "\nFailed to open group file: " 
-                           << fileName << "\n";
-               Log::file() << "\n Error: Unknown space group\n";
-               UTIL_THROW("Unknown space group");
-            }
-         } 
-      }
+      readGroup(groupName, group);
       makeBasis(mesh, unitCell, group);
    }
 
@@ -92,10 +66,14 @@ namespace Pscf {
       meshPtr_ = &mesh;
       unitCellPtr_ = &unitCell;
 
-      // Allocate arrays
+      // Allocate arrays, unless allocated by a failed readCache
       nWave_ = mesh.size();
-      waves_.allocate(nWave_);
-      waveIds_.allocate(nWave_); 
+      if (waves_.isAllocated()) {
+         UTIL_CHECK(waves_.capacity() == nWave_);
+      } else {
+         waves_.allocate(nWave_);
+         waveIds_.allocate(nWave_); 
+      }
 
       // Make sorted array of waves
       makeWaves();
@@ -123,19 +101,18 @@ namespace Pscf {
    void Basis<D>::makeWaves()
    {
       IntVec<D> meshDimensions = mesh().dimensions();
-      std::vector< TWave<D> > twaves;
-      twaves.reserve(nWave_);
+      std::vector< TWave<D> > twaves(nWave_);
 
-      // Loop over dft mesh to generate all waves, add to twaves
-      TWave<D> w;
-      IntVec<D> v;
-      MeshIterator<D> itr(mesh().dimensions());
-      for (itr.begin(); !itr.atEnd(); ++itr) {
-         w.indicesDft = itr.position();
-         v = shiftToMinimum(w.indicesDft, meshDimensions, *unitCellPtr_);
-         w.indicesBz = v;
-         w.sqNorm = unitCell().ksq(v);
-         twaves.push_back(w);
+      // Loop over dft mesh to generate all waves, indexed by rank
+      #ifdef PSCF_OPENMP
+      #pragma omp parallel for
+      #endif
+      for (int i = 0; i < nWave_; ++i) {
+         TWave<D>& w = twaves[i];
+         w.indicesDft = mesh().position(i);
+         w.indicesBz = shiftToMinimum(w.indicesDft, meshDimensions, 
+                                      *unitCellPtr_);
+         w.sqNorm = unitCell().ksq(w.indicesBz);
       }
 
       // Sort temporary array twaves
@@ -151,331 +128,110 @@ namespace Pscf {
 
    }
 
+   /*
+   * Identify stars of symmetry-related waves.
+   *
+   * Waves are first divided into shells of equal norm, i.e., sections
+   * of the norm-sorted waves_ array. Each shell is sorted by DFT indices
+   * and an array rankIds that maps the rank of each DFT wavevector in
+   * the mesh to its index in waves_ is constructed. This array is then
+   * used to look up the images of a root wave under each group
+   * operation in constant time. Shells are independent, and so are
+   * processed in parallel, after which the resulting stars are appended
+   * to stars_ in order of increasing norm.
+   */
    template <int D>
    void Basis<D>::makeStars(const SpaceGroup<D>& group)
    {
-      /* 
-      * Local containers that hold TWave<D> objects:
-      * list - set of waves of equal norm, compared by indicesDft
-      * star - set of symmetry-related waves, compared by indicesDft
-      * tempStar - temporary star, sorted by descending indicesBz
-      * tempList - temporary list, ordered by star
-      */
-      std::set< TWave<D>, TWaveDftComp<D> > list;  
-      std::set< TWave<D>, TWaveDftComp<D> > star;  
-      std::vector< TWave<D> > tempStar;  
-      GArray< TWave<D> > tempList;            
-
-      typename std::set< TWave<D>, TWaveDftComp<D> >::iterator rootItr;
-      typename std::set< TWave<D>, TWaveDftComp<D> >::iterator setItr;
-      TWave<D> wave;
-      Basis<D>::Star newStar;
-
-      std::complex<double> coeff;
-      double Gsq;
-      double Gsq_max;
-      double phase_diff;
-      const double twoPi = 2.0*Constants::Pi;
       const double epsilon = 1.0E-8;
       IntVec<D> meshDimensions = mesh().dimensions();
-      IntVec<D> rootVecBz;
       IntVec<D> vec;
       IntVec<D> nVec;
-      int listId = 0;      // id for this list
-      int listBegin = 0;   // id of first wave in this list
-      int listEnd = 0;     // (id of last wave in this list) + 1
-      int starId = 0;      // id for this star
-      int starBegin = 0;   // id of first wave in this star
-      int i, j, k;
-      bool cancel;
-
-      // Loop over all waves
-      nBasis_ = 0;
-      nBasisWave_ = 0;
-      Gsq_max = waves_[0].sqNorm;
-      for (i = 1; i <= nWave_; ++i) {
-
-         // Determine if this wave begins a new list
-         bool newList = false;
-         if (i == nWave_) {
-            listEnd = i;
-            newList = true;
-         } else {
-            Gsq = waves_[i].sqNorm;
-            if (Gsq > Gsq_max + epsilon) {
-               Gsq_max = Gsq;
-               listEnd = i;
-               newList = true;
-            }
+      int i, j;
+
+      // Identify boundaries of shells of waves of equal norm
+      std::vector<int> shellBegin;
+      double Gsq_max = waves_[0].sqNorm;
+      shellBegin.push_back(0);
+      for (i = 1; i < nWave_; ++i) {
+         if (waves_[i].sqNorm > Gsq_max + epsilon) {
+            Gsq_max = waves_[i].sqNorm;
+            shellBegin.push_back(i);
          }
+      }
+      shellBegin.push_back(nWave_);
+      int nShell = shellBegin.size() - 1;
+
+      // Sort each shell by DFT indices
+      #ifdef PSCF_OPENMP
+      #pragma omp parallel for schedule(dynamic)
+      #endif
+      for (int is = 0; is < nShell; ++is) {
+         int begin = shellBegin[is];
+         int end = shellBegin[is+1];
+         std::vector< TWave<D> > list(end - begin);
+         for (int k = begin; k < end; ++k) {
+            list[k - begin].sqNorm = waves_[k].sqNorm;
+            list[k - begin].indicesDft = waves_[k].indicesDft;
+            list[k - begin].indicesBz = waves_[k].indicesBz;
+         }
+         TWaveDftComp<D> comp;
+         std::sort(list.begin(), list.end(), comp);
+         for (int k = begin; k < end; ++k) {
+            waves_[k].sqNorm = list[k - begin].sqNorm;
+            waves_[k].indicesDft = list[k - begin].indicesDft;
+            waves_[k].indicesBz = list[k - begin].indicesBz;
+         }
+      }
 
-         // Process completed list of wavectors of equal norm
-         if (newList && listEnd > 0) {
+      // Look up table for waves, indexed by rank of DFT indices
+      DArray<int> rankIds;
+      rankIds.allocate(nWave_);
+      #ifdef PSCF_OPENMP
+      #pragma omp parallel for
+      #endif
+      for (int k = 0; k < nWave_; ++k) {
+         rankIds[mesh().rank(waves_[k].indicesDft)] = k;
+      }
 
-            // Copy waves of equal norm into std::set "list"
-            list.clear();
-            tempList.clear();
-            for (j = listBegin; j < listEnd; ++j) {
-               wave.indicesDft = waves_[j].indicesDft;
-               wave.indicesBz = waves_[j].indicesBz;
-               wave.sqNorm = waves_[j].sqNorm;
-               if (j > listBegin) {
-                  UTIL_CHECK( abs(wave.sqNorm-waves_[j].sqNorm) 
-                                 < 2.0*epsilon ); 
-               }
-               list.insert(wave);
+      // Identify stars within each shell
+      std::vector< std::vector<Star> > shellStars(nShell);
+      bool error = false;
+      #ifdef PSCF_OPENMP
+      #pragma omp parallel for schedule(dynamic)
+      #endif
+      for (int is = 0; is < nShell; ++is) {
+         try {
+            makeShellStars(group, rankIds, shellBegin[is], 
+                           shellBegin[is+1], shellStars[is]);
+         } catch (Exception& e) {
+            #ifdef PSCF_OPENMP
+            #pragma omp critical
+            #endif
+            {
+               e.write(std::cout);
+               error = true;
             }
+         }
+      }
+      if (error) {
+         UTIL_THROW("Failure constructing stars");
+      }
 
-            // On entry to each iteration of the loop over stars,
-            // rootItr and nextInvert are known. The iterator rootItr 
-            // points to the wave in the remaining list that will be 
-            // used as the root of the next star. The flag nextInvert 
-            // is equal to -1 iff the previous star was the first of
-            // a pair that are open under inversion, and is equal to +1 
-            // otherwise.
-
-            // Initial values for first star in this list
-            rootItr = list.begin();
-            int nextInvert = 1;
-
-            // Loop over stars with a list of waves of equal norm,
-            // removing each star from the list as it is identified.
-            // The root of the next star must have been chosen on
-            // entry to each iteration of this loop.
-
-            while (list.size() > 0) {
-
-               rootVecBz = rootItr->indicesBz;
-               Gsq = rootItr->sqNorm;
-               cancel = false;
-               star.clear();
-
-               // Construct a star from root vector, by applying every
-               // symmetry operation in the group to the root wavevector.
-               for (j = 0; j < group.size(); ++j) {
-
-                  // Apply symmetry (i.e., multiply by rotation matrix)
-                  // vec = rotated wavevector.
-                  vec = rootVecBz*group[j];
-
-                  // Check that rotated vector has same norm as root.
-                  UTIL_CHECK(abs(Gsq - unitCell().ksq(vec)) < epsilon);
-
-                  // Initialize TWave object associated with rotated wave
-                  wave.sqNorm = Gsq;
-                  wave.indicesBz = shiftToMinimum(vec, meshDimensions, 
-                                                  *unitCellPtr_);
-                  wave.indicesDft = vec;
-                  mesh().shift(wave.indicesDft);
-
-                  // Compute phase for coeff. of wave in basis function.
-                  // Convention -pi < phase <= pi.
-                  wave.phase = 0.0;
-                  for (k = 0; k < D; ++k) {
-                     wave.phase += rootVecBz[k]*(group[j].t(k));
-                  }
-                  while (wave.phase > 0.5) {
-                     wave.phase -= 1.0;
-                  }
-                  while (wave.phase <= -0.5) {
-                     wave.phase += 1.0;
-                  }
-                  wave.phase *= twoPi;
-
-                  // Check for cancellation of star: The star is
-                  // cancelled if application of any symmetry operation
-                  // in the group to the root vector yields a rotated 
-                  // vector equivalent to the root vector but with a 
-                  // nonzero phase, creating a contradiction.
-
-                  if (wave.indicesDft == rootItr->indicesDft) {
-                     if (abs(wave.phase) > 1.0E-6) {
-                        cancel = true;
-                     }
-                  }
-
-                  // Search for an equivalent wave already in the star.
-                  // Note: Equivalent waves have equal DFT indices.
-                  setItr = star.find(wave);
-
-                  if (setItr == star.end()) {
-
-                     // If no equivalent wave is found in the star,
-                     // then add this wave to the star
-                     star.insert(wave);
-
-                  } else {
-
-                     // If an equivalent wave is found, check if the
-                     // phases are equivalent. If not, the star is
-                     // cancelled.
-
-                     phase_diff = setItr->phase - wave.phase;
-                     while (phase_diff > 0.5) {
-                        phase_diff -= 1.0;
-                     }
-                     while (phase_diff <= -0.5) {
-                        phase_diff += 1.0;
-                     }
-                     if (abs(phase_diff) > 1.0E-6) {
-                        cancel = true;
-                     }
-
-                  }
-
-               }
-
-               // Copy all waves from set star to std::vector tempStar
-               tempStar.clear();
-               setItr = star.begin(); 
-               for ( ; setItr != star.end(); ++setItr) {
-                  tempStar.push_back(*setItr);
-               }
-
-               // Sort tempStar, in descending order by indicesBz.
-               TWaveBzComp<D> waveBzComp;
-               std::sort(tempStar.begin(), tempStar.end(), waveBzComp);
-               
-               // Append contents of tempStar to tempList, erase from list
-               int tempStarSize = tempStar.size();
-               for (j = 0; j < tempStarSize; ++j) {
-                  list.erase(tempStar[j]);
-                  tempList.append(tempStar[j]);
-               }
-               UTIL_CHECK((int)(tempList.size()+list.size())==listEnd-listBegin);
-
-               // If this star is not cancelled, increment the number
-               // of basis functions (nBasis_) and waves (nBasisWave_)
-               if (!cancel) {
-                  ++nBasis_;
-                  nBasisWave_ += star.size();
-               }
-
-               // Initialize a Star object 
-               newStar.eigen = Gsq;
-               newStar.beginId = starBegin;
-               newStar.endId = newStar.beginId + star.size();
-               newStar.size = star.size();
-               newStar.cancel = cancel;
-               // Note: newStar.starInvert is not yet known
-
-               // Determine invertFlag, rootItr and nextInvert
-               if (nextInvert == -1) {
-
-                  // If this star is 2nd of a pair related by inversion,
-                  // set root of next star to 1st wave of remaining list.
-
-                  newStar.invertFlag = -1;
-                  rootItr = list.begin();
-                  nextInvert = 1;
-
-               } else {
-
-                  // If this star is not the 2nd of a pair of partners,
-                  // then determine if it is closed under inversion.
-
-                  // Compute negation nVec of root vector in FBZ
-                  nVec.negate(rootVecBz);
-
-                  // Shift negation nVec to a DFT mesh
-                  (*meshPtr_).shift(nVec);
-       
-                  // Search for negation of root vector within this star
-                  bool negationFound = false;
-                  setItr = star.begin(); 
-                  for ( ; setItr != star.end(); ++setItr) {
-                     if (nVec == setItr->indicesDft) {
-                        negationFound = true;
-                        break;
-                     }
-                  }
-
-                  if (negationFound) {
-
-                     // If this star is closed under inversion, the root
-                     // of next star is the 1st vector of remaining list.
-
-                     newStar.invertFlag = 0;
-                     rootItr = list.begin();
-                     nextInvert = 1;
-
-                  } else {
-
-                     newStar.invertFlag = 1;
-                     nextInvert = -1;
-
-                     // If star is not closed, find negation of root in
-                     // the remaining list, and use this negation as the
-                     // root of the next star.
-
-                     setItr = list.begin();
-                     for ( ; setItr != list.end(); ++setItr) {
-                        if (nVec == setItr->indicesDft) {
-                           negationFound = true;
-                           rootItr = setItr;
-                           break;
-                        }
-                     }
-                     // If negationFound, then rootItr->indicesDft = nVec
-
-                     // Failure to find the negation here is an error:
-                     // It should be either in this star or remaining list
-
-                     if (!negationFound) {
-                        std::cout << "Negation not found for: " << "\n";
-                        std::cout << " vec (ft):" 
-                                  << rootItr->indicesDft <<"\n"; 
-                        std::cout << " vec (bz):" 
-                                  << rootItr->indicesBz <<"\n"; 
-                        std::cout << "-vec (dft):" << nVec << "\n";
-                        UTIL_CHECK(negationFound);
-                     }
-
-                  }
-
-               }
-
-               stars_.append(newStar);
-               ++starId;
-               starBegin = newStar.endId;
-
-            } 
-            // End loop over stars within a list.
-            // Processing of list is now complete.
-
-            UTIL_CHECK(list.size() == 0);
-            UTIL_CHECK(tempList.size() == listEnd - listBegin);
-
-            // Copy tempList into corresponding section of waves_,
-            // overwriting the section of waves_ used to create the list.
-            // Compute a complex coefficient of unit norm for each wave.
-            for (j = 0; j < tempList.size(); ++j) {
-               k = j + listBegin;
-               waves_[k].indicesDft = tempList[j].indicesDft;
-               waves_[k].indicesBz = tempList[j].indicesBz;
-               waves_[k].sqNorm = tempList[j].sqNorm;
-               coeff = std::complex<double>(0.0, tempList[j].phase);
-               coeff = exp(coeff);
-               if (abs(imag(coeff)) < 1.0E-6) {
-                  coeff = std::complex<double>(real(coeff), 0.0);
-               }
-               if (abs(real(coeff)) < 1.0E-6) {
-                  coeff = std::complex<double>(0.0, imag(coeff));
-               }
-               waves_[k].coeff = coeff;
+      // Append stars for all shells to stars_, in order
+      stars_.clear();
+      nBasis_ = 0;
+      nBasisWave_ = 0;
+      for (int is = 0; is < nShell; ++is) {
+         for (j = 0; j < (int)shellStars[is].size(); ++j) {
+            stars_.append(shellStars[is][j]);
+            if (!shellStars[is][j].cancel) {
+               ++nBasis_;
+               nBasisWave_ += shellStars[is][j].size;
             }
+         }
+      }
 
-            // At this point, waves_[k].coeff has unit absolute magnitude,
-            // and correct relative phases for waves within a star, but
-            // the coeff may not be unity for the first or last wave in
-            // the star.
-
-            ++listId;
-            listBegin = listEnd;
-         } 
-         // Finished processing a list of waves of equal norm
-
-      } // End loop over all waves
       nStar_ = stars_.size();
       // Complete initial processing of all lists and stars
 
@@ -642,6 +398,242 @@ namespace Pscf {
 
    }
 
+   /*
+   * Identify stars within one shell of waves of equal norm.
+   *
+   * On entry, waves begin <= i < end of waves_ must be sorted by DFT
+   * indices, and rankIds must map the rank of the DFT indices of every
+   * wave to its index in waves_. On return, this section of waves_ is
+   * ordered by star, with waves in each star sorted in descending order
+   * by indicesBz, and each wave has a coeff of unit magnitude. Stars are
+   * returned in array stars, with beginId and endId set to global wave
+   * indices. The cancel and invertFlag members of each Star are set, but
+   * waveBz is not.
+   *
+   * The root of each star is the first remaining wave in DFT order,
+   * except for the second star of a pair related by inversion, for
+   * which the root is the negation of the root of the first star.
+   */
+   template <int D>
+   void Basis<D>::makeShellStars(const SpaceGroup<D>& group, 
+                                 DArray<int> const & rankIds,
+                                 int begin, int end, 
+                                 std::vector<Star>& stars)
+   {
+      int n = end - begin;
+
+      // Copy waves of equal norm into list, ordered by DFT indices
+      std::vector< TWave<D> > list(n);
+      int i, j, k;
+      for (i = 0; i < n; ++i) {
+         list[i].indicesDft = waves_[begin + i].indicesDft;
+         list[i].indicesBz = waves_[begin + i].indicesBz;
+         list[i].sqNorm = waves_[begin + i].sqNorm;
+      }
+
+      // used[i] is true iff list[i] has been assigned to a star.
+      // starPos[i] is the position of list[i] in the current star, or -1.
+      std::vector<bool> used(n, false);
+      std::vector<int> starPos(n, -1);
+      std::vector< TWave<D> > star;
+      std::vector<int> starIds;
+      std::vector< TWave<D> > tempList;
+      tempList.reserve(n);
+
+      TWave<D> wave;
+      Star newStar;
+      const double twoPi = 2.0*Constants::Pi;
+      const double epsilon = 1.0E-8;
+      IntVec<D> rootVecBz;
+      IntVec<D> vec;
+      IntVec<D> nVec;
+      double Gsq;
+      double phase_diff;
+      bool cancel;
+      int nRemain = n;  // number of waves not yet assigned to a star
+      int first = 0;    // index of first wave that may be unused
+      int root = 0;     // index of root of next star
+      int nextInvert = 1;
+      int starBegin = begin;
+
+      while (nRemain > 0) {
+
+         rootVecBz = list[root].indicesBz;
+         Gsq = list[root].sqNorm;
+         cancel = false;
+         star.clear();
+         starIds.clear();
+
+         // Construct a star from root vector, by applying every
+         // symmetry operation in the group to the root wavevector.
+         for (j = 0; j < group.size(); ++j) {
+
+            // Apply symmetry (i.e., multiply by rotation matrix)
+            vec = rootVecBz*group[j];
+
+            // Check that rotated vector has same norm as root.
+            UTIL_CHECK(abs(Gsq - unitCell().ksq(vec)) < epsilon);
+
+            // Find rotated wave in this shell. Its minimum image 
+            // indicesBz is known from makeWaves.
+            wave.indicesDft = vec;
+            mesh().shift(wave.indicesDft);
+            i = rankIds[mesh().rank(wave.indicesDft)] - begin;
+            UTIL_CHECK(i >= 0 && i < n);
+            UTIL_CHECK(!used[i]);
+            wave.sqNorm = Gsq;
+            wave.indicesBz = list[i].indicesBz;
+
+            // Compute phase for coeff. of wave in basis function.
+            // Convention -pi < phase <= pi.
+            wave.phase = 0.0;
+            for (k = 0; k < D; ++k) {
+               wave.phase += rootVecBz[k]*(group[j].t(k));
+            }
+            while (wave.phase > 0.5) {
+               wave.phase -= 1.0;
+            }
+            while (wave.phase <= -0.5) {
+               wave.phase += 1.0;
+            }
+            wave.phase *= twoPi;
+
+            // Check for cancellation of star (rotated vector equivalent
+            // to the root vector, but with a nonzero phase).
+            if (wave.indicesDft == list[root].indicesDft) {
+               if (abs(wave.phase) > 1.0E-6) {
+                  cancel = true;
+               }
+            }
+
+            if (starPos[i] < 0) {
+
+               // If no equivalent wave is in the star, add this wave
+               starPos[i] = star.size();
+               star.push_back(wave);
+               starIds.push_back(i);
+
+            } else {
+
+               // If an equivalent wave is found, check if the phases
+               // are equivalent. If not, the star is cancelled.
+               phase_diff = star[starPos[i]].phase - wave.phase;
+               while (phase_diff > 0.5) {
+                  phase_diff -= 1.0;
+               }
+               while (phase_diff <= -0.5) {
+                  phase_diff += 1.0;
+               }
+               if (abs(phase_diff) > 1.0E-6) {
+                  cancel = true;
+               }
+
+            }
+
+         }
+
+         // Remove waves in this star from the list
+         int starSize = star.size();
+         for (j = 0; j < starSize; ++j) {
+            used[starIds[j]] = true;
+            starPos[starIds[j]] = -1;
+         }
+         nRemain -= starSize;
+         while (first < n && used[first]) {
+            ++first;
+         }
+
+         // Sort star in descending order by indicesBz, append to tempList
+         TWaveBzComp<D> waveBzComp;
+         std::sort(star.begin(), star.end(), waveBzComp);
+         for (j = 0; j < starSize; ++j) {
+            tempList.push_back(star[j]);
+         }
+
+         // Initialize a Star object 
+         newStar.eigen = Gsq;
+         newStar.beginId = starBegin;
+         newStar.endId = newStar.beginId + starSize;
+         newStar.size = starSize;
+         newStar.cancel = cancel;
+
+         // Determine invertFlag, root and nextInvert
+         if (nextInvert == -1) {
+
+            // If this star is 2nd of a pair related by inversion,
+            // the root of next star is the 1st remaining wave.
+            newStar.invertFlag = -1;
+            root = first;
+            nextInvert = 1;
+
+         } else {
+
+            // Compute negation of root vector, shift to DFT mesh
+            nVec.negate(rootVecBz);
+            mesh().shift(nVec);
+
+            // Search for negation of root vector within this star
+            bool negationFound = false;
+            for (j = 0; j < starSize; ++j) {
+               if (nVec == star[j].indicesDft) {
+                  negationFound = true;
+                  break;
+               }
+            }
+
+            if (negationFound) {
+
+               // Star is closed under inversion
+               newStar.invertFlag = 0;
+               root = first;
+               nextInvert = 1;
+
+            } else {
+
+               // Star is not closed under inversion. The negation of
+               // the root must be in the remaining list, and is used 
+               // as the root of the next star.
+               newStar.invertFlag = 1;
+               nextInvert = -1;
+               i = rankIds[mesh().rank(nVec)] - begin;
+               if (i < 0 || i >= n || used[i]) {
+                  std::cout << "Negation not found for: " << "\n";
+                  std::cout << " vec (bz):" << rootVecBz <<"\n"; 
+                  std::cout << "-vec (dft):" << nVec << "\n";
+                  UTIL_THROW("Negation not found");
+               }
+               root = i;
+
+            }
+
+         }
+
+         stars.push_back(newStar);
+         starBegin = newStar.endId;
+      }
+      UTIL_CHECK((int)tempList.size() == n);
+      UTIL_CHECK(nextInvert == 1);
+
+      // Copy tempList into this section of waves_. Compute a complex
+      // coefficient of unit norm for each wave.
+      std::complex<double> coeff;
+      for (j = 0; j < n; ++j) {
+         k = j + begin;
+         waves_[k].indicesDft = tempList[j].indicesDft;
+         waves_[k].indicesBz = tempList[j].indicesBz;
+         waves_[k].sqNorm = tempList[j].sqNorm;
+         coeff = std::complex<double>(0.0, tempList[j].phase);
+         coeff = exp(coeff);
+         if (abs(imag(coeff)) < 1.0E-6) {
+            coeff = std::complex<double>(real(coeff), 0.0);
+         }
+         if (abs(real(coeff)) < 1.0E-6) {
+            coeff = std::complex<double>(0.0, imag(coeff));
+         }
+         waves_[k].coeff = coeff;
+      }
+   }
+
   
    template <int D>
    void Basis<D>::update()
@@ -739,6 +731,243 @@ namespace Pscf {
       }
    }
 
+   /*
+   * Write header that identifies a basis in a cache file.
+   */
+   template <int D>
+   void Basis<D>::writeCacheKey(std::ostream& out, 
+                                Mesh<D> const & mesh,
+                                UnitCell<D> const & unitCell,
+                                std::string const & groupName) const
+   {
+      out << "PSCF_BASIS_CACHE  1" << std::endl;
+      out << "dimension  " << D << std::endl;
+      out << "groupName  " << groupName << std::endl;
+      out << "mesh       " << mesh.dimensions() << std::endl;
+      out << "unitCell   " << unitCell << std::endl;
+   }
+
+   /*
+   * Write basis to a binary cache file.
+   */
+   template <int D>
+   void Basis<D>::writeCache(std::string const & filename,
+                             std::string const & groupName) const
+   {
+      UTIL_CHECK(nWave_ > 0);
+
+      // Write to a temporary file, which is renamed when complete, so
+      // that other processes never read a partially written file.
+      std::ostringstream tmpName;
+      tmpName << filename << ".tmp" << getpid();
+      std::string tmpFilename = tmpName.str();
+      std::ofstream out(tmpFilename.c_str(), 
+                        std::ios::out | std::ios::binary);
+      if (!out.is_open()) {
+         UTIL_THROW("Failed to open basis cache file for writing");
+      }
+
+      // Header, written as a length-prefixed string
+      std::ostringstream keyOut;
+      writeCacheKey(keyOut, mesh(), unitCell(), groupName);
+      std::string key = keyOut.str();
+      int keySize = key.size();
+      out.write((char const *)&keySize, sizeof(int));
+      out.write(key.c_str(), keySize);
+
+      // Counters
+      out.write((char const *)&nWave_, sizeof(int));
+      out.write((char const *)&nBasisWave_, sizeof(int));
+      out.write((char const *)&nStar_, sizeof(int));
+      out.write((char const *)&nBasis_, sizeof(int));
+
+      // Waves
+      double x;
+      int j;
+      char flag;
+      for (int i = 0; i < nWave_; ++i) {
+         Wave const & w = waves_[i];
+         x = w.coeff.real();
+         out.write((char const *)&x, sizeof(double));
+         x = w.coeff.imag();
+         out.write((char const *)&x, sizeof(double));
+         out.write((char const *)&w.sqNorm, sizeof(double));
+         for (j = 0; j < D; ++j) {
+            out.write((char const *)&w.indicesDft[j], sizeof(int));
+         }
+         for (j = 0; j < D; ++j) {
+            out.write((char const *)&w.indicesBz[j], sizeof(int));
+         }
+         out.write((char const *)&w.starId, sizeof(int));
+         flag = w.implicit ? 1 : 0;
+         out.write(&flag, 1);
+      }
+
+      // Stars
+      for (int i = 0; i < nStar_; ++i) {
+         Star const & s = stars_[i];
+         out.write((char const *)&s.eigen, sizeof(double));
+         out.write((char const *)&s.size, sizeof(int));
+         out.write((char const *)&s.beginId, sizeof(int));
+         out.write((char const *)&s.endId, sizeof(int));
+         out.write((char const *)&s.invertFlag, sizeof(int));
+         for (j = 0; j < D; ++j) {
+            out.write((char const *)&s.waveBz[j], sizeof(int));
+         }
+         flag = s.cancel ? 1 : 0;
+         out.write(&flag, 1);
+      }
+
+      out.close();
+      if (out.fail()) {
+         std::remove(tmpFilename.c_str());
+         UTIL_THROW("Error writing basis cache file");
+      }
+      if (std::rename(tmpFilename.c_str(), filename.c_str()) != 0) {
+         std::remove(tmpFilename.c_str());
+         UTIL_THROW("Failed to rename basis cache file");
+      }
+   }
+
+   /*
+   * Read basis from a binary cache file, if the file is valid.
+   */
+   template <int D>
+   bool Basis<D>::readCache(std::string const & filename,
+                            Mesh<D> const & mesh,
+                            UnitCell<D> const & unitCell,
+                            std::string const & groupName)
+   {
+      std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+      if (!in.is_open()) {
+         return false;
+      }
+
+      // Compare header to expected key
+      std::ostringstream keyOut;
+      writeCacheKey(keyOut, mesh, unitCell, groupName);
+      std::string key = keyOut.str();
+      int keySize = 0;
+      in.read((char*)&keySize, sizeof(int));
+      if (!in.good() || keySize != (int)key.size()) {
+         return false;
+      }
+      std::string fileKey(keySize, ' ');
+      in.read(&fileKey[0], keySize);
+      if (!in.good() || fileKey != key) {
+         return false;
+      }
+
+      // Counters
+      int nWave, nBasisWave, nStar, nBasis;
+      in.read((char*)&nWave, sizeof(int));
+      in.read((char*)&nBasisWave, sizeof(int));
+      in.read((char*)&nStar, sizeof(int));
+      in.read((char*)&nBasis, sizeof(int));
+      if (!in.good() || nWave != mesh.size() || nStar <= 0 
+          || nStar > nWave || nBasis < 0 || nBasis > nStar
+          || nBasisWave < 0 || nBasisWave > nWave) {
+         return false;
+      }
+
+      // Read waves and stars into local arrays, so that this object is
+      // not modified unless the whole file is read successfully.
+      DArray<Wave> waves;
+      DArray<int> waveIds;
+      waves.allocate(nWave);
+      waveIds.allocate(nWave);
+      double re, im;
+      int i, j, rank;
+      char flag;
+      for (i = 0; i < nWave; ++i) {
+         waveIds[i] = -1;
+      }
+      for (i = 0; i < nWave; ++i) {
+         Wave& w = waves[i];
+         in.read((char*)&re, sizeof(double));
+         in.read((char*)&im, sizeof(double));
+         w.coeff = std::complex<double>(re, im);
+         in.read((char*)&w.sqNorm, sizeof(double));
+         for (j = 0; j < D; ++j) {
+            in.read((char*)&w.indicesDft[j], sizeof(int));
+         }
+         for (j = 0; j < D; ++j) {
+            in.read((char*)&w.indicesBz[j], sizeof(int));
+         }
+         in.read((char*)&w.starId, sizeof(int));
+         in.read(&flag, 1);
+         w.implicit = (flag != 0);
+         if (!in.good() || w.starId < 0 || w.starId >= nStar) {
+            return false;
+         }
+         for (j = 0; j < D; ++j) {
+            if (w.indicesDft[j] < 0 
+                || w.indicesDft[j] >= mesh.dimension(j)) {
+               return false;
+            }
+         }
+         rank = mesh.rank(w.indicesDft);
+         if (waveIds[rank] != -1) {
+            return false;
+         }
+         waveIds[rank] = i;
+      }
+
+      GArray<Star> stars;
+      Star star;
+      for (i = 0; i < nStar; ++i) {
+         in.read((char*)&star.eigen, sizeof(double));
+         in.read((char*)&star.size, sizeof(int));
+         in.read((char*)&star.beginId, sizeof(int));
+         in.read((char*)&star.endId, sizeof(int));
+         in.read((char*)&star.invertFlag, sizeof(int));
+         for (j = 0; j < D; ++j) {
+            in.read((char*)&star.waveBz[j], sizeof(int));
+         }
+         in.read(&flag, 1);
+         star.cancel = (flag != 0);
+         if (!in.good() || star.beginId < 0 || star.endId > nWave
+             || star.size != star.endId - star.beginId 
+             || star.size <= 0) {
+            return false;
+         }
+         stars.append(star);
+      }
+      in.close();
+
+      // Copy into this object
+      meshPtr_ = &mesh;
+      unitCellPtr_ = &unitCell;
+      if (waves_.isAllocated()) {
+         UTIL_CHECK(waves_.capacity() == nWave);
+      } else {
+         waves_.allocate(nWave);
+         waveIds_.allocate(nWave);
+      }
+      for (i = 0; i < nWave; ++i) {
+         waves_[i] = waves[i];
+         waveIds_[i] = waveIds[i];
+      }
+      stars_.clear();
+      for (i = 0; i < nStar; ++i) {
+         stars_.append(stars[i]);
+      }
+      nWave_ = nWave;
+      nBasisWave_ = nBasisWave;
+      nStar_ = nStar;
+      nBasis_ = nBasis;
+
+      // Discard a basis that fails the validity check
+      if (!isValid()) {
+         stars_.clear();
+         nStar_ = 0;
+         nBasis_ = 0;
+         nBasisWave_ = 0;
+         return false;
+      }
+      return true;
+   }
+
    template <int D>
    bool Basis<D>::isValid() const
    {
@@ -10,10 +10,15 @@
 
 #include <pscf/crystal/SpaceSymmetry.h>
 #include <pscf/crystal/SymmetryGroup.h>
+#include <pscf/crystal/groupFile.h>
+#include <pscf/crystal/groupTables.h>
 #include <pscf/math/IntVec.h>
 #include <util/containers/FSArray.h>
 #include <util/param/Label.h>
+#include <util/misc/Log.h>
+#include <fstream>
 #include <iostream>
+#include <string>
 
 namespace Pscf
 {
@@ -27,7 +32,105 @@ namespace Pscf
    */
    template <int D>
    class SpaceGroup : public SymmetryGroup< SpaceSymmetry <D> >
-   {};
+   {
+
+   public:
+
+      /**
+      * Does this group contain an inversion center at the origin?
+      *
+      * Returns true iff the group contains the inversion r -> -r with
+      * zero translation, in which case every field with the symmetry
+      * of the group is even under inversion through the origin.
+      */
+      bool hasInversionCenter() const;
+
+      /**
+      * Does this group contain reflections of each coordinate?
+      *
+      * Returns true iff, for each i = 0, ..., D-1, the group contains
+      * the reflection x[i] -> -x[i] of Bravais coordinate i, with all
+      * other coordinates unchanged and zero translation. Every field 
+      * with the symmetry of such a group is even in each coordinate
+      * separately. In 1D, this is equivalent to hasInversionCenter().
+      */
+      bool hasAxisReflections() const;
+
+      using SymmetryGroup< SpaceSymmetry<D> >::size;
+
+   private:
+
+      /**
+      * Does this group contain a diagonal operation with zero translation?
+      *
+      * \param diagonal  diagonal elements of the rotation matrix
+      */
+      bool hasDiagonalElement(IntVec<D> const & diagonal) const;
+
+   };
+
+   // Template function definitions
+
+   /*
+   * Does this group contain an inversion center at the origin?
+   */
+   template <int D>
+   bool SpaceGroup<D>::hasInversionCenter() const
+   {
+      IntVec<D> diagonal;
+      for (int i = 0; i < D; ++i) {
+         diagonal[i] = -1;
+      }
+      return hasDiagonalElement(diagonal);
+   }
+
+   /*
+   * Does this group contain reflections of each coordinate?
+   */
+   template <int D>
+   bool SpaceGroup<D>::hasAxisReflections() const
+   {
+      IntVec<D> diagonal;
+      int i, j;
+      for (i = 0; i < D; ++i) {
+         for (j = 0; j < D; ++j) {
+            diagonal[j] = (j == i) ? -1 : 1;
+         }
+         if (!hasDiagonalElement(diagonal)) {
+            return false;
+         }
+      }
+      return true;
+   }
+
+   /*
+   * Does this group contain a diagonal operation with zero translation?
+   */
+   template <int D>
+   bool SpaceGroup<D>::hasDiagonalElement(IntVec<D> const & diagonal) 
+   const
+   {
+      int i, j, k;
+      bool match;
+      for (k = 0; k < size(); ++k) {
+         SpaceSymmetry<D> const & s = (*this)[k];
+         match = true;
+         for (i = 0; i < D && match; ++i) {
+            if (s.t(i).num() != 0) {
+               match = false;
+            }
+            for (j = 0; j < D && match; ++j) {
+               if (s.R(i, j) != ((i == j) ? diagonal[i] : 0)) {
+                  match = false;
+               }
+            }
+         }
+         if (match) {
+            return true;
+         }
+      }
+      return false;
+   }
 
    // Template function definition
 
@@ -76,6 +179,95 @@ namespace Pscf
       return in;
    }
 
+   /**
+   * Construct a space group from the table compiled into the library.
+   *
+   * Returns false, and leaves the group unchanged, if no group with
+   * the specified name is found in the table for dimension D.
+   *
+   * \param groupName  standard name of space group
+   * \param group  space group (output)
+   * \return true if the group was found, false otherwise
+   *
+   * \ingroup Pscf_Crystal_Module
+   */
+   template <int D>
+   bool makeTableGroup(std::string groupName, SpaceGroup<D>& group)
+   {
+      int id = findTableGroup(D, groupName);
+      if (id < 0) {
+         return false;
+      }
+      GroupTableEntry const & entry = tableGroup(D, id);
+      signed char const * ptr = tableGroupData(D) + entry.offset;
+      SpaceSymmetry<D> s;
+      int i, j, k;
+      group.clear();
+      for (k = 0; k < entry.size; ++k) {
+         for (i = 0; i < D; ++i) {
+            for (j = 0; j < D; ++j) {
+               s.R(i, j) = *ptr;
+               ++ptr;
+            }
+         }
+         for (i = 0; i < D; ++i) {
+            s.t(i) = Rational(*ptr, groupTableDenominator);
+            ++ptr;
+         }
+         group.add(s);
+      }
+      return true;
+   }
+
+   /**
+   * Read a space group, given a group name or group file name.
+   *
+   * The name "I" denotes the identity group. Any other name is first
+   * looked up among the standard group names in the table compiled 
+   * into the library (see groupTables.h), then interpreted as the name 
+   * of a group file, and then as the standard name of a group in the 
+   * data directory. An Exception is thrown if the name is not found 
+   * in the table and neither file can be opened.
+   *
+   * \param groupName  group name or group file name
+   * \param group  space group (output)
+   *
+   * \ingroup Pscf_Crystal_Module
+   */
+   template <int D>
+   void readGroup(std::string groupName, SpaceGroup<D>& group)
+   {
+      if (groupName == "I") {
+         // Create identity group by default
+         group.makeCompleteGroup();
+         return;
+      } 
+      if (makeTableGroup(groupName, group)) {
+         return;
+      }
+      {
+         std::ifstream in;
+         in.open(groupName);
+         if (in.is_open()) {
+            in >> group;
+            UTIL_CHECK(group.isValid());
+            return;
+         }
+      }
+      std::string fileName = makeGroupFileName(D, groupName);
+      std::ifstream in;
+      in.open(fileName);
+      if (in.is_open()) {
+         in >> group;
+         UTIL_CHECK(group.isValid());
+      } else {
+         Log::file() << "\nFailed to open group file: " 
+                     << fileName << "\n";
+         Log::file() << "\n Error: Unknown space group\n";
+         UTIL_THROW("Unknown space group");
+      }
+   }
+
    #ifndef PSCF_SPACE_GROUP_CPP
    extern template class SpaceGroup<1>;
    extern template class SpaceGroup<2>;
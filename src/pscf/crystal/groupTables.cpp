@@ -0,0 +1,6138 @@
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+/*
+* This file was generated by makeGroupTables.py from the group files in
+* data/groups. Do not edit it by hand. Run "make groupTables" in the
+* src/pscf/crystal directory to regenerate it.
+*/
+
+#include "groupTables.h"
+#include <util/global.h>
+#include <algorithm>
+#include <cstring>
+
+namespace Pscf {
+
+   using namespace Util;
+
+   namespace {
+
+      // Symmetry elements of 1D space groups
+      constexpr signed char groupData1[] = {
+         // P_-1
+         1,0,
+         -1,0,
+         // P_1
+         1,0,
+      };
+
+      // 1D space groups, sorted by name
+      constexpr GroupTableEntry groupTable1[] = {
+         {"P_-1", 2, 0},
+         {"P_1", 1, 4},
+      };
+
+      constexpr int nGroup1 = 2;
+
+      // Symmetry elements of 2D space groups
+      constexpr signed char groupData2[] = {
+         // c_2_m_m
+         1,0,0,1,0,0,
+         -1,0,0,-1,0,0,
+         -1,0,0,1,0,0,
+         1,0,0,1,6,6,
+         1,0,0,-1,0,0,
+         -1,0,0,-1,6,6,
+         -1,0,0,1,6,6,
+         1,0,0,-1,6,6,
+         // c_m
+         1,0,0,1,0,0,
+         -1,0,0,1,0,0,
+         1,0,0,1,6,6,
+         -1,0,0,1,6,6,
+         // p_1
+         1,0,0,1,0,0,
+         // p_2
+         1,0,0,1,0,0,
+         -1,0,0,-1,0,0,
+         // p_2_g_g
+         1,0,0,1,0,0,
+         -1,0,0,-1,0,0,
+         -1,0,0,1,6,0,
+         1,0,0,-1,6,0,
+         // p_2_m_g
+         1,0,0,1,0,0,
+         -1,0,0,-1,0,0,
+         -1,0,0,1,6,0,
+         1,0,0,-1,6,0,
+         // p_2_m_m
+         1,0,0,1,0,0,
+         -1,0,0,-1,0,0,
+         -1,0,0,1,0,0,
+         1,0,0,-1,0,0,
+         // p_3
+         1,0,0,1,0,0,
+         0,-1,1,-1,0,0,
+         -1,1,-1,0,0,0,
+         // p_3_1_m
+         1,0,0,1,0,0,
+         0,-1,1,-1,0,0,
+         0,1,1,0,0,0,
+         -1,1,-1,0,0,0,
+         -1,0,-1,1,0,0,
+         1,-1,0,-1,0,0,
+         // p_3_m_1
+         1,0,0,1,0,0,
+         0,-1,1,-1,0,0,
+         1,0,1,-1,0,0,
+         -1,1,-1,0,0,0,
+         -1,1,0,1,0,0,
+         0,-1,-1,0,0,0,
+         // p_4
+         1,0,0,1,0,0,
+         -1,0,0,-1,0,0,
+         0,1,-1,0,0,0,
+         0,-1,1,0,0,0,
+         // p_4_g_m
+         1,0,0,1,0,0,
+         -1,0,0,-1,0,0,
+         0,1,-1,0,0,0,
+         -1,0,0,1,6,6,
+         0,-1,1,0,0,0,
+         1,0,0,-1,6,6,
+         0,1,1,0,6,6,
+         0,-1,-1,0,6,6,
+         // p_4_m_m
+         1,0,0,1,0,0,
+         -1,0,0,-1,0,0,
+         -1,0,0,1,0,0,
+         0,1,-1,0,0,0,
+         0,-1,1,0,0,0,
+         1,0,0,-1,0,0,
+         0,-1,-1,0,0,0,
+         0,1,1,0,0,0,
+         // p_6
+         1,0,0,1,0,0,
+         0,-1,1,-1,0,0,
+         -1,0,0,-1,0,0,
+         -1,1,-1,0,0,0,
+         0,1,-1,1,0,0,
+         1,-1,1,0,0,0,
+         // p_6_m_m
+         1,0,0,1,0,0,
+         0,-1,1,-1,0,0,
+         1,0,1,-1,0,0,
+         -1,0,0,-1,0,0,
+         -1,1,-1,0,0,0,
+         -1,1,0,1,0,0,
+         0,1,-1,1,0,0,
+         0,-1,-1,0,0,0,
+         -1,0,-1,1,0,0,
+         1,-1,1,0,0,0,
+         1,-1,0,-1,0,0,
+         0,1,1,0,0,0,
+         // p_g
+         1,0,0,1,0,0,
+         -1,0,0,1,0,6,
+         // p_m
+         1,0,0,1,0,0,
+         -1,0,0,1,0,0,
+      };
+
+      // 2D space groups, sorted by name
+      constexpr GroupTableEntry groupTable2[] = {
+         {"c_2_m_m", 8, 0},
+         {"c_m", 4, 48},
+         {"p_1", 1, 72},
+         {"p_2", 2, 78},
+         {"p_2_g_g", 4, 90},
+         {"p_2_m_g", 4, 114},
+         {"p_2_m_m", 4, 138},
+         {"p_3", 3, 162},
+         {"p_3_1_m", 6, 180},
+         {"p_3_m_1", 6, 216},
+         {"p_4", 4, 252},
+         {"p_4_g_m", 8, 276},
+         {"p_4_m_m", 8, 324},
+         {"p_6", 6, 372},
+         {"p_6_m_m", 12, 408},
+         {"p_g", 2, 480},
+         {"p_m", 2, 492},
+      };
+
+      constexpr int nGroup2 = 17;
+
+      // Symmetry elements of 3D space groups
+      constexpr signed char groupData3[] = {
+         // A_b_a_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         -1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,-1,0,0,0,1,6,0,6,
+         // A_b_m_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,6,0,
+         1,0,0,0,-1,0,0,0,1,0,6,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         -1,0,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         // A_m_a_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,6,0,0,
+         1,0,0,0,-1,0,0,0,1,6,0,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         // A_m_m_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         -1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,1,0,6,6,
+         // C_1_2%c_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,-6,
+         // C_1_2%m_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         // C_1_2_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         // C_1_c_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         // C_1_m_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         // C_2_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         // C_2_2_21
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         // C_c_c_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         // C_c_c_a:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,-1,0,0,0,1,6,0,6,
+         1,0,0,0,1,0,0,0,-1,6,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,1,0,6,6,
+         1,0,0,0,1,0,0,0,-1,0,6,6,
+         // C_c_c_a:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,-6,0,-6,
+         1,0,0,0,-1,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,-1,-6,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,0,6,-6,
+         1,0,0,0,-1,0,0,0,1,6,6,-6,
+         1,0,0,0,1,0,0,0,-1,0,6,0,
+         // C_c_c_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,-6,
+         1,0,0,0,-1,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,-6,
+         1,0,0,0,-1,0,0,0,1,6,6,-6,
+         1,0,0,0,1,0,0,0,-1,6,6,0,
+         // C_m_c_21
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         // C_m_c_a
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,-6,0,-6,
+         1,0,0,0,1,0,0,0,-1,-6,0,-6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,0,6,-6,
+         1,0,0,0,1,0,0,0,-1,0,6,-6,
+         // C_m_c_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,-1,0,0,-6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,-6,
+         1,0,0,0,1,0,0,0,-1,6,6,-6,
+         // C_m_m_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         // C_m_m_a
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,6,0,0,
+         -1,0,0,0,-1,0,0,0,1,6,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,-6,0,0,
+         1,0,0,0,1,0,0,0,-1,-6,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,0,
+         -1,0,0,0,-1,0,0,0,1,0,6,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,0,6,0,
+         1,0,0,0,1,0,0,0,-1,0,6,0,
+         // C_m_m_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         1,0,0,0,1,0,0,0,-1,6,6,0,
+         // F_-4_3_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,6,0,0,
+         -1,0,0,0,0,-1,0,1,0,6,0,0,
+         0,0,-1,0,-1,0,1,0,0,6,0,0,
+         0,0,1,0,-1,0,-1,0,0,6,0,0,
+         0,1,0,-1,0,0,0,0,-1,6,0,0,
+         0,-1,0,1,0,0,0,0,-1,6,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,6,0,0,
+         0,1,0,1,0,0,0,0,1,6,0,0,
+         0,0,-1,0,1,0,-1,0,0,6,0,0,
+         0,0,1,0,1,0,1,0,0,6,0,0,
+         1,0,0,0,0,-1,0,-1,0,6,0,0,
+         1,0,0,0,0,1,0,1,0,6,0,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         -1,0,0,0,0,1,0,-1,0,6,6,6,
+         -1,0,0,0,0,-1,0,1,0,6,6,6,
+         0,0,-1,0,-1,0,1,0,0,6,6,6,
+         0,0,1,0,-1,0,-1,0,0,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         0,0,1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,1,1,0,0,0,6,6,
+         0,-1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,0,6,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         0,-1,0,-1,0,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,1,6,6,6,
+         0,0,-1,0,1,0,-1,0,0,6,6,6,
+         0,0,1,0,1,0,1,0,0,6,6,6,
+         1,0,0,0,0,-1,0,-1,0,6,6,6,
+         1,0,0,0,0,1,0,1,0,6,6,6,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         -1,0,0,0,0,1,0,-1,0,0,0,6,
+         -1,0,0,0,0,-1,0,1,0,0,0,6,
+         0,0,-1,0,-1,0,1,0,0,0,0,6,
+         0,0,1,0,-1,0,-1,0,0,0,0,6,
+         0,1,0,-1,0,0,0,0,-1,0,0,6,
+         0,-1,0,1,0,0,0,0,-1,0,0,6,
+         0,0,1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,1,1,0,0,6,0,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,6,0,6,
+         0,1,0,0,0,-1,-1,0,0,6,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         0,-1,0,-1,0,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,1,0,0,6,
+         0,0,-1,0,1,0,-1,0,0,0,0,6,
+         0,0,1,0,1,0,1,0,0,0,0,6,
+         1,0,0,0,0,-1,0,-1,0,0,0,6,
+         1,0,0,0,0,1,0,1,0,0,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         -1,0,0,0,0,1,0,-1,0,0,6,0,
+         -1,0,0,0,0,-1,0,1,0,0,6,0,
+         0,0,-1,0,-1,0,1,0,0,0,6,0,
+         0,0,1,0,-1,0,-1,0,0,0,6,0,
+         0,1,0,-1,0,0,0,0,-1,0,6,0,
+         0,-1,0,1,0,0,0,0,-1,0,6,0,
+         0,0,1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,1,1,0,0,6,6,0,
+         0,-1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,6,6,0,
+         0,0,-1,-1,0,0,0,1,0,6,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,6,0,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,-1,0,-1,0,0,0,0,1,0,6,0,
+         0,1,0,1,0,0,0,0,1,0,6,0,
+         0,0,-1,0,1,0,-1,0,0,0,6,0,
+         0,0,1,0,1,0,1,0,0,0,6,0,
+         1,0,0,0,0,-1,0,-1,0,0,6,0,
+         1,0,0,0,0,1,0,1,0,0,6,0,
+         // F_-4_3_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,0,0,0,
+         -1,0,0,0,0,-1,0,1,0,0,0,0,
+         0,0,-1,0,-1,0,1,0,0,0,0,0,
+         0,0,1,0,-1,0,-1,0,0,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         0,0,-1,0,1,0,-1,0,0,0,0,0,
+         0,0,1,0,1,0,1,0,0,0,0,0,
+         1,0,0,0,0,-1,0,-1,0,0,0,0,
+         1,0,0,0,0,1,0,1,0,0,0,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         -1,0,0,0,0,1,0,-1,0,0,6,6,
+         -1,0,0,0,0,-1,0,1,0,0,6,6,
+         0,0,-1,0,-1,0,1,0,0,0,6,6,
+         0,0,1,0,-1,0,-1,0,0,0,6,6,
+         0,1,0,-1,0,0,0,0,-1,0,6,6,
+         0,-1,0,1,0,0,0,0,-1,0,6,6,
+         0,0,1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,1,1,0,0,0,6,6,
+         0,-1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,0,6,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         0,-1,0,-1,0,0,0,0,1,0,6,6,
+         0,1,0,1,0,0,0,0,1,0,6,6,
+         0,0,-1,0,1,0,-1,0,0,0,6,6,
+         0,0,1,0,1,0,1,0,0,0,6,6,
+         1,0,0,0,0,-1,0,-1,0,0,6,6,
+         1,0,0,0,0,1,0,1,0,0,6,6,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         -1,0,0,0,0,1,0,-1,0,6,0,6,
+         -1,0,0,0,0,-1,0,1,0,6,0,6,
+         0,0,-1,0,-1,0,1,0,0,6,0,6,
+         0,0,1,0,-1,0,-1,0,0,6,0,6,
+         0,1,0,-1,0,0,0,0,-1,6,0,6,
+         0,-1,0,1,0,0,0,0,-1,6,0,6,
+         0,0,1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,1,1,0,0,6,0,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,6,0,6,
+         0,1,0,0,0,-1,-1,0,0,6,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         0,-1,0,-1,0,0,0,0,1,6,0,6,
+         0,1,0,1,0,0,0,0,1,6,0,6,
+         0,0,-1,0,1,0,-1,0,0,6,0,6,
+         0,0,1,0,1,0,1,0,0,6,0,6,
+         1,0,0,0,0,-1,0,-1,0,6,0,6,
+         1,0,0,0,0,1,0,1,0,6,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         -1,0,0,0,0,1,0,-1,0,6,6,0,
+         -1,0,0,0,0,-1,0,1,0,6,6,0,
+         0,0,-1,0,-1,0,1,0,0,6,6,0,
+         0,0,1,0,-1,0,-1,0,0,6,6,0,
+         0,1,0,-1,0,0,0,0,-1,6,6,0,
+         0,-1,0,1,0,0,0,0,-1,6,6,0,
+         0,0,1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,1,1,0,0,6,6,0,
+         0,-1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,6,6,0,
+         0,0,-1,-1,0,0,0,1,0,6,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,6,0,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,-1,0,-1,0,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,1,6,6,0,
+         0,0,-1,0,1,0,-1,0,0,6,6,0,
+         0,0,1,0,1,0,1,0,0,6,6,0,
+         1,0,0,0,0,-1,0,-1,0,6,6,0,
+         1,0,0,0,0,1,0,1,0,6,6,0,
+         // F_2_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         // F_2_3
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         0,0,1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,1,1,0,0,0,6,6,
+         0,-1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,0,6,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         0,0,1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,1,1,0,0,6,0,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,6,0,6,
+         0,1,0,0,0,-1,-1,0,0,6,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         0,0,1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,1,1,0,0,6,6,0,
+         0,-1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,6,6,0,
+         0,0,-1,-1,0,0,0,1,0,6,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,6,0,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         // F_41_3_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,3,3,3,
+         1,0,0,0,0,1,0,-1,0,3,3,3,
+         0,0,1,0,1,0,-1,0,0,3,3,3,
+         0,0,-1,0,1,0,1,0,0,3,3,3,
+         0,-1,0,1,0,0,0,0,1,3,3,3,
+         0,1,0,-1,0,0,0,0,1,3,3,3,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,3,3,3,
+         0,-1,0,-1,0,0,0,0,-1,3,3,3,
+         0,0,1,0,-1,0,1,0,0,3,3,3,
+         0,0,-1,0,-1,0,-1,0,0,3,3,3,
+         -1,0,0,0,0,1,0,1,0,3,3,3,
+         -1,0,0,0,0,-1,0,-1,0,3,3,3,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,0,-1,0,1,0,3,9,9,
+         1,0,0,0,0,1,0,-1,0,3,9,9,
+         0,0,1,0,1,0,-1,0,0,3,9,9,
+         0,0,-1,0,1,0,1,0,0,3,9,9,
+         0,-1,0,1,0,0,0,0,1,3,9,9,
+         0,1,0,-1,0,0,0,0,1,3,9,9,
+         0,0,1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,1,1,0,0,0,6,6,
+         0,-1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,0,6,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         0,1,0,1,0,0,0,0,-1,3,9,9,
+         0,-1,0,-1,0,0,0,0,-1,3,9,9,
+         0,0,1,0,-1,0,1,0,0,3,9,9,
+         0,0,-1,0,-1,0,-1,0,0,3,9,9,
+         -1,0,0,0,0,1,0,1,0,3,9,9,
+         -1,0,0,0,0,-1,0,-1,0,3,9,9,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,0,-1,0,1,0,9,3,9,
+         1,0,0,0,0,1,0,-1,0,9,3,9,
+         0,0,1,0,1,0,-1,0,0,9,3,9,
+         0,0,-1,0,1,0,1,0,0,9,3,9,
+         0,-1,0,1,0,0,0,0,1,9,3,9,
+         0,1,0,-1,0,0,0,0,1,9,3,9,
+         0,0,1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,1,1,0,0,6,0,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,6,0,6,
+         0,1,0,0,0,-1,-1,0,0,6,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         0,1,0,1,0,0,0,0,-1,9,3,9,
+         0,-1,0,-1,0,0,0,0,-1,9,3,9,
+         0,0,1,0,-1,0,1,0,0,9,3,9,
+         0,0,-1,0,-1,0,-1,0,0,9,3,9,
+         -1,0,0,0,0,1,0,1,0,9,3,9,
+         -1,0,0,0,0,-1,0,-1,0,9,3,9,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,0,-1,0,1,0,9,9,3,
+         1,0,0,0,0,1,0,-1,0,9,9,3,
+         0,0,1,0,1,0,-1,0,0,9,9,3,
+         0,0,-1,0,1,0,1,0,0,9,9,3,
+         0,-1,0,1,0,0,0,0,1,9,9,3,
+         0,1,0,-1,0,0,0,0,1,9,9,3,
+         0,0,1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,1,1,0,0,6,6,0,
+         0,-1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,6,6,0,
+         0,0,-1,-1,0,0,0,1,0,6,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,6,0,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,9,9,3,
+         0,-1,0,-1,0,0,0,0,-1,9,9,3,
+         0,0,1,0,-1,0,1,0,0,9,9,3,
+         0,0,-1,0,-1,0,-1,0,0,9,9,3,
+         -1,0,0,0,0,1,0,1,0,9,9,3,
+         -1,0,0,0,0,-1,0,-1,0,9,9,3,
+         // F_4_3_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,0,0,0,
+         1,0,0,0,0,1,0,-1,0,0,0,0,
+         0,0,1,0,1,0,-1,0,0,0,0,0,
+         0,0,-1,0,1,0,1,0,0,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         0,0,1,0,-1,0,1,0,0,0,0,0,
+         0,0,-1,0,-1,0,-1,0,0,0,0,0,
+         -1,0,0,0,0,1,0,1,0,0,0,0,
+         -1,0,0,0,0,-1,0,-1,0,0,0,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,0,-1,0,1,0,0,6,6,
+         1,0,0,0,0,1,0,-1,0,0,6,6,
+         0,0,1,0,1,0,-1,0,0,0,6,6,
+         0,0,-1,0,1,0,1,0,0,0,6,6,
+         0,-1,0,1,0,0,0,0,1,0,6,6,
+         0,1,0,-1,0,0,0,0,1,0,6,6,
+         0,0,1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,1,1,0,0,0,6,6,
+         0,-1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,0,6,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         0,1,0,1,0,0,0,0,-1,0,6,6,
+         0,-1,0,-1,0,0,0,0,-1,0,6,6,
+         0,0,1,0,-1,0,1,0,0,0,6,6,
+         0,0,-1,0,-1,0,-1,0,0,0,6,6,
+         -1,0,0,0,0,1,0,1,0,0,6,6,
+         -1,0,0,0,0,-1,0,-1,0,0,6,6,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,0,-1,0,1,0,6,0,6,
+         1,0,0,0,0,1,0,-1,0,6,0,6,
+         0,0,1,0,1,0,-1,0,0,6,0,6,
+         0,0,-1,0,1,0,1,0,0,6,0,6,
+         0,-1,0,1,0,0,0,0,1,6,0,6,
+         0,1,0,-1,0,0,0,0,1,6,0,6,
+         0,0,1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,1,1,0,0,6,0,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,6,0,6,
+         0,1,0,0,0,-1,-1,0,0,6,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         0,1,0,1,0,0,0,0,-1,6,0,6,
+         0,-1,0,-1,0,0,0,0,-1,6,0,6,
+         0,0,1,0,-1,0,1,0,0,6,0,6,
+         0,0,-1,0,-1,0,-1,0,0,6,0,6,
+         -1,0,0,0,0,1,0,1,0,6,0,6,
+         -1,0,0,0,0,-1,0,-1,0,6,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,0,-1,0,1,0,6,6,0,
+         1,0,0,0,0,1,0,-1,0,6,6,0,
+         0,0,1,0,1,0,-1,0,0,6,6,0,
+         0,0,-1,0,1,0,1,0,0,6,6,0,
+         0,-1,0,1,0,0,0,0,1,6,6,0,
+         0,1,0,-1,0,0,0,0,1,6,6,0,
+         0,0,1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,1,1,0,0,6,6,0,
+         0,-1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,6,6,0,
+         0,0,-1,-1,0,0,0,1,0,6,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,6,0,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,-1,6,6,0,
+         0,0,1,0,-1,0,1,0,0,6,6,0,
+         0,0,-1,0,-1,0,-1,0,0,6,6,0,
+         -1,0,0,0,0,1,0,1,0,6,6,0,
+         -1,0,0,0,0,-1,0,-1,0,6,6,0,
+         // F_d_-3:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,3,3,3,
+         0,0,-1,-1,0,0,0,-1,0,3,3,3,
+         0,-1,0,0,0,-1,-1,0,0,3,3,3,
+         0,1,0,0,0,1,-1,0,0,3,3,3,
+         0,0,-1,1,0,0,0,1,0,3,3,3,
+         0,1,0,0,0,-1,1,0,0,3,3,3,
+         0,0,1,1,0,0,0,-1,0,3,3,3,
+         0,0,1,-1,0,0,0,1,0,3,3,3,
+         0,-1,0,0,0,1,1,0,0,3,3,3,
+         -1,0,0,0,1,0,0,0,1,3,3,3,
+         1,0,0,0,-1,0,0,0,1,3,3,3,
+         1,0,0,0,1,0,0,0,-1,3,3,3,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         0,0,1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,1,1,0,0,0,6,6,
+         0,-1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,0,6,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         -1,0,0,0,-1,0,0,0,-1,3,9,9,
+         0,0,-1,-1,0,0,0,-1,0,3,9,9,
+         0,-1,0,0,0,-1,-1,0,0,3,9,9,
+         0,1,0,0,0,1,-1,0,0,3,9,9,
+         0,0,-1,1,0,0,0,1,0,3,9,9,
+         0,1,0,0,0,-1,1,0,0,3,9,9,
+         0,0,1,1,0,0,0,-1,0,3,9,9,
+         0,0,1,-1,0,0,0,1,0,3,9,9,
+         0,-1,0,0,0,1,1,0,0,3,9,9,
+         -1,0,0,0,1,0,0,0,1,3,9,9,
+         1,0,0,0,-1,0,0,0,1,3,9,9,
+         1,0,0,0,1,0,0,0,-1,3,9,9,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         0,0,1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,1,1,0,0,6,0,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,6,0,6,
+         0,1,0,0,0,-1,-1,0,0,6,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,-1,9,3,9,
+         0,0,-1,-1,0,0,0,-1,0,9,3,9,
+         0,-1,0,0,0,-1,-1,0,0,9,3,9,
+         0,1,0,0,0,1,-1,0,0,9,3,9,
+         0,0,-1,1,0,0,0,1,0,9,3,9,
+         0,1,0,0,0,-1,1,0,0,9,3,9,
+         0,0,1,1,0,0,0,-1,0,9,3,9,
+         0,0,1,-1,0,0,0,1,0,9,3,9,
+         0,-1,0,0,0,1,1,0,0,9,3,9,
+         -1,0,0,0,1,0,0,0,1,9,3,9,
+         1,0,0,0,-1,0,0,0,1,9,3,9,
+         1,0,0,0,1,0,0,0,-1,9,3,9,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         0,0,1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,1,1,0,0,6,6,0,
+         0,-1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,6,6,0,
+         0,0,-1,-1,0,0,0,1,0,6,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,6,0,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,9,9,3,
+         0,0,-1,-1,0,0,0,-1,0,9,9,3,
+         0,-1,0,0,0,-1,-1,0,0,9,9,3,
+         0,1,0,0,0,1,-1,0,0,9,9,3,
+         0,0,-1,1,0,0,0,1,0,9,9,3,
+         0,1,0,0,0,-1,1,0,0,9,9,3,
+         0,0,1,1,0,0,0,-1,0,9,9,3,
+         0,0,1,-1,0,0,0,1,0,9,9,3,
+         0,-1,0,0,0,1,1,0,0,9,9,3,
+         -1,0,0,0,1,0,0,0,1,9,9,3,
+         1,0,0,0,-1,0,0,0,1,9,9,3,
+         1,0,0,0,1,0,0,0,-1,9,9,3,
+         // F_d_-3:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,3,3,0,
+         0,0,1,-1,0,0,0,-1,0,0,3,3,
+         0,-1,0,0,0,1,-1,0,0,3,0,3,
+         0,0,-1,-1,0,0,0,1,0,3,3,0,
+         0,0,-1,1,0,0,0,-1,0,3,0,3,
+         0,1,0,0,0,-1,-1,0,0,0,3,3,
+         1,0,0,0,-1,0,0,0,-1,0,3,3,
+         -1,0,0,0,1,0,0,0,-1,3,0,3,
+         -1,0,0,0,-1,0,0,0,1,3,3,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,-3,-3,0,
+         0,0,-1,1,0,0,0,1,0,0,-3,-3,
+         0,1,0,0,0,-1,1,0,0,-3,0,-3,
+         0,0,1,1,0,0,0,-1,0,-3,-3,0,
+         0,0,1,-1,0,0,0,1,0,-3,0,-3,
+         0,-1,0,0,0,1,1,0,0,0,-3,-3,
+         -1,0,0,0,1,0,0,0,1,0,-3,-3,
+         1,0,0,0,-1,0,0,0,1,-3,0,-3,
+         1,0,0,0,1,0,0,0,-1,-3,-3,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         0,0,1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,1,1,0,0,0,6,6,
+         0,-1,0,0,0,-1,1,0,0,3,9,6,
+         0,0,1,-1,0,0,0,-1,0,0,9,9,
+         0,-1,0,0,0,1,-1,0,0,3,6,9,
+         0,0,-1,-1,0,0,0,1,0,3,9,6,
+         0,0,-1,1,0,0,0,-1,0,3,6,9,
+         0,1,0,0,0,-1,-1,0,0,0,9,9,
+         1,0,0,0,-1,0,0,0,-1,0,9,9,
+         -1,0,0,0,1,0,0,0,-1,3,6,9,
+         -1,0,0,0,-1,0,0,0,1,3,9,6,
+         -1,0,0,0,-1,0,0,0,-1,0,6,6,
+         0,0,-1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,-1,-1,0,0,0,6,6,
+         0,1,0,0,0,1,-1,0,0,-3,3,6,
+         0,0,-1,1,0,0,0,1,0,0,3,3,
+         0,1,0,0,0,-1,1,0,0,-3,6,3,
+         0,0,1,1,0,0,0,-1,0,-3,3,6,
+         0,0,1,-1,0,0,0,1,0,-3,6,3,
+         0,-1,0,0,0,1,1,0,0,0,3,3,
+         -1,0,0,0,1,0,0,0,1,0,3,3,
+         1,0,0,0,-1,0,0,0,1,-3,6,3,
+         1,0,0,0,1,0,0,0,-1,-3,3,6,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         0,0,1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,1,1,0,0,6,0,6,
+         0,-1,0,0,0,-1,1,0,0,9,3,6,
+         0,0,1,-1,0,0,0,-1,0,6,3,9,
+         0,-1,0,0,0,1,-1,0,0,9,0,9,
+         0,0,-1,-1,0,0,0,1,0,9,3,6,
+         0,0,-1,1,0,0,0,-1,0,9,0,9,
+         0,1,0,0,0,-1,-1,0,0,6,3,9,
+         1,0,0,0,-1,0,0,0,-1,6,3,9,
+         -1,0,0,0,1,0,0,0,-1,9,0,9,
+         -1,0,0,0,-1,0,0,0,1,9,3,6,
+         -1,0,0,0,-1,0,0,0,-1,6,0,6,
+         0,0,-1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,-1,-1,0,0,6,0,6,
+         0,1,0,0,0,1,-1,0,0,3,-3,6,
+         0,0,-1,1,0,0,0,1,0,6,-3,3,
+         0,1,0,0,0,-1,1,0,0,3,0,3,
+         0,0,1,1,0,0,0,-1,0,3,-3,6,
+         0,0,1,-1,0,0,0,1,0,3,0,3,
+         0,-1,0,0,0,1,1,0,0,6,-3,3,
+         -1,0,0,0,1,0,0,0,1,6,-3,3,
+         1,0,0,0,-1,0,0,0,1,3,0,3,
+         1,0,0,0,1,0,0,0,-1,3,-3,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         0,0,1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,1,1,0,0,6,6,0,
+         0,-1,0,0,0,-1,1,0,0,9,9,0,
+         0,0,1,-1,0,0,0,-1,0,6,9,3,
+         0,-1,0,0,0,1,-1,0,0,9,6,3,
+         0,0,-1,-1,0,0,0,1,0,9,9,0,
+         0,0,-1,1,0,0,0,-1,0,9,6,3,
+         0,1,0,0,0,-1,-1,0,0,6,9,3,
+         1,0,0,0,-1,0,0,0,-1,6,9,3,
+         -1,0,0,0,1,0,0,0,-1,9,6,3,
+         -1,0,0,0,-1,0,0,0,1,9,9,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         0,0,-1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,-1,-1,0,0,6,6,0,
+         0,1,0,0,0,1,-1,0,0,3,3,0,
+         0,0,-1,1,0,0,0,1,0,6,3,-3,
+         0,1,0,0,0,-1,1,0,0,3,6,-3,
+         0,0,1,1,0,0,0,-1,0,3,3,0,
+         0,0,1,-1,0,0,0,1,0,3,6,-3,
+         0,-1,0,0,0,1,1,0,0,6,3,-3,
+         -1,0,0,0,1,0,0,0,1,6,3,-3,
+         1,0,0,0,-1,0,0,0,1,3,6,-3,
+         1,0,0,0,1,0,0,0,-1,3,3,0,
+         // F_d_-3_c:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,3,3,3,
+         1,0,0,0,0,1,0,-1,0,3,3,3,
+         0,0,1,0,1,0,-1,0,0,3,3,3,
+         0,0,-1,0,1,0,1,0,0,3,3,3,
+         0,-1,0,1,0,0,0,0,1,3,3,3,
+         0,1,0,-1,0,0,0,0,1,3,3,3,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,3,3,3,
+         0,-1,0,-1,0,0,0,0,-1,3,3,3,
+         0,0,1,0,-1,0,1,0,0,3,3,3,
+         0,0,-1,0,-1,0,-1,0,0,3,3,3,
+         -1,0,0,0,0,1,0,1,0,3,3,3,
+         -1,0,0,0,0,-1,0,-1,0,3,3,3,
+         -1,0,0,0,-1,0,0,0,-1,3,3,9,
+         -1,0,0,0,0,1,0,-1,0,0,0,6,
+         -1,0,0,0,0,-1,0,1,0,0,0,6,
+         0,0,-1,0,-1,0,1,0,0,0,0,6,
+         0,0,1,0,-1,0,-1,0,0,0,0,6,
+         0,1,0,-1,0,0,0,0,-1,0,0,6,
+         0,-1,0,1,0,0,0,0,-1,0,0,6,
+         0,0,-1,-1,0,0,0,-1,0,3,3,9,
+         0,-1,0,0,0,-1,-1,0,0,3,3,9,
+         0,1,0,0,0,1,-1,0,0,3,3,9,
+         0,0,-1,1,0,0,0,1,0,3,3,9,
+         0,1,0,0,0,-1,1,0,0,3,3,9,
+         0,0,1,1,0,0,0,-1,0,3,3,9,
+         0,0,1,-1,0,0,0,1,0,3,3,9,
+         0,-1,0,0,0,1,1,0,0,3,3,9,
+         -1,0,0,0,1,0,0,0,1,3,3,9,
+         1,0,0,0,-1,0,0,0,1,3,3,9,
+         1,0,0,0,1,0,0,0,-1,3,3,9,
+         0,-1,0,-1,0,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,1,0,0,6,
+         0,0,-1,0,1,0,-1,0,0,0,0,6,
+         0,0,1,0,1,0,1,0,0,0,0,6,
+         1,0,0,0,0,-1,0,-1,0,0,0,6,
+         1,0,0,0,0,1,0,1,0,0,0,6,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,0,-1,0,1,0,3,9,9,
+         1,0,0,0,0,1,0,-1,0,3,9,9,
+         0,0,1,0,1,0,-1,0,0,3,9,9,
+         0,0,-1,0,1,0,1,0,0,3,9,9,
+         0,-1,0,1,0,0,0,0,1,3,9,9,
+         0,1,0,-1,0,0,0,0,1,3,9,9,
+         0,0,1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,1,1,0,0,0,6,6,
+         0,-1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,0,6,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         0,1,0,1,0,0,0,0,-1,3,9,9,
+         0,-1,0,-1,0,0,0,0,-1,3,9,9,
+         0,0,1,0,-1,0,1,0,0,3,9,9,
+         0,0,-1,0,-1,0,-1,0,0,3,9,9,
+         -1,0,0,0,0,1,0,1,0,3,9,9,
+         -1,0,0,0,0,-1,0,-1,0,3,9,9,
+         -1,0,0,0,-1,0,0,0,-1,3,9,15,
+         -1,0,0,0,0,1,0,-1,0,0,6,0,
+         -1,0,0,0,0,-1,0,1,0,0,6,0,
+         0,0,-1,0,-1,0,1,0,0,0,6,0,
+         0,0,1,0,-1,0,-1,0,0,0,6,0,
+         0,1,0,-1,0,0,0,0,-1,0,6,0,
+         0,-1,0,1,0,0,0,0,-1,0,6,0,
+         0,0,-1,-1,0,0,0,-1,0,3,9,15,
+         0,-1,0,0,0,-1,-1,0,0,3,9,15,
+         0,1,0,0,0,1,-1,0,0,3,9,15,
+         0,0,-1,1,0,0,0,1,0,3,9,15,
+         0,1,0,0,0,-1,1,0,0,3,9,15,
+         0,0,1,1,0,0,0,-1,0,3,9,15,
+         0,0,1,-1,0,0,0,1,0,3,9,15,
+         0,-1,0,0,0,1,1,0,0,3,9,15,
+         -1,0,0,0,1,0,0,0,1,3,9,15,
+         1,0,0,0,-1,0,0,0,1,3,9,15,
+         1,0,0,0,1,0,0,0,-1,3,9,15,
+         0,-1,0,-1,0,0,0,0,1,0,6,0,
+         0,1,0,1,0,0,0,0,1,0,6,0,
+         0,0,-1,0,1,0,-1,0,0,0,6,0,
+         0,0,1,0,1,0,1,0,0,0,6,0,
+         1,0,0,0,0,-1,0,-1,0,0,6,0,
+         1,0,0,0,0,1,0,1,0,0,6,0,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,0,-1,0,1,0,9,3,9,
+         1,0,0,0,0,1,0,-1,0,9,3,9,
+         0,0,1,0,1,0,-1,0,0,9,3,9,
+         0,0,-1,0,1,0,1,0,0,9,3,9,
+         0,-1,0,1,0,0,0,0,1,9,3,9,
+         0,1,0,-1,0,0,0,0,1,9,3,9,
+         0,0,1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,1,1,0,0,6,0,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,6,0,6,
+         0,1,0,0,0,-1,-1,0,0,6,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         0,1,0,1,0,0,0,0,-1,9,3,9,
+         0,-1,0,-1,0,0,0,0,-1,9,3,9,
+         0,0,1,0,-1,0,1,0,0,9,3,9,
+         0,0,-1,0,-1,0,-1,0,0,9,3,9,
+         -1,0,0,0,0,1,0,1,0,9,3,9,
+         -1,0,0,0,0,-1,0,-1,0,9,3,9,
+         -1,0,0,0,-1,0,0,0,-1,9,3,15,
+         -1,0,0,0,0,1,0,-1,0,6,0,0,
+         -1,0,0,0,0,-1,0,1,0,6,0,0,
+         0,0,-1,0,-1,0,1,0,0,6,0,0,
+         0,0,1,0,-1,0,-1,0,0,6,0,0,
+         0,1,0,-1,0,0,0,0,-1,6,0,0,
+         0,-1,0,1,0,0,0,0,-1,6,0,0,
+         0,0,-1,-1,0,0,0,-1,0,9,3,15,
+         0,-1,0,0,0,-1,-1,0,0,9,3,15,
+         0,1,0,0,0,1,-1,0,0,9,3,15,
+         0,0,-1,1,0,0,0,1,0,9,3,15,
+         0,1,0,0,0,-1,1,0,0,9,3,15,
+         0,0,1,1,0,0,0,-1,0,9,3,15,
+         0,0,1,-1,0,0,0,1,0,9,3,15,
+         0,-1,0,0,0,1,1,0,0,9,3,15,
+         -1,0,0,0,1,0,0,0,1,9,3,15,
+         1,0,0,0,-1,0,0,0,1,9,3,15,
+         1,0,0,0,1,0,0,0,-1,9,3,15,
+         0,-1,0,-1,0,0,0,0,1,6,0,0,
+         0,1,0,1,0,0,0,0,1,6,0,0,
+         0,0,-1,0,1,0,-1,0,0,6,0,0,
+         0,0,1,0,1,0,1,0,0,6,0,0,
+         1,0,0,0,0,-1,0,-1,0,6,0,0,
+         1,0,0,0,0,1,0,1,0,6,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,0,-1,0,1,0,9,9,3,
+         1,0,0,0,0,1,0,-1,0,9,9,3,
+         0,0,1,0,1,0,-1,0,0,9,9,3,
+         0,0,-1,0,1,0,1,0,0,9,9,3,
+         0,-1,0,1,0,0,0,0,1,9,9,3,
+         0,1,0,-1,0,0,0,0,1,9,9,3,
+         0,0,1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,1,1,0,0,6,6,0,
+         0,-1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,6,6,0,
+         0,0,-1,-1,0,0,0,1,0,6,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,6,0,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,9,9,3,
+         0,-1,0,-1,0,0,0,0,-1,9,9,3,
+         0,0,1,0,-1,0,1,0,0,9,9,3,
+         0,0,-1,0,-1,0,-1,0,0,9,9,3,
+         -1,0,0,0,0,1,0,1,0,9,9,3,
+         -1,0,0,0,0,-1,0,-1,0,9,9,3,
+         -1,0,0,0,-1,0,0,0,-1,9,9,9,
+         -1,0,0,0,0,1,0,-1,0,6,6,6,
+         -1,0,0,0,0,-1,0,1,0,6,6,6,
+         0,0,-1,0,-1,0,1,0,0,6,6,6,
+         0,0,1,0,-1,0,-1,0,0,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         0,0,-1,-1,0,0,0,-1,0,9,9,9,
+         0,-1,0,0,0,-1,-1,0,0,9,9,9,
+         0,1,0,0,0,1,-1,0,0,9,9,9,
+         0,0,-1,1,0,0,0,1,0,9,9,9,
+         0,1,0,0,0,-1,1,0,0,9,9,9,
+         0,0,1,1,0,0,0,-1,0,9,9,9,
+         0,0,1,-1,0,0,0,1,0,9,9,9,
+         0,-1,0,0,0,1,1,0,0,9,9,9,
+         -1,0,0,0,1,0,0,0,1,9,9,9,
+         1,0,0,0,-1,0,0,0,1,9,9,9,
+         1,0,0,0,1,0,0,0,-1,9,9,9,
+         0,-1,0,-1,0,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,1,6,6,6,
+         0,0,-1,0,1,0,-1,0,0,6,6,6,
+         0,0,1,0,1,0,1,0,0,6,6,6,
+         1,0,0,0,0,-1,0,-1,0,6,6,6,
+         1,0,0,0,0,1,0,1,0,6,6,6,
+         // F_d_-3_c:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,3,0,9,
+         1,0,0,0,0,1,0,-1,0,3,9,0,
+         0,0,1,0,1,0,-1,0,0,3,9,0,
+         0,0,-1,0,1,0,1,0,0,0,3,9,
+         0,-1,0,1,0,0,0,0,1,0,3,9,
+         0,1,0,-1,0,0,0,0,1,3,0,9,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,3,3,0,
+         0,0,1,-1,0,0,0,-1,0,0,3,3,
+         0,-1,0,0,0,1,-1,0,0,3,0,3,
+         0,0,-1,-1,0,0,0,1,0,3,3,0,
+         0,0,-1,1,0,0,0,-1,0,3,0,3,
+         0,1,0,0,0,-1,-1,0,0,0,3,3,
+         1,0,0,0,-1,0,0,0,-1,0,3,3,
+         -1,0,0,0,1,0,0,0,-1,3,0,3,
+         -1,0,0,0,-1,0,0,0,1,3,3,0,
+         0,1,0,1,0,0,0,0,-1,3,9,0,
+         0,-1,0,-1,0,0,0,0,-1,6,0,0,
+         0,0,1,0,-1,0,1,0,0,3,0,9,
+         0,0,-1,0,-1,0,-1,0,0,6,0,0,
+         -1,0,0,0,0,1,0,1,0,0,3,9,
+         -1,0,0,0,0,-1,0,-1,0,6,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,-3,0,-9,
+         -1,0,0,0,0,-1,0,1,0,-3,-9,0,
+         0,0,-1,0,-1,0,1,0,0,-3,-9,0,
+         0,0,1,0,-1,0,-1,0,0,0,-3,-9,
+         0,1,0,-1,0,0,0,0,-1,0,-3,-9,
+         0,-1,0,1,0,0,0,0,-1,-3,0,-9,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,-3,-3,0,
+         0,0,-1,1,0,0,0,1,0,0,-3,-3,
+         0,1,0,0,0,-1,1,0,0,-3,0,-3,
+         0,0,1,1,0,0,0,-1,0,-3,-3,0,
+         0,0,1,-1,0,0,0,1,0,-3,0,-3,
+         0,-1,0,0,0,1,1,0,0,0,-3,-3,
+         -1,0,0,0,1,0,0,0,1,0,-3,-3,
+         1,0,0,0,-1,0,0,0,1,-3,0,-3,
+         1,0,0,0,1,0,0,0,-1,-3,-3,0,
+         0,-1,0,-1,0,0,0,0,1,-3,-9,0,
+         0,1,0,1,0,0,0,0,1,-6,0,0,
+         0,0,-1,0,1,0,-1,0,0,-3,0,-9,
+         0,0,1,0,1,0,1,0,0,-6,0,0,
+         1,0,0,0,0,-1,0,-1,0,0,-3,-9,
+         1,0,0,0,0,1,0,1,0,-6,0,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,0,-1,0,1,0,3,6,15,
+         1,0,0,0,0,1,0,-1,0,3,15,6,
+         0,0,1,0,1,0,-1,0,0,3,15,6,
+         0,0,-1,0,1,0,1,0,0,0,9,15,
+         0,-1,0,1,0,0,0,0,1,0,9,15,
+         0,1,0,-1,0,0,0,0,1,3,6,15,
+         0,0,1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,1,1,0,0,0,6,6,
+         0,-1,0,0,0,-1,1,0,0,3,9,6,
+         0,0,1,-1,0,0,0,-1,0,0,9,9,
+         0,-1,0,0,0,1,-1,0,0,3,6,9,
+         0,0,-1,-1,0,0,0,1,0,3,9,6,
+         0,0,-1,1,0,0,0,-1,0,3,6,9,
+         0,1,0,0,0,-1,-1,0,0,0,9,9,
+         1,0,0,0,-1,0,0,0,-1,0,9,9,
+         -1,0,0,0,1,0,0,0,-1,3,6,9,
+         -1,0,0,0,-1,0,0,0,1,3,9,6,
+         0,1,0,1,0,0,0,0,-1,3,15,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         0,0,1,0,-1,0,1,0,0,3,6,15,
+         0,0,-1,0,-1,0,-1,0,0,6,6,6,
+         -1,0,0,0,0,1,0,1,0,0,9,15,
+         -1,0,0,0,0,-1,0,-1,0,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,0,1,0,-1,0,-3,6,-3,
+         -1,0,0,0,0,-1,0,1,0,-3,-3,6,
+         0,0,-1,0,-1,0,1,0,0,-3,-3,6,
+         0,0,1,0,-1,0,-1,0,0,0,3,-3,
+         0,1,0,-1,0,0,0,0,-1,0,3,-3,
+         0,-1,0,1,0,0,0,0,-1,-3,6,-3,
+         0,0,-1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,-1,-1,0,0,0,6,6,
+         0,1,0,0,0,1,-1,0,0,-3,3,6,
+         0,0,-1,1,0,0,0,1,0,0,3,3,
+         0,1,0,0,0,-1,1,0,0,-3,6,3,
+         0,0,1,1,0,0,0,-1,0,-3,3,6,
+         0,0,1,-1,0,0,0,1,0,-3,6,3,
+         0,-1,0,0,0,1,1,0,0,0,3,3,
+         -1,0,0,0,1,0,0,0,1,0,3,3,
+         1,0,0,0,-1,0,0,0,1,-3,6,3,
+         1,0,0,0,1,0,0,0,-1,-3,3,6,
+         0,-1,0,-1,0,0,0,0,1,-3,-3,6,
+         0,1,0,1,0,0,0,0,1,-6,6,6,
+         0,0,-1,0,1,0,-1,0,0,-3,6,-3,
+         0,0,1,0,1,0,1,0,0,-6,6,6,
+         1,0,0,0,0,-1,0,-1,0,0,3,-3,
+         1,0,0,0,0,1,0,1,0,-6,6,6,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,0,-1,0,1,0,9,0,15,
+         1,0,0,0,0,1,0,-1,0,9,9,6,
+         0,0,1,0,1,0,-1,0,0,9,9,6,
+         0,0,-1,0,1,0,1,0,0,6,3,15,
+         0,-1,0,1,0,0,0,0,1,6,3,15,
+         0,1,0,-1,0,0,0,0,1,9,0,15,
+         0,0,1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,1,1,0,0,6,0,6,
+         0,-1,0,0,0,-1,1,0,0,9,3,6,
+         0,0,1,-1,0,0,0,-1,0,6,3,9,
+         0,-1,0,0,0,1,-1,0,0,9,0,9,
+         0,0,-1,-1,0,0,0,1,0,9,3,6,
+         0,0,-1,1,0,0,0,-1,0,9,0,9,
+         0,1,0,0,0,-1,-1,0,0,6,3,9,
+         1,0,0,0,-1,0,0,0,-1,6,3,9,
+         -1,0,0,0,1,0,0,0,-1,9,0,9,
+         -1,0,0,0,-1,0,0,0,1,9,3,6,
+         0,1,0,1,0,0,0,0,-1,9,9,6,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         0,0,1,0,-1,0,1,0,0,9,0,15,
+         0,0,-1,0,-1,0,-1,0,0,0,0,6,
+         -1,0,0,0,0,1,0,1,0,6,3,15,
+         -1,0,0,0,0,-1,0,-1,0,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,0,1,0,-1,0,3,0,-3,
+         -1,0,0,0,0,-1,0,1,0,3,-9,6,
+         0,0,-1,0,-1,0,1,0,0,3,-9,6,
+         0,0,1,0,-1,0,-1,0,0,6,-3,-3,
+         0,1,0,-1,0,0,0,0,-1,6,-3,-3,
+         0,-1,0,1,0,0,0,0,-1,3,0,-3,
+         0,0,-1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,-1,-1,0,0,6,0,6,
+         0,1,0,0,0,1,-1,0,0,3,-3,6,
+         0,0,-1,1,0,0,0,1,0,6,-3,3,
+         0,1,0,0,0,-1,1,0,0,3,0,3,
+         0,0,1,1,0,0,0,-1,0,3,-3,6,
+         0,0,1,-1,0,0,0,1,0,3,0,3,
+         0,-1,0,0,0,1,1,0,0,6,-3,3,
+         -1,0,0,0,1,0,0,0,1,6,-3,3,
+         1,0,0,0,-1,0,0,0,1,3,0,3,
+         1,0,0,0,1,0,0,0,-1,3,-3,6,
+         0,-1,0,-1,0,0,0,0,1,3,-9,6,
+         0,1,0,1,0,0,0,0,1,0,0,6,
+         0,0,-1,0,1,0,-1,0,0,3,0,-3,
+         0,0,1,0,1,0,1,0,0,0,0,6,
+         1,0,0,0,0,-1,0,-1,0,6,-3,-3,
+         1,0,0,0,0,1,0,1,0,0,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,0,-1,0,1,0,9,6,9,
+         1,0,0,0,0,1,0,-1,0,9,15,0,
+         0,0,1,0,1,0,-1,0,0,9,15,0,
+         0,0,-1,0,1,0,1,0,0,6,9,9,
+         0,-1,0,1,0,0,0,0,1,6,9,9,
+         0,1,0,-1,0,0,0,0,1,9,6,9,
+         0,0,1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,1,1,0,0,6,6,0,
+         0,-1,0,0,0,-1,1,0,0,9,9,0,
+         0,0,1,-1,0,0,0,-1,0,6,9,3,
+         0,-1,0,0,0,1,-1,0,0,9,6,3,
+         0,0,-1,-1,0,0,0,1,0,9,9,0,
+         0,0,-1,1,0,0,0,-1,0,9,6,3,
+         0,1,0,0,0,-1,-1,0,0,6,9,3,
+         1,0,0,0,-1,0,0,0,-1,6,9,3,
+         -1,0,0,0,1,0,0,0,-1,9,6,3,
+         -1,0,0,0,-1,0,0,0,1,9,9,0,
+         0,1,0,1,0,0,0,0,-1,9,15,0,
+         0,-1,0,-1,0,0,0,0,-1,0,6,0,
+         0,0,1,0,-1,0,1,0,0,9,6,9,
+         0,0,-1,0,-1,0,-1,0,0,0,6,0,
+         -1,0,0,0,0,1,0,1,0,6,9,9,
+         -1,0,0,0,0,-1,0,-1,0,0,6,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,0,1,0,-1,0,3,6,-9,
+         -1,0,0,0,0,-1,0,1,0,3,-3,0,
+         0,0,-1,0,-1,0,1,0,0,3,-3,0,
+         0,0,1,0,-1,0,-1,0,0,6,3,-9,
+         0,1,0,-1,0,0,0,0,-1,6,3,-9,
+         0,-1,0,1,0,0,0,0,-1,3,6,-9,
+         0,0,-1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,-1,-1,0,0,6,6,0,
+         0,1,0,0,0,1,-1,0,0,3,3,0,
+         0,0,-1,1,0,0,0,1,0,6,3,-3,
+         0,1,0,0,0,-1,1,0,0,3,6,-3,
+         0,0,1,1,0,0,0,-1,0,3,3,0,
+         0,0,1,-1,0,0,0,1,0,3,6,-3,
+         0,-1,0,0,0,1,1,0,0,6,3,-3,
+         -1,0,0,0,1,0,0,0,1,6,3,-3,
+         1,0,0,0,-1,0,0,0,1,3,6,-3,
+         1,0,0,0,1,0,0,0,-1,3,3,0,
+         0,-1,0,-1,0,0,0,0,1,3,-3,0,
+         0,1,0,1,0,0,0,0,1,0,6,0,
+         0,0,-1,0,1,0,-1,0,0,3,6,-9,
+         0,0,1,0,1,0,1,0,0,0,6,0,
+         1,0,0,0,0,-1,0,-1,0,6,3,-9,
+         1,0,0,0,0,1,0,1,0,0,6,0,
+         // F_d_-3_m:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,3,3,3,
+         1,0,0,0,0,1,0,-1,0,3,3,3,
+         0,0,1,0,1,0,-1,0,0,3,3,3,
+         0,0,-1,0,1,0,1,0,0,3,3,3,
+         0,-1,0,1,0,0,0,0,1,3,3,3,
+         0,1,0,-1,0,0,0,0,1,3,3,3,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,3,3,3,
+         0,-1,0,-1,0,0,0,0,-1,3,3,3,
+         0,0,1,0,-1,0,1,0,0,3,3,3,
+         0,0,-1,0,-1,0,-1,0,0,3,3,3,
+         -1,0,0,0,0,1,0,1,0,3,3,3,
+         -1,0,0,0,0,-1,0,-1,0,3,3,3,
+         -1,0,0,0,-1,0,0,0,-1,3,3,3,
+         -1,0,0,0,0,1,0,-1,0,0,0,0,
+         -1,0,0,0,0,-1,0,1,0,0,0,0,
+         0,0,-1,0,-1,0,1,0,0,0,0,0,
+         0,0,1,0,-1,0,-1,0,0,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         0,0,-1,-1,0,0,0,-1,0,3,3,3,
+         0,-1,0,0,0,-1,-1,0,0,3,3,3,
+         0,1,0,0,0,1,-1,0,0,3,3,3,
+         0,0,-1,1,0,0,0,1,0,3,3,3,
+         0,1,0,0,0,-1,1,0,0,3,3,3,
+         0,0,1,1,0,0,0,-1,0,3,3,3,
+         0,0,1,-1,0,0,0,1,0,3,3,3,
+         0,-1,0,0,0,1,1,0,0,3,3,3,
+         -1,0,0,0,1,0,0,0,1,3,3,3,
+         1,0,0,0,-1,0,0,0,1,3,3,3,
+         1,0,0,0,1,0,0,0,-1,3,3,3,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         0,0,-1,0,1,0,-1,0,0,0,0,0,
+         0,0,1,0,1,0,1,0,0,0,0,0,
+         1,0,0,0,0,-1,0,-1,0,0,0,0,
+         1,0,0,0,0,1,0,1,0,0,0,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,0,-1,0,1,0,3,9,9,
+         1,0,0,0,0,1,0,-1,0,3,9,9,
+         0,0,1,0,1,0,-1,0,0,3,9,9,
+         0,0,-1,0,1,0,1,0,0,3,9,9,
+         0,-1,0,1,0,0,0,0,1,3,9,9,
+         0,1,0,-1,0,0,0,0,1,3,9,9,
+         0,0,1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,1,1,0,0,0,6,6,
+         0,-1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,0,6,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         0,1,0,1,0,0,0,0,-1,3,9,9,
+         0,-1,0,-1,0,0,0,0,-1,3,9,9,
+         0,0,1,0,-1,0,1,0,0,3,9,9,
+         0,0,-1,0,-1,0,-1,0,0,3,9,9,
+         -1,0,0,0,0,1,0,1,0,3,9,9,
+         -1,0,0,0,0,-1,0,-1,0,3,9,9,
+         -1,0,0,0,-1,0,0,0,-1,3,9,9,
+         -1,0,0,0,0,1,0,-1,0,0,6,6,
+         -1,0,0,0,0,-1,0,1,0,0,6,6,
+         0,0,-1,0,-1,0,1,0,0,0,6,6,
+         0,0,1,0,-1,0,-1,0,0,0,6,6,
+         0,1,0,-1,0,0,0,0,-1,0,6,6,
+         0,-1,0,1,0,0,0,0,-1,0,6,6,
+         0,0,-1,-1,0,0,0,-1,0,3,9,9,
+         0,-1,0,0,0,-1,-1,0,0,3,9,9,
+         0,1,0,0,0,1,-1,0,0,3,9,9,
+         0,0,-1,1,0,0,0,1,0,3,9,9,
+         0,1,0,0,0,-1,1,0,0,3,9,9,
+         0,0,1,1,0,0,0,-1,0,3,9,9,
+         0,0,1,-1,0,0,0,1,0,3,9,9,
+         0,-1,0,0,0,1,1,0,0,3,9,9,
+         -1,0,0,0,1,0,0,0,1,3,9,9,
+         1,0,0,0,-1,0,0,0,1,3,9,9,
+         1,0,0,0,1,0,0,0,-1,3,9,9,
+         0,-1,0,-1,0,0,0,0,1,0,6,6,
+         0,1,0,1,0,0,0,0,1,0,6,6,
+         0,0,-1,0,1,0,-1,0,0,0,6,6,
+         0,0,1,0,1,0,1,0,0,0,6,6,
+         1,0,0,0,0,-1,0,-1,0,0,6,6,
+         1,0,0,0,0,1,0,1,0,0,6,6,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,0,-1,0,1,0,9,3,9,
+         1,0,0,0,0,1,0,-1,0,9,3,9,
+         0,0,1,0,1,0,-1,0,0,9,3,9,
+         0,0,-1,0,1,0,1,0,0,9,3,9,
+         0,-1,0,1,0,0,0,0,1,9,3,9,
+         0,1,0,-1,0,0,0,0,1,9,3,9,
+         0,0,1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,1,1,0,0,6,0,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,6,0,6,
+         0,1,0,0,0,-1,-1,0,0,6,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         0,1,0,1,0,0,0,0,-1,9,3,9,
+         0,-1,0,-1,0,0,0,0,-1,9,3,9,
+         0,0,1,0,-1,0,1,0,0,9,3,9,
+         0,0,-1,0,-1,0,-1,0,0,9,3,9,
+         -1,0,0,0,0,1,0,1,0,9,3,9,
+         -1,0,0,0,0,-1,0,-1,0,9,3,9,
+         -1,0,0,0,-1,0,0,0,-1,9,3,9,
+         -1,0,0,0,0,1,0,-1,0,6,0,6,
+         -1,0,0,0,0,-1,0,1,0,6,0,6,
+         0,0,-1,0,-1,0,1,0,0,6,0,6,
+         0,0,1,0,-1,0,-1,0,0,6,0,6,
+         0,1,0,-1,0,0,0,0,-1,6,0,6,
+         0,-1,0,1,0,0,0,0,-1,6,0,6,
+         0,0,-1,-1,0,0,0,-1,0,9,3,9,
+         0,-1,0,0,0,-1,-1,0,0,9,3,9,
+         0,1,0,0,0,1,-1,0,0,9,3,9,
+         0,0,-1,1,0,0,0,1,0,9,3,9,
+         0,1,0,0,0,-1,1,0,0,9,3,9,
+         0,0,1,1,0,0,0,-1,0,9,3,9,
+         0,0,1,-1,0,0,0,1,0,9,3,9,
+         0,-1,0,0,0,1,1,0,0,9,3,9,
+         -1,0,0,0,1,0,0,0,1,9,3,9,
+         1,0,0,0,-1,0,0,0,1,9,3,9,
+         1,0,0,0,1,0,0,0,-1,9,3,9,
+         0,-1,0,-1,0,0,0,0,1,6,0,6,
+         0,1,0,1,0,0,0,0,1,6,0,6,
+         0,0,-1,0,1,0,-1,0,0,6,0,6,
+         0,0,1,0,1,0,1,0,0,6,0,6,
+         1,0,0,0,0,-1,0,-1,0,6,0,6,
+         1,0,0,0,0,1,0,1,0,6,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,0,-1,0,1,0,9,9,3,
+         1,0,0,0,0,1,0,-1,0,9,9,3,
+         0,0,1,0,1,0,-1,0,0,9,9,3,
+         0,0,-1,0,1,0,1,0,0,9,9,3,
+         0,-1,0,1,0,0,0,0,1,9,9,3,
+         0,1,0,-1,0,0,0,0,1,9,9,3,
+         0,0,1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,1,1,0,0,6,6,0,
+         0,-1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,6,6,0,
+         0,0,-1,-1,0,0,0,1,0,6,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,6,0,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,9,9,3,
+         0,-1,0,-1,0,0,0,0,-1,9,9,3,
+         0,0,1,0,-1,0,1,0,0,9,9,3,
+         0,0,-1,0,-1,0,-1,0,0,9,9,3,
+         -1,0,0,0,0,1,0,1,0,9,9,3,
+         -1,0,0,0,0,-1,0,-1,0,9,9,3,
+         -1,0,0,0,-1,0,0,0,-1,9,9,3,
+         -1,0,0,0,0,1,0,-1,0,6,6,0,
+         -1,0,0,0,0,-1,0,1,0,6,6,0,
+         0,0,-1,0,-1,0,1,0,0,6,6,0,
+         0,0,1,0,-1,0,-1,0,0,6,6,0,
+         0,1,0,-1,0,0,0,0,-1,6,6,0,
+         0,-1,0,1,0,0,0,0,-1,6,6,0,
+         0,0,-1,-1,0,0,0,-1,0,9,9,3,
+         0,-1,0,0,0,-1,-1,0,0,9,9,3,
+         0,1,0,0,0,1,-1,0,0,9,9,3,
+         0,0,-1,1,0,0,0,1,0,9,9,3,
+         0,1,0,0,0,-1,1,0,0,9,9,3,
+         0,0,1,1,0,0,0,-1,0,9,9,3,
+         0,0,1,-1,0,0,0,1,0,9,9,3,
+         0,-1,0,0,0,1,1,0,0,9,9,3,
+         -1,0,0,0,1,0,0,0,1,9,9,3,
+         1,0,0,0,-1,0,0,0,1,9,9,3,
+         1,0,0,0,1,0,0,0,-1,9,9,3,
+         0,-1,0,-1,0,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,1,6,6,0,
+         0,0,-1,0,1,0,-1,0,0,6,6,0,
+         0,0,1,0,1,0,1,0,0,6,6,0,
+         1,0,0,0,0,-1,0,-1,0,6,6,0,
+         1,0,0,0,0,1,0,1,0,6,6,0,
+         // F_d_-3_m:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,3,0,3,
+         1,0,0,0,0,1,0,-1,0,3,3,0,
+         0,0,1,0,1,0,-1,0,0,3,3,0,
+         0,0,-1,0,1,0,1,0,0,0,3,3,
+         0,-1,0,1,0,0,0,0,1,0,3,3,
+         0,1,0,-1,0,0,0,0,1,3,0,3,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,3,3,0,
+         0,0,1,-1,0,0,0,-1,0,0,3,3,
+         0,-1,0,0,0,1,-1,0,0,3,0,3,
+         0,0,-1,-1,0,0,0,1,0,3,3,0,
+         0,0,-1,1,0,0,0,-1,0,3,0,3,
+         0,1,0,0,0,-1,-1,0,0,0,3,3,
+         1,0,0,0,-1,0,0,0,-1,0,3,3,
+         -1,0,0,0,1,0,0,0,-1,3,0,3,
+         -1,0,0,0,-1,0,0,0,1,3,3,0,
+         0,1,0,1,0,0,0,0,-1,3,3,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         0,0,1,0,-1,0,1,0,0,3,0,3,
+         0,0,-1,0,-1,0,-1,0,0,0,0,0,
+         -1,0,0,0,0,1,0,1,0,0,3,3,
+         -1,0,0,0,0,-1,0,-1,0,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,-3,0,-3,
+         -1,0,0,0,0,-1,0,1,0,-3,-3,0,
+         0,0,-1,0,-1,0,1,0,0,-3,-3,0,
+         0,0,1,0,-1,0,-1,0,0,0,-3,-3,
+         0,1,0,-1,0,0,0,0,-1,0,-3,-3,
+         0,-1,0,1,0,0,0,0,-1,-3,0,-3,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,-3,-3,0,
+         0,0,-1,1,0,0,0,1,0,0,-3,-3,
+         0,1,0,0,0,-1,1,0,0,-3,0,-3,
+         0,0,1,1,0,0,0,-1,0,-3,-3,0,
+         0,0,1,-1,0,0,0,1,0,-3,0,-3,
+         0,-1,0,0,0,1,1,0,0,0,-3,-3,
+         -1,0,0,0,1,0,0,0,1,0,-3,-3,
+         1,0,0,0,-1,0,0,0,1,-3,0,-3,
+         1,0,0,0,1,0,0,0,-1,-3,-3,0,
+         0,-1,0,-1,0,0,0,0,1,-3,-3,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         0,0,-1,0,1,0,-1,0,0,-3,0,-3,
+         0,0,1,0,1,0,1,0,0,0,0,0,
+         1,0,0,0,0,-1,0,-1,0,0,-3,-3,
+         1,0,0,0,0,1,0,1,0,0,0,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,0,-1,0,1,0,3,6,9,
+         1,0,0,0,0,1,0,-1,0,3,9,6,
+         0,0,1,0,1,0,-1,0,0,3,9,6,
+         0,0,-1,0,1,0,1,0,0,0,9,9,
+         0,-1,0,1,0,0,0,0,1,0,9,9,
+         0,1,0,-1,0,0,0,0,1,3,6,9,
+         0,0,1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,1,1,0,0,0,6,6,
+         0,-1,0,0,0,-1,1,0,0,3,9,6,
+         0,0,1,-1,0,0,0,-1,0,0,9,9,
+         0,-1,0,0,0,1,-1,0,0,3,6,9,
+         0,0,-1,-1,0,0,0,1,0,3,9,6,
+         0,0,-1,1,0,0,0,-1,0,3,6,9,
+         0,1,0,0,0,-1,-1,0,0,0,9,9,
+         1,0,0,0,-1,0,0,0,-1,0,9,9,
+         -1,0,0,0,1,0,0,0,-1,3,6,9,
+         -1,0,0,0,-1,0,0,0,1,3,9,6,
+         0,1,0,1,0,0,0,0,-1,3,9,6,
+         0,-1,0,-1,0,0,0,0,-1,0,6,6,
+         0,0,1,0,-1,0,1,0,0,3,6,9,
+         0,0,-1,0,-1,0,-1,0,0,0,6,6,
+         -1,0,0,0,0,1,0,1,0,0,9,9,
+         -1,0,0,0,0,-1,0,-1,0,0,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,0,1,0,-1,0,-3,6,3,
+         -1,0,0,0,0,-1,0,1,0,-3,3,6,
+         0,0,-1,0,-1,0,1,0,0,-3,3,6,
+         0,0,1,0,-1,0,-1,0,0,0,3,3,
+         0,1,0,-1,0,0,0,0,-1,0,3,3,
+         0,-1,0,1,0,0,0,0,-1,-3,6,3,
+         0,0,-1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,-1,-1,0,0,0,6,6,
+         0,1,0,0,0,1,-1,0,0,-3,3,6,
+         0,0,-1,1,0,0,0,1,0,0,3,3,
+         0,1,0,0,0,-1,1,0,0,-3,6,3,
+         0,0,1,1,0,0,0,-1,0,-3,3,6,
+         0,0,1,-1,0,0,0,1,0,-3,6,3,
+         0,-1,0,0,0,1,1,0,0,0,3,3,
+         -1,0,0,0,1,0,0,0,1,0,3,3,
+         1,0,0,0,-1,0,0,0,1,-3,6,3,
+         1,0,0,0,1,0,0,0,-1,-3,3,6,
+         0,-1,0,-1,0,0,0,0,1,-3,3,6,
+         0,1,0,1,0,0,0,0,1,0,6,6,
+         0,0,-1,0,1,0,-1,0,0,-3,6,3,
+         0,0,1,0,1,0,1,0,0,0,6,6,
+         1,0,0,0,0,-1,0,-1,0,0,3,3,
+         1,0,0,0,0,1,0,1,0,0,6,6,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,0,-1,0,1,0,9,0,9,
+         1,0,0,0,0,1,0,-1,0,9,3,6,
+         0,0,1,0,1,0,-1,0,0,9,3,6,
+         0,0,-1,0,1,0,1,0,0,6,3,9,
+         0,-1,0,1,0,0,0,0,1,6,3,9,
+         0,1,0,-1,0,0,0,0,1,9,0,9,
+         0,0,1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,1,1,0,0,6,0,6,
+         0,-1,0,0,0,-1,1,0,0,9,3,6,
+         0,0,1,-1,0,0,0,-1,0,6,3,9,
+         0,-1,0,0,0,1,-1,0,0,9,0,9,
+         0,0,-1,-1,0,0,0,1,0,9,3,6,
+         0,0,-1,1,0,0,0,-1,0,9,0,9,
+         0,1,0,0,0,-1,-1,0,0,6,3,9,
+         1,0,0,0,-1,0,0,0,-1,6,3,9,
+         -1,0,0,0,1,0,0,0,-1,9,0,9,
+         -1,0,0,0,-1,0,0,0,1,9,3,6,
+         0,1,0,1,0,0,0,0,-1,9,3,6,
+         0,-1,0,-1,0,0,0,0,-1,6,0,6,
+         0,0,1,0,-1,0,1,0,0,9,0,9,
+         0,0,-1,0,-1,0,-1,0,0,6,0,6,
+         -1,0,0,0,0,1,0,1,0,6,3,9,
+         -1,0,0,0,0,-1,0,-1,0,6,0,6,
+         -1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,0,1,0,-1,0,3,0,3,
+         -1,0,0,0,0,-1,0,1,0,3,-3,6,
+         0,0,-1,0,-1,0,1,0,0,3,-3,6,
+         0,0,1,0,-1,0,-1,0,0,6,-3,3,
+         0,1,0,-1,0,0,0,0,-1,6,-3,3,
+         0,-1,0,1,0,0,0,0,-1,3,0,3,
+         0,0,-1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,-1,-1,0,0,6,0,6,
+         0,1,0,0,0,1,-1,0,0,3,-3,6,
+         0,0,-1,1,0,0,0,1,0,6,-3,3,
+         0,1,0,0,0,-1,1,0,0,3,0,3,
+         0,0,1,1,0,0,0,-1,0,3,-3,6,
+         0,0,1,-1,0,0,0,1,0,3,0,3,
+         0,-1,0,0,0,1,1,0,0,6,-3,3,
+         -1,0,0,0,1,0,0,0,1,6,-3,3,
+         1,0,0,0,-1,0,0,0,1,3,0,3,
+         1,0,0,0,1,0,0,0,-1,3,-3,6,
+         0,-1,0,-1,0,0,0,0,1,3,-3,6,
+         0,1,0,1,0,0,0,0,1,6,0,6,
+         0,0,-1,0,1,0,-1,0,0,3,0,3,
+         0,0,1,0,1,0,1,0,0,6,0,6,
+         1,0,0,0,0,-1,0,-1,0,6,-3,3,
+         1,0,0,0,0,1,0,1,0,6,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,0,-1,0,1,0,9,6,3,
+         1,0,0,0,0,1,0,-1,0,9,9,0,
+         0,0,1,0,1,0,-1,0,0,9,9,0,
+         0,0,-1,0,1,0,1,0,0,6,9,3,
+         0,-1,0,1,0,0,0,0,1,6,9,3,
+         0,1,0,-1,0,0,0,0,1,9,6,3,
+         0,0,1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,1,1,0,0,6,6,0,
+         0,-1,0,0,0,-1,1,0,0,9,9,0,
+         0,0,1,-1,0,0,0,-1,0,6,9,3,
+         0,-1,0,0,0,1,-1,0,0,9,6,3,
+         0,0,-1,-1,0,0,0,1,0,9,9,0,
+         0,0,-1,1,0,0,0,-1,0,9,6,3,
+         0,1,0,0,0,-1,-1,0,0,6,9,3,
+         1,0,0,0,-1,0,0,0,-1,6,9,3,
+         -1,0,0,0,1,0,0,0,-1,9,6,3,
+         -1,0,0,0,-1,0,0,0,1,9,9,0,
+         0,1,0,1,0,0,0,0,-1,9,9,0,
+         0,-1,0,-1,0,0,0,0,-1,6,6,0,
+         0,0,1,0,-1,0,1,0,0,9,6,3,
+         0,0,-1,0,-1,0,-1,0,0,6,6,0,
+         -1,0,0,0,0,1,0,1,0,6,9,3,
+         -1,0,0,0,0,-1,0,-1,0,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,0,1,0,-1,0,3,6,-3,
+         -1,0,0,0,0,-1,0,1,0,3,3,0,
+         0,0,-1,0,-1,0,1,0,0,3,3,0,
+         0,0,1,0,-1,0,-1,0,0,6,3,-3,
+         0,1,0,-1,0,0,0,0,-1,6,3,-3,
+         0,-1,0,1,0,0,0,0,-1,3,6,-3,
+         0,0,-1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,-1,-1,0,0,6,6,0,
+         0,1,0,0,0,1,-1,0,0,3,3,0,
+         0,0,-1,1,0,0,0,1,0,6,3,-3,
+         0,1,0,0,0,-1,1,0,0,3,6,-3,
+         0,0,1,1,0,0,0,-1,0,3,3,0,
+         0,0,1,-1,0,0,0,1,0,3,6,-3,
+         0,-1,0,0,0,1,1,0,0,6,3,-3,
+         -1,0,0,0,1,0,0,0,1,6,3,-3,
+         1,0,0,0,-1,0,0,0,1,3,6,-3,
+         1,0,0,0,1,0,0,0,-1,3,3,0,
+         0,-1,0,-1,0,0,0,0,1,3,3,0,
+         0,1,0,1,0,0,0,0,1,6,6,0,
+         0,0,-1,0,1,0,-1,0,0,3,6,-3,
+         0,0,1,0,1,0,1,0,0,6,6,0,
+         1,0,0,0,0,-1,0,-1,0,6,3,-3,
+         1,0,0,0,0,1,0,1,0,6,6,0,
+         // F_d_d_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,3,3,3,
+         1,0,0,0,-1,0,0,0,1,3,3,3,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         -1,0,0,0,1,0,0,0,1,3,9,9,
+         1,0,0,0,-1,0,0,0,1,3,9,9,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,1,0,0,0,1,9,3,9,
+         1,0,0,0,-1,0,0,0,1,9,3,9,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,9,9,3,
+         1,0,0,0,-1,0,0,0,1,9,9,3,
+         // F_d_d_d:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,3,3,3,
+         -1,0,0,0,1,0,0,0,1,3,3,3,
+         1,0,0,0,-1,0,0,0,1,3,3,3,
+         1,0,0,0,1,0,0,0,-1,3,3,3,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         -1,0,0,0,-1,0,0,0,-1,3,9,9,
+         -1,0,0,0,1,0,0,0,1,3,9,9,
+         1,0,0,0,-1,0,0,0,1,3,9,9,
+         1,0,0,0,1,0,0,0,-1,3,9,9,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,-1,9,3,9,
+         -1,0,0,0,1,0,0,0,1,9,3,9,
+         1,0,0,0,-1,0,0,0,1,9,3,9,
+         1,0,0,0,1,0,0,0,-1,9,3,9,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,9,9,3,
+         -1,0,0,0,1,0,0,0,1,9,9,3,
+         1,0,0,0,-1,0,0,0,1,9,9,3,
+         1,0,0,0,1,0,0,0,-1,9,9,3,
+         // F_d_d_d:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,3,3,
+         -1,0,0,0,1,0,0,0,-1,3,0,3,
+         -1,0,0,0,-1,0,0,0,1,3,3,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,-3,-3,
+         1,0,0,0,-1,0,0,0,1,-3,0,-3,
+         1,0,0,0,1,0,0,0,-1,-3,-3,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,9,9,
+         -1,0,0,0,1,0,0,0,-1,3,6,9,
+         -1,0,0,0,-1,0,0,0,1,3,9,6,
+         -1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,1,0,3,3,
+         1,0,0,0,-1,0,0,0,1,-3,6,3,
+         1,0,0,0,1,0,0,0,-1,-3,3,6,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,3,9,
+         -1,0,0,0,1,0,0,0,-1,9,0,9,
+         -1,0,0,0,-1,0,0,0,1,9,3,6,
+         -1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,1,6,-3,3,
+         1,0,0,0,-1,0,0,0,1,3,0,3,
+         1,0,0,0,1,0,0,0,-1,3,-3,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,9,3,
+         -1,0,0,0,1,0,0,0,-1,9,6,3,
+         -1,0,0,0,-1,0,0,0,1,9,9,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,3,-3,
+         1,0,0,0,-1,0,0,0,1,3,6,-3,
+         1,0,0,0,1,0,0,0,-1,3,3,0,
+         // F_m_-3
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,1,0,0,0,-1,0,0,0,0,
+         0,0,1,-1,0,0,0,1,0,0,0,0,
+         0,-1,0,0,0,1,1,0,0,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         0,0,1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,1,1,0,0,0,6,6,
+         0,-1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,0,6,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,6,6,
+         0,0,-1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,-1,-1,0,0,0,6,6,
+         0,1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,1,0,0,0,-1,0,0,6,6,
+         0,0,1,-1,0,0,0,1,0,0,6,6,
+         0,-1,0,0,0,1,1,0,0,0,6,6,
+         -1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,1,0,6,6,
+         1,0,0,0,1,0,0,0,-1,0,6,6,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         0,0,1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,1,1,0,0,6,0,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,6,0,6,
+         0,1,0,0,0,-1,-1,0,0,6,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,-1,6,0,6,
+         0,0,-1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,-1,-1,0,0,6,0,6,
+         0,1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,1,0,0,0,-1,0,6,0,6,
+         0,0,1,-1,0,0,0,1,0,6,0,6,
+         0,-1,0,0,0,1,1,0,0,6,0,6,
+         -1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,-1,0,0,0,1,6,0,6,
+         1,0,0,0,1,0,0,0,-1,6,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         0,0,1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,1,1,0,0,6,6,0,
+         0,-1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,6,6,0,
+         0,0,-1,-1,0,0,0,1,0,6,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,6,0,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         0,0,-1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,-1,-1,0,0,6,6,0,
+         0,1,0,0,0,1,-1,0,0,6,6,0,
+         0,0,-1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,1,0,0,0,-1,0,6,6,0,
+         0,0,1,-1,0,0,0,1,0,6,6,0,
+         0,-1,0,0,0,1,1,0,0,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         1,0,0,0,1,0,0,0,-1,6,6,0,
+         // F_m_-3_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,6,0,0,
+         1,0,0,0,0,1,0,-1,0,6,0,0,
+         0,0,1,0,1,0,-1,0,0,6,0,0,
+         0,0,-1,0,1,0,1,0,0,6,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,0,
+         0,1,0,-1,0,0,0,0,1,6,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,6,0,0,
+         0,-1,0,-1,0,0,0,0,-1,6,0,0,
+         0,0,1,0,-1,0,1,0,0,6,0,0,
+         0,0,-1,0,-1,0,-1,0,0,6,0,0,
+         -1,0,0,0,0,1,0,1,0,6,0,0,
+         -1,0,0,0,0,-1,0,-1,0,6,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,-6,0,0,
+         -1,0,0,0,0,-1,0,1,0,-6,0,0,
+         0,0,-1,0,-1,0,1,0,0,-6,0,0,
+         0,0,1,0,-1,0,-1,0,0,-6,0,0,
+         0,1,0,-1,0,0,0,0,-1,-6,0,0,
+         0,-1,0,1,0,0,0,0,-1,-6,0,0,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,1,0,0,0,-1,0,0,0,0,
+         0,0,1,-1,0,0,0,1,0,0,0,0,
+         0,-1,0,0,0,1,1,0,0,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,-6,0,0,
+         0,1,0,1,0,0,0,0,1,-6,0,0,
+         0,0,-1,0,1,0,-1,0,0,-6,0,0,
+         0,0,1,0,1,0,1,0,0,-6,0,0,
+         1,0,0,0,0,-1,0,-1,0,-6,0,0,
+         1,0,0,0,0,1,0,1,0,-6,0,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,0,-1,0,1,0,6,6,6,
+         1,0,0,0,0,1,0,-1,0,6,6,6,
+         0,0,1,0,1,0,-1,0,0,6,6,6,
+         0,0,-1,0,1,0,1,0,0,6,6,6,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         0,0,1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,1,1,0,0,0,6,6,
+         0,-1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,0,6,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         0,0,1,0,-1,0,1,0,0,6,6,6,
+         0,0,-1,0,-1,0,-1,0,0,6,6,6,
+         -1,0,0,0,0,1,0,1,0,6,6,6,
+         -1,0,0,0,0,-1,0,-1,0,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,0,1,0,-1,0,-6,6,6,
+         -1,0,0,0,0,-1,0,1,0,-6,6,6,
+         0,0,-1,0,-1,0,1,0,0,-6,6,6,
+         0,0,1,0,-1,0,-1,0,0,-6,6,6,
+         0,1,0,-1,0,0,0,0,-1,-6,6,6,
+         0,-1,0,1,0,0,0,0,-1,-6,6,6,
+         0,0,-1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,-1,-1,0,0,0,6,6,
+         0,1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,1,0,0,0,-1,0,0,6,6,
+         0,0,1,-1,0,0,0,1,0,0,6,6,
+         0,-1,0,0,0,1,1,0,0,0,6,6,
+         -1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,1,0,6,6,
+         1,0,0,0,1,0,0,0,-1,0,6,6,
+         0,-1,0,-1,0,0,0,0,1,-6,6,6,
+         0,1,0,1,0,0,0,0,1,-6,6,6,
+         0,0,-1,0,1,0,-1,0,0,-6,6,6,
+         0,0,1,0,1,0,1,0,0,-6,6,6,
+         1,0,0,0,0,-1,0,-1,0,-6,6,6,
+         1,0,0,0,0,1,0,1,0,-6,6,6,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,0,-1,0,1,0,0,0,6,
+         1,0,0,0,0,1,0,-1,0,0,0,6,
+         0,0,1,0,1,0,-1,0,0,0,0,6,
+         0,0,-1,0,1,0,1,0,0,0,0,6,
+         0,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,0,0,0,0,1,0,0,6,
+         0,0,1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,1,1,0,0,6,0,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,6,0,6,
+         0,1,0,0,0,-1,-1,0,0,6,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         0,0,1,0,-1,0,1,0,0,0,0,6,
+         0,0,-1,0,-1,0,-1,0,0,0,0,6,
+         -1,0,0,0,0,1,0,1,0,0,0,6,
+         -1,0,0,0,0,-1,0,-1,0,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,0,1,0,-1,0,0,0,6,
+         -1,0,0,0,0,-1,0,1,0,0,0,6,
+         0,0,-1,0,-1,0,1,0,0,0,0,6,
+         0,0,1,0,-1,0,-1,0,0,0,0,6,
+         0,1,0,-1,0,0,0,0,-1,0,0,6,
+         0,-1,0,1,0,0,0,0,-1,0,0,6,
+         0,0,-1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,-1,-1,0,0,6,0,6,
+         0,1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,1,0,0,0,-1,0,6,0,6,
+         0,0,1,-1,0,0,0,1,0,6,0,6,
+         0,-1,0,0,0,1,1,0,0,6,0,6,
+         -1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,-1,0,0,0,1,6,0,6,
+         1,0,0,0,1,0,0,0,-1,6,0,6,
+         0,-1,0,-1,0,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,1,0,0,6,
+         0,0,-1,0,1,0,-1,0,0,0,0,6,
+         0,0,1,0,1,0,1,0,0,0,0,6,
+         1,0,0,0,0,-1,0,-1,0,0,0,6,
+         1,0,0,0,0,1,0,1,0,0,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,0,-1,0,1,0,0,6,0,
+         1,0,0,0,0,1,0,-1,0,0,6,0,
+         0,0,1,0,1,0,-1,0,0,0,6,0,
+         0,0,-1,0,1,0,1,0,0,0,6,0,
+         0,-1,0,1,0,0,0,0,1,0,6,0,
+         0,1,0,-1,0,0,0,0,1,0,6,0,
+         0,0,1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,1,1,0,0,6,6,0,
+         0,-1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,6,6,0,
+         0,0,-1,-1,0,0,0,1,0,6,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,6,0,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,0,6,0,
+         0,-1,0,-1,0,0,0,0,-1,0,6,0,
+         0,0,1,0,-1,0,1,0,0,0,6,0,
+         0,0,-1,0,-1,0,-1,0,0,0,6,0,
+         -1,0,0,0,0,1,0,1,0,0,6,0,
+         -1,0,0,0,0,-1,0,-1,0,0,6,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,0,1,0,-1,0,0,6,0,
+         -1,0,0,0,0,-1,0,1,0,0,6,0,
+         0,0,-1,0,-1,0,1,0,0,0,6,0,
+         0,0,1,0,-1,0,-1,0,0,0,6,0,
+         0,1,0,-1,0,0,0,0,-1,0,6,0,
+         0,-1,0,1,0,0,0,0,-1,0,6,0,
+         0,0,-1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,-1,-1,0,0,6,6,0,
+         0,1,0,0,0,1,-1,0,0,6,6,0,
+         0,0,-1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,1,0,0,0,-1,0,6,6,0,
+         0,0,1,-1,0,0,0,1,0,6,6,0,
+         0,-1,0,0,0,1,1,0,0,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         1,0,0,0,1,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,1,0,6,0,
+         0,1,0,1,0,0,0,0,1,0,6,0,
+         0,0,-1,0,1,0,-1,0,0,0,6,0,
+         0,0,1,0,1,0,1,0,0,0,6,0,
+         1,0,0,0,0,-1,0,-1,0,0,6,0,
+         1,0,0,0,0,1,0,1,0,0,6,0,
+         // F_m_-3_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,0,0,0,
+         1,0,0,0,0,1,0,-1,0,0,0,0,
+         0,0,1,0,1,0,-1,0,0,0,0,0,
+         0,0,-1,0,1,0,1,0,0,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         0,0,1,0,-1,0,1,0,0,0,0,0,
+         0,0,-1,0,-1,0,-1,0,0,0,0,0,
+         -1,0,0,0,0,1,0,1,0,0,0,0,
+         -1,0,0,0,0,-1,0,-1,0,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,0,0,0,
+         -1,0,0,0,0,-1,0,1,0,0,0,0,
+         0,0,-1,0,-1,0,1,0,0,0,0,0,
+         0,0,1,0,-1,0,-1,0,0,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,1,0,0,0,-1,0,0,0,0,
+         0,0,1,-1,0,0,0,1,0,0,0,0,
+         0,-1,0,0,0,1,1,0,0,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         0,0,-1,0,1,0,-1,0,0,0,0,0,
+         0,0,1,0,1,0,1,0,0,0,0,0,
+         1,0,0,0,0,-1,0,-1,0,0,0,0,
+         1,0,0,0,0,1,0,1,0,0,0,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,0,-1,0,1,0,0,6,6,
+         1,0,0,0,0,1,0,-1,0,0,6,6,
+         0,0,1,0,1,0,-1,0,0,0,6,6,
+         0,0,-1,0,1,0,1,0,0,0,6,6,
+         0,-1,0,1,0,0,0,0,1,0,6,6,
+         0,1,0,-1,0,0,0,0,1,0,6,6,
+         0,0,1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,1,1,0,0,0,6,6,
+         0,-1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,0,6,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         0,1,0,1,0,0,0,0,-1,0,6,6,
+         0,-1,0,-1,0,0,0,0,-1,0,6,6,
+         0,0,1,0,-1,0,1,0,0,0,6,6,
+         0,0,-1,0,-1,0,-1,0,0,0,6,6,
+         -1,0,0,0,0,1,0,1,0,0,6,6,
+         -1,0,0,0,0,-1,0,-1,0,0,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,0,1,0,-1,0,0,6,6,
+         -1,0,0,0,0,-1,0,1,0,0,6,6,
+         0,0,-1,0,-1,0,1,0,0,0,6,6,
+         0,0,1,0,-1,0,-1,0,0,0,6,6,
+         0,1,0,-1,0,0,0,0,-1,0,6,6,
+         0,-1,0,1,0,0,0,0,-1,0,6,6,
+         0,0,-1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,-1,-1,0,0,0,6,6,
+         0,1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,1,0,0,0,1,0,0,6,6,
+         0,1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,1,0,0,0,-1,0,0,6,6,
+         0,0,1,-1,0,0,0,1,0,0,6,6,
+         0,-1,0,0,0,1,1,0,0,0,6,6,
+         -1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,1,0,6,6,
+         1,0,0,0,1,0,0,0,-1,0,6,6,
+         0,-1,0,-1,0,0,0,0,1,0,6,6,
+         0,1,0,1,0,0,0,0,1,0,6,6,
+         0,0,-1,0,1,0,-1,0,0,0,6,6,
+         0,0,1,0,1,0,1,0,0,0,6,6,
+         1,0,0,0,0,-1,0,-1,0,0,6,6,
+         1,0,0,0,0,1,0,1,0,0,6,6,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,0,-1,0,1,0,6,0,6,
+         1,0,0,0,0,1,0,-1,0,6,0,6,
+         0,0,1,0,1,0,-1,0,0,6,0,6,
+         0,0,-1,0,1,0,1,0,0,6,0,6,
+         0,-1,0,1,0,0,0,0,1,6,0,6,
+         0,1,0,-1,0,0,0,0,1,6,0,6,
+         0,0,1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,1,1,0,0,6,0,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,6,0,6,
+         0,1,0,0,0,-1,-1,0,0,6,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         0,1,0,1,0,0,0,0,-1,6,0,6,
+         0,-1,0,-1,0,0,0,0,-1,6,0,6,
+         0,0,1,0,-1,0,1,0,0,6,0,6,
+         0,0,-1,0,-1,0,-1,0,0,6,0,6,
+         -1,0,0,0,0,1,0,1,0,6,0,6,
+         -1,0,0,0,0,-1,0,-1,0,6,0,6,
+         -1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,0,1,0,-1,0,6,0,6,
+         -1,0,0,0,0,-1,0,1,0,6,0,6,
+         0,0,-1,0,-1,0,1,0,0,6,0,6,
+         0,0,1,0,-1,0,-1,0,0,6,0,6,
+         0,1,0,-1,0,0,0,0,-1,6,0,6,
+         0,-1,0,1,0,0,0,0,-1,6,0,6,
+         0,0,-1,-1,0,0,0,-1,0,6,0,6,
+         0,-1,0,0,0,-1,-1,0,0,6,0,6,
+         0,1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,1,0,0,0,1,0,6,0,6,
+         0,1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,1,0,0,0,-1,0,6,0,6,
+         0,0,1,-1,0,0,0,1,0,6,0,6,
+         0,-1,0,0,0,1,1,0,0,6,0,6,
+         -1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,-1,0,0,0,1,6,0,6,
+         1,0,0,0,1,0,0,0,-1,6,0,6,
+         0,-1,0,-1,0,0,0,0,1,6,0,6,
+         0,1,0,1,0,0,0,0,1,6,0,6,
+         0,0,-1,0,1,0,-1,0,0,6,0,6,
+         0,0,1,0,1,0,1,0,0,6,0,6,
+         1,0,0,0,0,-1,0,-1,0,6,0,6,
+         1,0,0,0,0,1,0,1,0,6,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,0,-1,0,1,0,6,6,0,
+         1,0,0,0,0,1,0,-1,0,6,6,0,
+         0,0,1,0,1,0,-1,0,0,6,6,0,
+         0,0,-1,0,1,0,1,0,0,6,6,0,
+         0,-1,0,1,0,0,0,0,1,6,6,0,
+         0,1,0,-1,0,0,0,0,1,6,6,0,
+         0,0,1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,1,1,0,0,6,6,0,
+         0,-1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,6,6,0,
+         0,0,-1,-1,0,0,0,1,0,6,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,6,0,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,-1,6,6,0,
+         0,0,1,0,-1,0,1,0,0,6,6,0,
+         0,0,-1,0,-1,0,-1,0,0,6,6,0,
+         -1,0,0,0,0,1,0,1,0,6,6,0,
+         -1,0,0,0,0,-1,0,-1,0,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,0,1,0,-1,0,6,6,0,
+         -1,0,0,0,0,-1,0,1,0,6,6,0,
+         0,0,-1,0,-1,0,1,0,0,6,6,0,
+         0,0,1,0,-1,0,-1,0,0,6,6,0,
+         0,1,0,-1,0,0,0,0,-1,6,6,0,
+         0,-1,0,1,0,0,0,0,-1,6,6,0,
+         0,0,-1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,-1,-1,0,0,6,6,0,
+         0,1,0,0,0,1,-1,0,0,6,6,0,
+         0,0,-1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,1,0,0,0,-1,0,6,6,0,
+         0,0,1,-1,0,0,0,1,0,6,6,0,
+         0,-1,0,0,0,1,1,0,0,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         1,0,0,0,1,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,1,6,6,0,
+         0,0,-1,0,1,0,-1,0,0,6,6,0,
+         0,0,1,0,1,0,1,0,0,6,6,0,
+         1,0,0,0,0,-1,0,-1,0,6,6,0,
+         1,0,0,0,0,1,0,1,0,6,6,0,
+         // F_m_m_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         -1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,1,0,6,6,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,-1,0,0,0,1,6,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         // F_m_m_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,1,0,6,6,
+         1,0,0,0,1,0,0,0,-1,0,6,6,
+         1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,-1,0,0,0,1,6,0,6,
+         1,0,0,0,1,0,0,0,-1,6,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         1,0,0,0,1,0,0,0,-1,6,6,0,
+         // I_-4
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         // I_-4_2_d
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,0,9,
+         -1,0,0,0,1,0,0,0,-1,6,0,9,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,6,0,9,
+         0,1,0,1,0,0,0,0,1,6,0,9,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,15,
+         -1,0,0,0,1,0,0,0,-1,0,6,15,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,0,6,15,
+         0,1,0,1,0,0,0,0,1,0,6,15,
+         // I_-4_2_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,1,6,6,6,
+         // I_-4_3_d
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,3,3,9,
+         -1,0,0,0,0,-1,0,1,0,3,9,9,
+         0,0,-1,0,-1,0,1,0,0,3,9,9,
+         0,0,1,0,-1,0,-1,0,0,3,9,3,
+         0,1,0,-1,0,0,0,0,-1,3,9,3,
+         0,-1,0,1,0,0,0,0,-1,3,3,9,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,6,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,6,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,6,0,
+         0,-1,0,-1,0,0,0,0,1,3,9,9,
+         0,1,0,1,0,0,0,0,1,3,3,3,
+         0,0,-1,0,1,0,-1,0,0,3,3,9,
+         0,0,1,0,1,0,1,0,0,3,3,3,
+         1,0,0,0,0,-1,0,-1,0,3,9,3,
+         1,0,0,0,0,1,0,1,0,3,3,3,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         -1,0,0,0,0,1,0,-1,0,9,9,15,
+         -1,0,0,0,0,-1,0,1,0,9,15,15,
+         0,0,-1,0,-1,0,1,0,0,9,15,15,
+         0,0,1,0,-1,0,-1,0,0,9,15,9,
+         0,1,0,-1,0,0,0,0,-1,9,15,9,
+         0,-1,0,1,0,0,0,0,-1,9,9,15,
+         0,0,1,1,0,0,0,1,0,6,6,6,
+         0,1,0,0,0,1,1,0,0,6,6,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         0,-1,0,-1,0,0,0,0,1,9,15,15,
+         0,1,0,1,0,0,0,0,1,9,9,9,
+         0,0,-1,0,1,0,-1,0,0,9,9,15,
+         0,0,1,0,1,0,1,0,0,9,9,9,
+         1,0,0,0,0,-1,0,-1,0,9,15,9,
+         1,0,0,0,0,1,0,1,0,9,9,9,
+         // I_-4_3_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,0,0,0,
+         -1,0,0,0,0,-1,0,1,0,0,0,0,
+         0,0,-1,0,-1,0,1,0,0,0,0,0,
+         0,0,1,0,-1,0,-1,0,0,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         0,0,-1,0,1,0,-1,0,0,0,0,0,
+         0,0,1,0,1,0,1,0,0,0,0,0,
+         1,0,0,0,0,-1,0,-1,0,0,0,0,
+         1,0,0,0,0,1,0,1,0,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         -1,0,0,0,0,1,0,-1,0,6,6,6,
+         -1,0,0,0,0,-1,0,1,0,6,6,6,
+         0,0,-1,0,-1,0,1,0,0,6,6,6,
+         0,0,1,0,-1,0,-1,0,0,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         0,0,1,1,0,0,0,1,0,6,6,6,
+         0,1,0,0,0,1,1,0,0,6,6,6,
+         0,-1,0,0,0,-1,1,0,0,6,6,6,
+         0,0,1,-1,0,0,0,-1,0,6,6,6,
+         0,-1,0,0,0,1,-1,0,0,6,6,6,
+         0,0,-1,-1,0,0,0,1,0,6,6,6,
+         0,0,-1,1,0,0,0,-1,0,6,6,6,
+         0,1,0,0,0,-1,-1,0,0,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,1,6,6,6,
+         0,0,-1,0,1,0,-1,0,0,6,6,6,
+         0,0,1,0,1,0,1,0,0,6,6,6,
+         1,0,0,0,0,-1,0,-1,0,6,6,6,
+         1,0,0,0,0,1,0,1,0,6,6,6,
+         // I_-4_c_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         // I_-4_m_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         // I_21_21_21
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,6,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         // I_21_3
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,6,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,6,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,6,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,0,1,1,0,0,0,1,0,6,6,6,
+         0,1,0,0,0,1,1,0,0,6,6,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         // I_2_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         // I_2_3
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,0,1,1,0,0,0,1,0,6,6,6,
+         0,1,0,0,0,1,1,0,0,6,6,6,
+         0,-1,0,0,0,-1,1,0,0,6,6,6,
+         0,0,1,-1,0,0,0,-1,0,6,6,6,
+         0,-1,0,0,0,1,-1,0,0,6,6,6,
+         0,0,-1,-1,0,0,0,1,0,6,6,6,
+         0,0,-1,1,0,0,0,-1,0,6,6,6,
+         0,1,0,0,0,-1,-1,0,0,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         // I_4
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         // I_4%m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         // I_4%m_c_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,-6,
+         1,0,0,0,-1,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,-6,
+         0,1,0,1,0,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,1,6,6,0,
+         // I_4%m_m_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,1,6,6,6,
+         // I_41
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,9,
+         0,1,0,-1,0,0,0,0,1,6,0,9,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,0,6,15,
+         0,1,0,-1,0,0,0,0,1,0,6,15,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         // I_41%a:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,9,
+         0,1,0,-1,0,0,0,0,1,6,0,9,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,6,0,9,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,6,0,9,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,0,6,15,
+         0,1,0,-1,0,0,0,0,1,0,6,15,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,6,15,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         1,0,0,0,1,0,0,0,-1,0,6,15,
+         // I_41%a:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,3,9,9,
+         0,1,0,-1,0,0,0,0,1,3,3,3,
+         -1,0,0,0,-1,0,0,0,1,0,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,-3,-9,-9,
+         0,-1,0,1,0,0,0,0,-1,-3,-3,-3,
+         1,0,0,0,1,0,0,0,-1,0,-6,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,9,15,15,
+         0,1,0,-1,0,0,0,0,1,9,9,9,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,3,-3,-3,
+         0,-1,0,1,0,0,0,0,-1,3,3,3,
+         1,0,0,0,1,0,0,0,-1,6,0,6,
+         // I_41%a_c_d:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,9,
+         0,1,0,-1,0,0,0,0,1,6,0,9,
+         1,0,0,0,-1,0,0,0,-1,6,0,3,
+         -1,0,0,0,1,0,0,0,-1,6,0,3,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,6,0,9,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         1,0,0,0,1,0,0,0,-1,6,0,9,
+         0,-1,0,-1,0,0,0,0,1,6,0,3,
+         0,1,0,1,0,0,0,0,1,6,0,3,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,0,6,15,
+         0,1,0,-1,0,0,0,0,1,0,6,15,
+         1,0,0,0,-1,0,0,0,-1,0,6,9,
+         -1,0,0,0,1,0,0,0,-1,0,6,9,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,6,15,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         1,0,0,0,1,0,0,0,-1,0,6,15,
+         0,-1,0,-1,0,0,0,0,1,0,6,9,
+         0,1,0,1,0,0,0,0,1,0,6,9,
+         // I_41%a_c_d:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,3,9,3,
+         0,1,0,-1,0,0,0,0,1,3,3,9,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,6,0,
+         0,1,0,1,0,0,0,0,-1,3,9,9,
+         0,-1,0,-1,0,0,0,0,-1,3,3,3,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,-3,-9,-3,
+         0,-1,0,1,0,0,0,0,-1,-3,-3,-9,
+         -1,0,0,0,1,0,0,0,1,0,0,-6,
+         1,0,0,0,-1,0,0,0,1,-6,0,0,
+         1,0,0,0,1,0,0,0,-1,0,-6,0,
+         0,-1,0,-1,0,0,0,0,1,-3,-9,-9,
+         0,1,0,1,0,0,0,0,1,-3,-3,-3,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,9,15,9,
+         0,1,0,-1,0,0,0,0,1,9,9,15,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         0,1,0,1,0,0,0,0,-1,9,15,15,
+         0,-1,0,-1,0,0,0,0,-1,9,9,9,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,3,-3,3,
+         0,-1,0,1,0,0,0,0,-1,3,3,-3,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,0,6,6,
+         1,0,0,0,1,0,0,0,-1,6,0,6,
+         0,-1,0,-1,0,0,0,0,1,3,-3,-3,
+         0,1,0,1,0,0,0,0,1,3,3,3,
+         // I_41%a_m_d:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,9,
+         0,1,0,-1,0,0,0,0,1,6,0,9,
+         1,0,0,0,-1,0,0,0,-1,6,0,9,
+         -1,0,0,0,1,0,0,0,-1,6,0,9,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,6,0,9,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,6,0,9,
+         0,-1,0,-1,0,0,0,0,1,6,0,9,
+         0,1,0,1,0,0,0,0,1,6,0,9,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,0,6,15,
+         0,1,0,-1,0,0,0,0,1,0,6,15,
+         1,0,0,0,-1,0,0,0,-1,0,6,15,
+         -1,0,0,0,1,0,0,0,-1,0,6,15,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,6,15,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         1,0,0,0,1,0,0,0,-1,0,6,15,
+         0,-1,0,-1,0,0,0,0,1,0,6,15,
+         0,1,0,1,0,0,0,0,1,0,6,15,
+         // I_41%a_m_d:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,3,9,3,
+         0,1,0,-1,0,0,0,0,1,3,3,9,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,0,
+         -1,0,0,0,-1,0,0,0,1,0,6,0,
+         0,1,0,1,0,0,0,0,-1,3,9,3,
+         0,-1,0,-1,0,0,0,0,-1,3,3,9,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,-3,-9,-3,
+         0,-1,0,1,0,0,0,0,-1,-3,-3,-9,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,-6,0,
+         1,0,0,0,1,0,0,0,-1,0,-6,0,
+         0,-1,0,-1,0,0,0,0,1,-3,-9,-3,
+         0,1,0,1,0,0,0,0,1,-3,-3,-9,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,9,15,9,
+         0,1,0,-1,0,0,0,0,1,9,9,15,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         0,1,0,1,0,0,0,0,-1,9,15,9,
+         0,-1,0,-1,0,0,0,0,-1,9,9,15,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,3,-3,3,
+         0,-1,0,1,0,0,0,0,-1,3,3,-3,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,0,6,
+         1,0,0,0,1,0,0,0,-1,6,0,6,
+         0,-1,0,-1,0,0,0,0,1,3,-3,3,
+         0,1,0,1,0,0,0,0,1,3,3,-3,
+         // I_41_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,9,
+         0,1,0,-1,0,0,0,0,1,6,0,9,
+         1,0,0,0,-1,0,0,0,-1,6,0,9,
+         -1,0,0,0,1,0,0,0,-1,6,0,9,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,0,6,15,
+         0,1,0,-1,0,0,0,0,1,0,6,15,
+         1,0,0,0,-1,0,0,0,-1,0,6,15,
+         -1,0,0,0,1,0,0,0,-1,0,6,15,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         // I_41_3_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,3,3,9,
+         1,0,0,0,0,1,0,-1,0,3,9,9,
+         0,0,1,0,1,0,-1,0,0,3,9,9,
+         0,0,-1,0,1,0,1,0,0,3,9,3,
+         0,-1,0,1,0,0,0,0,1,3,9,3,
+         0,1,0,-1,0,0,0,0,1,3,3,9,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,6,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,6,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,6,0,
+         0,1,0,1,0,0,0,0,-1,3,9,9,
+         0,-1,0,-1,0,0,0,0,-1,3,3,3,
+         0,0,1,0,-1,0,1,0,0,3,3,9,
+         0,0,-1,0,-1,0,-1,0,0,3,3,3,
+         -1,0,0,0,0,1,0,1,0,3,9,3,
+         -1,0,0,0,0,-1,0,-1,0,3,3,3,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,0,-1,0,1,0,9,9,15,
+         1,0,0,0,0,1,0,-1,0,9,15,15,
+         0,0,1,0,1,0,-1,0,0,9,15,15,
+         0,0,-1,0,1,0,1,0,0,9,15,9,
+         0,-1,0,1,0,0,0,0,1,9,15,9,
+         0,1,0,-1,0,0,0,0,1,9,9,15,
+         0,0,1,1,0,0,0,1,0,6,6,6,
+         0,1,0,0,0,1,1,0,0,6,6,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         0,1,0,1,0,0,0,0,-1,9,15,15,
+         0,-1,0,-1,0,0,0,0,-1,9,9,9,
+         0,0,1,0,-1,0,1,0,0,9,9,15,
+         0,0,-1,0,-1,0,-1,0,0,9,9,9,
+         -1,0,0,0,0,1,0,1,0,9,15,9,
+         -1,0,0,0,0,-1,0,-1,0,9,9,9,
+         // I_41_c_d
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,9,
+         0,1,0,-1,0,0,0,0,1,6,0,9,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         0,-1,0,-1,0,0,0,0,1,6,0,3,
+         0,1,0,1,0,0,0,0,1,6,0,3,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,0,6,15,
+         0,1,0,-1,0,0,0,0,1,0,6,15,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,-1,0,-1,0,0,0,0,1,0,6,9,
+         0,1,0,1,0,0,0,0,1,0,6,9,
+         // I_41_m_d
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,9,
+         0,1,0,-1,0,0,0,0,1,6,0,9,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,6,0,9,
+         0,1,0,1,0,0,0,0,1,6,0,9,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,0,6,15,
+         0,1,0,-1,0,0,0,0,1,0,6,15,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,0,6,15,
+         0,1,0,1,0,0,0,0,1,0,6,15,
+         // I_4_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         // I_4_3_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,0,0,0,
+         1,0,0,0,0,1,0,-1,0,0,0,0,
+         0,0,1,0,1,0,-1,0,0,0,0,0,
+         0,0,-1,0,1,0,1,0,0,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         0,0,1,0,-1,0,1,0,0,0,0,0,
+         0,0,-1,0,-1,0,-1,0,0,0,0,0,
+         -1,0,0,0,0,1,0,1,0,0,0,0,
+         -1,0,0,0,0,-1,0,-1,0,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,0,-1,0,1,0,6,6,6,
+         1,0,0,0,0,1,0,-1,0,6,6,6,
+         0,0,1,0,1,0,-1,0,0,6,6,6,
+         0,0,-1,0,1,0,1,0,0,6,6,6,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         0,0,1,1,0,0,0,1,0,6,6,6,
+         0,1,0,0,0,1,1,0,0,6,6,6,
+         0,-1,0,0,0,-1,1,0,0,6,6,6,
+         0,0,1,-1,0,0,0,-1,0,6,6,6,
+         0,-1,0,0,0,1,-1,0,0,6,6,6,
+         0,0,-1,-1,0,0,0,1,0,6,6,6,
+         0,0,-1,1,0,0,0,-1,0,6,6,6,
+         0,1,0,0,0,-1,-1,0,0,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         0,0,1,0,-1,0,1,0,0,6,6,6,
+         0,0,-1,0,-1,0,-1,0,0,6,6,6,
+         -1,0,0,0,0,1,0,1,0,6,6,6,
+         -1,0,0,0,0,-1,0,-1,0,6,6,6,
+         // I_4_c_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         0,-1,0,-1,0,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,1,0,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,-1,0,-1,0,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,1,6,6,0,
+         // I_4_m_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,1,6,6,6,
+         // I_a_-3
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,6,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,6,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,0,-6,0,
+         0,0,-1,1,0,0,0,1,0,0,0,-6,
+         0,1,0,0,0,-1,1,0,0,-6,0,0,
+         0,0,1,1,0,0,0,-1,0,0,-6,0,
+         0,0,1,-1,0,0,0,1,0,-6,0,0,
+         0,-1,0,0,0,1,1,0,0,0,0,-6,
+         -1,0,0,0,1,0,0,0,1,0,0,-6,
+         1,0,0,0,-1,0,0,0,1,-6,0,0,
+         1,0,0,0,1,0,0,0,-1,0,-6,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,0,1,1,0,0,0,1,0,6,6,6,
+         0,1,0,0,0,1,1,0,0,6,6,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         0,0,-1,-1,0,0,0,-1,0,6,6,6,
+         0,-1,0,0,0,-1,-1,0,0,6,6,6,
+         0,1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,1,0,0,0,-1,0,6,0,6,
+         0,0,1,-1,0,0,0,1,0,0,6,6,
+         0,-1,0,0,0,1,1,0,0,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,0,6,6,
+         1,0,0,0,1,0,0,0,-1,6,0,6,
+         // I_a_-3_d
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,3,3,9,
+         1,0,0,0,0,1,0,-1,0,3,9,9,
+         0,0,1,0,1,0,-1,0,0,3,9,9,
+         0,0,-1,0,1,0,1,0,0,3,9,3,
+         0,-1,0,1,0,0,0,0,1,3,9,3,
+         0,1,0,-1,0,0,0,0,1,3,3,9,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,6,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,6,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,6,0,
+         0,1,0,1,0,0,0,0,-1,3,9,9,
+         0,-1,0,-1,0,0,0,0,-1,3,3,3,
+         0,0,1,0,-1,0,1,0,0,3,3,9,
+         0,0,-1,0,-1,0,-1,0,0,3,3,3,
+         -1,0,0,0,0,1,0,1,0,3,9,3,
+         -1,0,0,0,0,-1,0,-1,0,3,3,3,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,-3,-3,-9,
+         -1,0,0,0,0,-1,0,1,0,-3,-9,-9,
+         0,0,-1,0,-1,0,1,0,0,-3,-9,-9,
+         0,0,1,0,-1,0,-1,0,0,-3,-9,-3,
+         0,1,0,-1,0,0,0,0,-1,-3,-9,-3,
+         0,-1,0,1,0,0,0,0,-1,-3,-3,-9,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,0,-6,0,
+         0,0,-1,1,0,0,0,1,0,0,0,-6,
+         0,1,0,0,0,-1,1,0,0,-6,0,0,
+         0,0,1,1,0,0,0,-1,0,0,-6,0,
+         0,0,1,-1,0,0,0,1,0,-6,0,0,
+         0,-1,0,0,0,1,1,0,0,0,0,-6,
+         -1,0,0,0,1,0,0,0,1,0,0,-6,
+         1,0,0,0,-1,0,0,0,1,-6,0,0,
+         1,0,0,0,1,0,0,0,-1,0,-6,0,
+         0,-1,0,-1,0,0,0,0,1,-3,-9,-9,
+         0,1,0,1,0,0,0,0,1,-3,-3,-3,
+         0,0,-1,0,1,0,-1,0,0,-3,-3,-9,
+         0,0,1,0,1,0,1,0,0,-3,-3,-3,
+         1,0,0,0,0,-1,0,-1,0,-3,-9,-3,
+         1,0,0,0,0,1,0,1,0,-3,-3,-3,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,0,-1,0,1,0,9,9,15,
+         1,0,0,0,0,1,0,-1,0,9,15,15,
+         0,0,1,0,1,0,-1,0,0,9,15,15,
+         0,0,-1,0,1,0,1,0,0,9,15,9,
+         0,-1,0,1,0,0,0,0,1,9,15,9,
+         0,1,0,-1,0,0,0,0,1,9,9,15,
+         0,0,1,1,0,0,0,1,0,6,6,6,
+         0,1,0,0,0,1,1,0,0,6,6,6,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         0,1,0,1,0,0,0,0,-1,9,15,15,
+         0,-1,0,-1,0,0,0,0,-1,9,9,9,
+         0,0,1,0,-1,0,1,0,0,9,9,15,
+         0,0,-1,0,-1,0,-1,0,0,9,9,9,
+         -1,0,0,0,0,1,0,1,0,9,15,9,
+         -1,0,0,0,0,-1,0,-1,0,9,9,9,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,0,1,0,-1,0,3,3,-3,
+         -1,0,0,0,0,-1,0,1,0,3,-3,-3,
+         0,0,-1,0,-1,0,1,0,0,3,-3,-3,
+         0,0,1,0,-1,0,-1,0,0,3,-3,3,
+         0,1,0,-1,0,0,0,0,-1,3,-3,3,
+         0,-1,0,1,0,0,0,0,-1,3,3,-3,
+         0,0,-1,-1,0,0,0,-1,0,6,6,6,
+         0,-1,0,0,0,-1,-1,0,0,6,6,6,
+         0,1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,1,0,0,0,1,0,6,6,0,
+         0,1,0,0,0,-1,1,0,0,0,6,6,
+         0,0,1,1,0,0,0,-1,0,6,0,6,
+         0,0,1,-1,0,0,0,1,0,0,6,6,
+         0,-1,0,0,0,1,1,0,0,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,0,6,6,
+         1,0,0,0,1,0,0,0,-1,6,0,6,
+         0,-1,0,-1,0,0,0,0,1,3,-3,-3,
+         0,1,0,1,0,0,0,0,1,3,3,3,
+         0,0,-1,0,1,0,-1,0,0,3,3,-3,
+         0,0,1,0,1,0,1,0,0,3,3,3,
+         1,0,0,0,0,-1,0,-1,0,3,-3,3,
+         1,0,0,0,0,1,0,1,0,3,3,3,
+         // I_b_a_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         // I_b_a_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,-6,
+         1,0,0,0,-1,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         // I_b_c_a
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,-6,
+         1,0,0,0,-1,0,0,0,1,-6,0,0,
+         1,0,0,0,1,0,0,0,-1,0,-6,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,0,6,6,
+         1,0,0,0,1,0,0,0,-1,6,0,6,
+         // I_m_-3
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,1,0,0,0,-1,0,0,0,0,
+         0,0,1,-1,0,0,0,1,0,0,0,0,
+         0,-1,0,0,0,1,1,0,0,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         0,0,1,1,0,0,0,1,0,6,6,6,
+         0,1,0,0,0,1,1,0,0,6,6,6,
+         0,-1,0,0,0,-1,1,0,0,6,6,6,
+         0,0,1,-1,0,0,0,-1,0,6,6,6,
+         0,-1,0,0,0,1,-1,0,0,6,6,6,
+         0,0,-1,-1,0,0,0,1,0,6,6,6,
+         0,0,-1,1,0,0,0,-1,0,6,6,6,
+         0,1,0,0,0,-1,-1,0,0,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         0,0,-1,-1,0,0,0,-1,0,6,6,6,
+         0,-1,0,0,0,-1,-1,0,0,6,6,6,
+         0,1,0,0,0,1,-1,0,0,6,6,6,
+         0,0,-1,1,0,0,0,1,0,6,6,6,
+         0,1,0,0,0,-1,1,0,0,6,6,6,
+         0,0,1,1,0,0,0,-1,0,6,6,6,
+         0,0,1,-1,0,0,0,1,0,6,6,6,
+         0,-1,0,0,0,1,1,0,0,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         // I_m_-3_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,0,0,0,
+         1,0,0,0,0,1,0,-1,0,0,0,0,
+         0,0,1,0,1,0,-1,0,0,0,0,0,
+         0,0,-1,0,1,0,1,0,0,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         0,0,1,0,-1,0,1,0,0,0,0,0,
+         0,0,-1,0,-1,0,-1,0,0,0,0,0,
+         -1,0,0,0,0,1,0,1,0,0,0,0,
+         -1,0,0,0,0,-1,0,-1,0,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,0,0,0,
+         -1,0,0,0,0,-1,0,1,0,0,0,0,
+         0,0,-1,0,-1,0,1,0,0,0,0,0,
+         0,0,1,0,-1,0,-1,0,0,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,1,0,0,0,-1,0,0,0,0,
+         0,0,1,-1,0,0,0,1,0,0,0,0,
+         0,-1,0,0,0,1,1,0,0,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         0,0,-1,0,1,0,-1,0,0,0,0,0,
+         0,0,1,0,1,0,1,0,0,0,0,0,
+         1,0,0,0,0,-1,0,-1,0,0,0,0,
+         1,0,0,0,0,1,0,1,0,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,0,-1,0,1,0,6,6,6,
+         1,0,0,0,0,1,0,-1,0,6,6,6,
+         0,0,1,0,1,0,-1,0,0,6,6,6,
+         0,0,-1,0,1,0,1,0,0,6,6,6,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         0,0,1,1,0,0,0,1,0,6,6,6,
+         0,1,0,0,0,1,1,0,0,6,6,6,
+         0,-1,0,0,0,-1,1,0,0,6,6,6,
+         0,0,1,-1,0,0,0,-1,0,6,6,6,
+         0,-1,0,0,0,1,-1,0,0,6,6,6,
+         0,0,-1,-1,0,0,0,1,0,6,6,6,
+         0,0,-1,1,0,0,0,-1,0,6,6,6,
+         0,1,0,0,0,-1,-1,0,0,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         0,0,1,0,-1,0,1,0,0,6,6,6,
+         0,0,-1,0,-1,0,-1,0,0,6,6,6,
+         -1,0,0,0,0,1,0,1,0,6,6,6,
+         -1,0,0,0,0,-1,0,-1,0,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,0,1,0,-1,0,6,6,6,
+         -1,0,0,0,0,-1,0,1,0,6,6,6,
+         0,0,-1,0,-1,0,1,0,0,6,6,6,
+         0,0,1,0,-1,0,-1,0,0,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         0,0,-1,-1,0,0,0,-1,0,6,6,6,
+         0,-1,0,0,0,-1,-1,0,0,6,6,6,
+         0,1,0,0,0,1,-1,0,0,6,6,6,
+         0,0,-1,1,0,0,0,1,0,6,6,6,
+         0,1,0,0,0,-1,1,0,0,6,6,6,
+         0,0,1,1,0,0,0,-1,0,6,6,6,
+         0,0,1,-1,0,0,0,1,0,6,6,6,
+         0,-1,0,0,0,1,1,0,0,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,1,6,6,6,
+         0,0,-1,0,1,0,-1,0,0,6,6,6,
+         0,0,1,0,1,0,1,0,0,6,6,6,
+         1,0,0,0,0,-1,0,-1,0,6,6,6,
+         1,0,0,0,0,1,0,1,0,6,6,6,
+         // I_m_a_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,6,0,0,
+         1,0,0,0,-1,0,0,0,1,6,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,1,0,6,6,
+         // I_m_m_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         // I_m_m_a
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,0,
+         -1,0,0,0,-1,0,0,0,1,0,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,-6,0,
+         1,0,0,0,1,0,0,0,-1,0,-6,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,0,6,
+         1,0,0,0,1,0,0,0,-1,6,0,6,
+         // I_m_m_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         // P_-1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         // P_-3
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,1,0,0,0,-1,0,0,0,
+         1,-1,0,1,0,0,0,0,-1,0,0,0,
+         // P_-3_1_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         -1,1,0,0,1,0,0,0,-1,0,0,6,
+         1,0,0,1,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,1,0,0,0,-1,0,0,0,
+         1,-1,0,1,0,0,0,0,-1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,-6,
+         1,-1,0,0,-1,0,0,0,1,0,0,-6,
+         -1,0,0,-1,1,0,0,0,1,0,0,-6,
+         // P_-3_1_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,1,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,1,0,0,0,-1,0,0,0,
+         1,-1,0,1,0,0,0,0,-1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,-1,1,0,0,0,1,0,0,0,
+         // P_-3_c_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,-1,1,0,0,0,-1,0,0,6,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,1,0,0,0,-1,0,0,0,
+         1,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,-6,
+         1,0,0,1,-1,0,0,0,1,0,0,-6,
+         0,-1,0,-1,0,0,0,0,1,0,0,-6,
+         // P_-3_m_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,-1,1,0,0,0,-1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,1,0,0,0,-1,0,0,0,
+         1,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,1,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         // P_-4
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         // P_-4_21_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,1,6,6,6,
+         // P_-4_21_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,1,6,6,0,
+         // P_-4_2_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,1,0,0,6,
+         // P_-4_2_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         // P_-4_3_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,0,0,0,
+         -1,0,0,0,0,-1,0,1,0,0,0,0,
+         0,0,-1,0,-1,0,1,0,0,0,0,0,
+         0,0,1,0,-1,0,-1,0,0,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         0,0,-1,0,1,0,-1,0,0,0,0,0,
+         0,0,1,0,1,0,1,0,0,0,0,0,
+         1,0,0,0,0,-1,0,-1,0,0,0,0,
+         1,0,0,0,0,1,0,1,0,0,0,0,
+         // P_-4_3_n
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,6,6,6,
+         -1,0,0,0,0,-1,0,1,0,6,6,6,
+         0,0,-1,0,-1,0,1,0,0,6,6,6,
+         0,0,1,0,-1,0,-1,0,0,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,1,6,6,6,
+         0,0,-1,0,1,0,-1,0,0,6,6,6,
+         0,0,1,0,1,0,1,0,0,6,6,6,
+         1,0,0,0,0,-1,0,-1,0,6,6,6,
+         1,0,0,0,0,1,0,1,0,6,6,6,
+         // P_-4_b_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         // P_-4_c_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         // P_-4_m_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         // P_-4_n_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         // P_-6
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,-1,0,0,0,-1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         // P_-6_2_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,-1,0,0,6,
+         0,-1,0,1,-1,0,0,0,-1,0,0,6,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,-1,1,0,0,0,-1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,6,
+         0,1,0,1,0,0,0,0,1,0,0,6,
+         1,-1,0,0,-1,0,0,0,1,0,0,6,
+         -1,0,0,-1,1,0,0,0,1,0,0,6,
+         // P_-6_2_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,-1,0,0,0,-1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,-1,1,0,0,0,-1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,-1,1,0,0,0,1,0,0,0,
+         // P_-6_c_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,-1,0,0,6,
+         0,-1,0,1,-1,0,0,0,-1,0,0,6,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,1,-1,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,1,-1,0,0,0,1,0,0,6,
+         1,0,0,0,1,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,1,0,0,6,
+         // P_-6_m_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,-1,0,0,0,-1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,1,-1,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,1,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         // P_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         // P_1_2%c_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,-6,
+         // P_1_2%m_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         // P_1_21%c_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,-6,-6,
+         // P_1_21%m_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,-6,0,
+         // P_1_21_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,0,
+         // P_1_2_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         // P_1_c_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         // P_1_m_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         // P_21_21_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         // P_21_21_21
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         // P_21_3
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         // P_2_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         // P_2_2_21
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         // P_2_3
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         // P_3
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         // P_31
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,4,
+         -1,1,0,-1,0,0,0,0,1,0,0,8,
+         // P_31_1_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,4,
+         -1,1,0,-1,0,0,0,0,1,0,0,8,
+         0,-1,0,-1,0,0,0,0,-1,0,0,8,
+         -1,1,0,0,1,0,0,0,-1,0,0,4,
+         1,0,0,1,-1,0,0,0,-1,0,0,0,
+         // P_31_2_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,4,
+         -1,1,0,-1,0,0,0,0,1,0,0,8,
+         1,-1,0,0,-1,0,0,0,-1,0,0,8,
+         -1,0,0,-1,1,0,0,0,-1,0,0,4,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         // P_32
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,8,
+         -1,1,0,-1,0,0,0,0,1,0,0,4,
+         // P_32_1_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,8,
+         -1,1,0,-1,0,0,0,0,1,0,0,4,
+         0,-1,0,-1,0,0,0,0,-1,0,0,4,
+         -1,1,0,0,1,0,0,0,-1,0,0,8,
+         1,0,0,1,-1,0,0,0,-1,0,0,0,
+         // P_32_2_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,8,
+         -1,1,0,-1,0,0,0,0,1,0,0,4,
+         1,-1,0,0,-1,0,0,0,-1,0,0,4,
+         -1,0,0,-1,1,0,0,0,-1,0,0,8,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         // P_3_1_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,1,-1,0,0,0,-1,0,0,0,
+         // P_3_1_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,6,
+         1,-1,0,0,-1,0,0,0,1,0,0,6,
+         -1,0,0,-1,1,0,0,0,1,0,0,6,
+         // P_3_1_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,-1,1,0,0,0,1,0,0,0,
+         // P_3_2_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,-1,1,0,0,0,-1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         // P_3_c_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,1,-1,0,0,0,1,0,0,6,
+         0,-1,0,-1,0,0,0,0,1,0,0,6,
+         // P_3_m_1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,1,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         // P_4
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         // P_4%m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         // P_4%m_b_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,-6,-6,0,
+         1,0,0,0,-1,0,0,0,1,-6,-6,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,-6,-6,0,
+         0,1,0,1,0,0,0,0,1,-6,-6,0,
+         // P_4%m_c_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,-6,
+         1,0,0,0,-1,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,-6,
+         0,1,0,1,0,0,0,0,1,0,0,-6,
+         // P_4%m_m_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         // P_4%m_n_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,-6,-6,-6,
+         1,0,0,0,-1,0,0,0,1,-6,-6,-6,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,-6,-6,-6,
+         0,1,0,1,0,0,0,0,1,-6,-6,-6,
+         // P_4%n:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,6,0,
+         0,1,0,-1,0,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,6,6,0,
+         // P_4%n:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,0,
+         0,1,0,-1,0,0,0,0,1,0,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,-6,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,-6,0,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         // P_4%n_b_m:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         0,1,0,-1,0,0,0,0,-1,6,6,0,
+         0,-1,0,1,0,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         1,0,0,0,1,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,1,6,6,0,
+         // P_4%n_b_m:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,0,
+         0,1,0,-1,0,0,0,0,1,0,6,0,
+         1,0,0,0,-1,0,0,0,-1,0,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,0,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,-6,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,-6,0,
+         -1,0,0,0,1,0,0,0,1,0,-6,0,
+         1,0,0,0,-1,0,0,0,1,-6,0,0,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,-6,-6,0,
+         // P_4%n_c_c:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,6,0,
+         0,1,0,-1,0,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,-6,
+         1,0,0,0,-1,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,1,6,6,-6,
+         0,1,0,1,0,0,0,0,1,6,6,-6,
+         // P_4%n_c_c:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,0,
+         0,1,0,-1,0,0,0,0,1,0,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,-6,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,-6,0,
+         -1,0,0,0,1,0,0,0,1,-6,0,-6,
+         1,0,0,0,-1,0,0,0,1,0,-6,-6,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         0,-1,0,-1,0,0,0,0,1,-6,-6,-6,
+         0,1,0,1,0,0,0,0,1,0,0,-6,
+         // P_4%n_m_m:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,6,0,
+         0,1,0,-1,0,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,1,6,6,0,
+         // P_4%n_m_m:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,0,
+         0,1,0,-1,0,0,0,0,1,0,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,-6,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,-6,0,
+         -1,0,0,0,1,0,0,0,1,-6,0,0,
+         1,0,0,0,-1,0,0,0,1,0,-6,0,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         0,-1,0,-1,0,0,0,0,1,-6,-6,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         // P_4%n_n_c:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,1,6,6,6,
+         // P_4%n_n_c:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,0,
+         0,1,0,-1,0,0,0,0,1,0,6,0,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,-6,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,-6,0,
+         -1,0,0,0,1,0,0,0,1,0,-6,-6,
+         1,0,0,0,-1,0,0,0,1,-6,0,-6,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,-6,
+         0,1,0,1,0,0,0,0,1,-6,-6,-6,
+         // P_41
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,3,
+         0,1,0,-1,0,0,0,0,1,0,0,9,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         // P_41_21_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,6,3,
+         0,1,0,-1,0,0,0,0,1,6,6,9,
+         1,0,0,0,-1,0,0,0,-1,6,6,9,
+         -1,0,0,0,1,0,0,0,-1,6,6,3,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         // P_41_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,3,
+         0,1,0,-1,0,0,0,0,1,0,0,9,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,-1,0,0,9,
+         0,-1,0,-1,0,0,0,0,-1,0,0,3,
+         // P_41_3_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,3,3,9,
+         1,0,0,0,0,1,0,-1,0,9,3,3,
+         0,0,1,0,1,0,-1,0,0,9,3,3,
+         0,0,-1,0,1,0,1,0,0,3,9,3,
+         0,-1,0,1,0,0,0,0,1,3,9,3,
+         0,1,0,-1,0,0,0,0,1,3,3,9,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         0,1,0,1,0,0,0,0,-1,9,3,3,
+         0,-1,0,-1,0,0,0,0,-1,9,9,9,
+         0,0,1,0,-1,0,1,0,0,3,3,9,
+         0,0,-1,0,-1,0,-1,0,0,9,9,9,
+         -1,0,0,0,0,1,0,1,0,3,9,3,
+         -1,0,0,0,0,-1,0,-1,0,9,9,9,
+         // P_42
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,0,0,0,0,1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         // P_42%m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,0,0,0,0,1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,-6,
+         0,-1,0,1,0,0,0,0,-1,0,0,-6,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         // P_42%m_b_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,0,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,-6,
+         0,-1,0,1,0,0,0,0,-1,0,0,-6,
+         -1,0,0,0,1,0,0,0,1,-6,-6,0,
+         1,0,0,0,-1,0,0,0,1,-6,-6,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,-6,-6,-6,
+         0,1,0,1,0,0,0,0,1,-6,-6,-6,
+         // P_42%m_c_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,0,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,-6,
+         0,-1,0,1,0,0,0,0,-1,0,0,-6,
+         -1,0,0,0,1,0,0,0,1,0,0,-6,
+         1,0,0,0,-1,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         // P_42%m_m_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,0,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,-6,
+         0,-1,0,1,0,0,0,0,-1,0,0,-6,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,-6,
+         0,1,0,1,0,0,0,0,1,0,0,-6,
+         // P_42%m_n_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,-6,-6,-6,
+         0,-1,0,1,0,0,0,0,-1,-6,-6,-6,
+         -1,0,0,0,1,0,0,0,1,-6,-6,-6,
+         1,0,0,0,-1,0,0,0,1,-6,-6,-6,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         // P_42%n:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         // P_42%n:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,6,6,
+         0,1,0,-1,0,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,-6,-6,
+         0,-1,0,1,0,0,0,0,-1,-6,0,-6,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         // P_42%n_b_c:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,1,0,0,6,
+         // P_42%n_b_c:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,6,
+         0,1,0,-1,0,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,0,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,-6,0,-6,
+         0,-1,0,1,0,0,0,0,-1,0,-6,-6,
+         -1,0,0,0,1,0,0,0,1,0,-6,0,
+         1,0,0,0,-1,0,0,0,1,-6,0,0,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,-6,
+         0,1,0,1,0,0,0,0,1,-6,-6,-6,
+         // P_42%n_c_m:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,1,6,6,0,
+         // P_42%n_c_m:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,6,
+         0,1,0,-1,0,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,-6,0,-6,
+         0,-1,0,1,0,0,0,0,-1,0,-6,-6,
+         -1,0,0,0,1,0,0,0,1,-6,0,-6,
+         1,0,0,0,-1,0,0,0,1,0,-6,-6,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         0,-1,0,-1,0,0,0,0,1,-6,-6,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         // P_42%n_m_c:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,1,6,6,6,
+         // P_42%n_m_c:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,6,
+         0,1,0,-1,0,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,-6,0,-6,
+         0,-1,0,1,0,0,0,0,-1,0,-6,-6,
+         -1,0,0,0,1,0,0,0,1,-6,0,0,
+         1,0,0,0,-1,0,0,0,1,0,-6,0,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         0,-1,0,-1,0,0,0,0,1,-6,-6,-6,
+         0,1,0,1,0,0,0,0,1,0,0,-6,
+         // P_42%n_n_m:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         // P_42%n_n_m:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,6,
+         0,1,0,-1,0,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,-6,0,-6,
+         0,-1,0,1,0,0,0,0,-1,0,-6,-6,
+         -1,0,0,0,1,0,0,0,1,0,-6,-6,
+         1,0,0,0,-1,0,0,0,1,-6,0,-6,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,-6,-6,0,
+         // P_42_21_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         // P_42_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,0,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         // P_42_3_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,6,6,6,
+         1,0,0,0,0,1,0,-1,0,6,6,6,
+         0,0,1,0,1,0,-1,0,0,6,6,6,
+         0,0,-1,0,1,0,1,0,0,6,6,6,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         0,0,1,0,-1,0,1,0,0,6,6,6,
+         0,0,-1,0,-1,0,-1,0,0,6,6,6,
+         -1,0,0,0,0,1,0,1,0,6,6,6,
+         -1,0,0,0,0,-1,0,-1,0,6,6,6,
+         // P_42_b_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,0,0,0,0,1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,-1,0,-1,0,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,1,6,6,6,
+         // P_42_c_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,0,0,0,0,1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         // P_42_m_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,0,0,0,0,1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,1,0,0,6,
+         // P_42_n_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         // P_43
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,9,
+         0,1,0,-1,0,0,0,0,1,0,0,3,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         // P_43_21_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,6,9,
+         0,1,0,-1,0,0,0,0,1,6,6,3,
+         1,0,0,0,-1,0,0,0,-1,6,6,3,
+         -1,0,0,0,1,0,0,0,-1,6,6,9,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         // P_43_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,9,
+         0,1,0,-1,0,0,0,0,1,0,0,3,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,-1,0,0,3,
+         0,-1,0,-1,0,0,0,0,-1,0,0,9,
+         // P_43_3_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,9,9,3,
+         1,0,0,0,0,1,0,-1,0,3,9,9,
+         0,0,1,0,1,0,-1,0,0,3,9,9,
+         0,0,-1,0,1,0,1,0,0,9,3,9,
+         0,-1,0,1,0,0,0,0,1,9,3,9,
+         0,1,0,-1,0,0,0,0,1,9,9,3,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         0,1,0,1,0,0,0,0,-1,3,9,9,
+         0,-1,0,-1,0,0,0,0,-1,3,3,3,
+         0,0,1,0,-1,0,1,0,0,9,9,3,
+         0,0,-1,0,-1,0,-1,0,0,3,3,3,
+         -1,0,0,0,0,1,0,1,0,9,3,9,
+         -1,0,0,0,0,-1,0,-1,0,3,3,3,
+         // P_4_21_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,6,6,0,
+         0,1,0,-1,0,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         // P_4_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         // P_4_3_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,0,0,0,
+         1,0,0,0,0,1,0,-1,0,0,0,0,
+         0,0,1,0,1,0,-1,0,0,0,0,0,
+         0,0,-1,0,1,0,1,0,0,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         0,0,1,0,-1,0,1,0,0,0,0,0,
+         0,0,-1,0,-1,0,-1,0,0,0,0,0,
+         -1,0,0,0,0,1,0,1,0,0,0,0,
+         -1,0,0,0,0,-1,0,-1,0,0,0,0,
+         // P_4_b_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,-1,0,-1,0,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,1,6,6,0,
+         // P_4_c_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         0,-1,0,-1,0,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,1,0,0,6,
+         // P_4_m_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         // P_4_n_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,1,6,6,6,
+         // P_6
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         // P_6%m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,1,0,0,0,-1,0,0,0,
+         1,-1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         // P_6%m_c_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,-1,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         -1,1,0,0,1,0,0,0,-1,0,0,6,
+         1,0,0,1,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,1,0,0,0,-1,0,0,0,
+         1,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,-6,
+         1,0,0,1,-1,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,-6,
+         0,1,0,1,0,0,0,0,1,0,0,-6,
+         1,-1,0,0,-1,0,0,0,1,0,0,-6,
+         -1,0,0,-1,1,0,0,0,1,0,0,-6,
+         // P_6%m_m_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,-1,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,1,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,1,0,0,0,-1,0,0,0,
+         1,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,1,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,-1,1,0,0,0,1,0,0,0,
+         // P_61
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,2,
+         0,1,0,-1,1,0,0,0,1,0,0,10,
+         0,-1,0,1,-1,0,0,0,1,0,0,4,
+         -1,1,0,-1,0,0,0,0,1,0,0,8,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         // P_61_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,2,
+         0,1,0,-1,1,0,0,0,1,0,0,10,
+         0,-1,0,1,-1,0,0,0,1,0,0,4,
+         -1,1,0,-1,0,0,0,0,1,0,0,8,
+         1,-1,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,-1,1,0,0,0,-1,0,0,8,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,-1,0,0,4,
+         0,-1,0,-1,0,0,0,0,-1,0,0,10,
+         -1,1,0,0,1,0,0,0,-1,0,0,6,
+         1,0,0,1,-1,0,0,0,-1,0,0,2,
+         // P_62
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,4,
+         0,1,0,-1,1,0,0,0,1,0,0,8,
+         0,-1,0,1,-1,0,0,0,1,0,0,8,
+         -1,1,0,-1,0,0,0,0,1,0,0,4,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         // P_62_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,4,
+         0,1,0,-1,1,0,0,0,1,0,0,8,
+         0,-1,0,1,-1,0,0,0,1,0,0,8,
+         -1,1,0,-1,0,0,0,0,1,0,0,4,
+         1,-1,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,-1,1,0,0,0,-1,0,0,4,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,8,
+         0,-1,0,-1,0,0,0,0,-1,0,0,8,
+         -1,1,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,1,-1,0,0,0,-1,0,0,4,
+         // P_63
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,1,0,0,0,1,0,0,6,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         // P_63%m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,1,0,0,0,1,0,0,6,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,1,0,-1,0,0,0,0,-1,0,0,-6,
+         0,-1,0,1,-1,0,0,0,-1,0,0,-6,
+         0,1,0,-1,1,0,0,0,-1,0,0,0,
+         1,-1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,-6,
+         // P_63%m_c_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,1,0,0,0,1,0,0,6,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,-1,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,1,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,1,0,-1,0,0,0,0,-1,0,0,-6,
+         0,-1,0,1,-1,0,0,0,-1,0,0,-6,
+         0,1,0,-1,1,0,0,0,-1,0,0,0,
+         1,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,-6,
+         1,0,0,1,-1,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,-1,0,0,-6,
+         0,-1,0,-1,0,0,0,0,1,0,0,-6,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,-1,1,0,0,0,1,0,0,0,
+         // P_63%m_m_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,1,0,0,0,1,0,0,6,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,-1,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         -1,1,0,0,1,0,0,0,-1,0,0,6,
+         1,0,0,1,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,1,0,-1,0,0,0,0,-1,0,0,-6,
+         0,-1,0,1,-1,0,0,0,-1,0,0,-6,
+         0,1,0,-1,1,0,0,0,-1,0,0,0,
+         1,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,1,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,-6,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,-6,
+         1,-1,0,0,-1,0,0,0,1,0,0,-6,
+         -1,0,0,-1,1,0,0,0,1,0,0,-6,
+         // P_63_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,1,0,0,0,1,0,0,6,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,-1,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,6,
+         -1,1,0,0,1,0,0,0,-1,0,0,6,
+         1,0,0,1,-1,0,0,0,-1,0,0,6,
+         // P_63_c_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,1,0,0,0,1,0,0,6,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         -1,1,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,1,-1,0,0,0,1,0,0,6,
+         0,-1,0,-1,0,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,-1,1,0,0,0,1,0,0,0,
+         // P_63_m_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,6,
+         0,1,0,-1,1,0,0,0,1,0,0,6,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         -1,1,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,1,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,6,
+         1,-1,0,0,-1,0,0,0,1,0,0,6,
+         -1,0,0,-1,1,0,0,0,1,0,0,6,
+         // P_64
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,8,
+         0,1,0,-1,1,0,0,0,1,0,0,4,
+         0,-1,0,1,-1,0,0,0,1,0,0,4,
+         -1,1,0,-1,0,0,0,0,1,0,0,8,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         // P_64_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,8,
+         0,1,0,-1,1,0,0,0,1,0,0,4,
+         0,-1,0,1,-1,0,0,0,1,0,0,4,
+         -1,1,0,-1,0,0,0,0,1,0,0,8,
+         1,-1,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,-1,1,0,0,0,-1,0,0,8,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,4,
+         0,-1,0,-1,0,0,0,0,-1,0,0,4,
+         -1,1,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,1,-1,0,0,0,-1,0,0,8,
+         // P_65
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,10,
+         0,1,0,-1,1,0,0,0,1,0,0,2,
+         0,-1,0,1,-1,0,0,0,1,0,0,8,
+         -1,1,0,-1,0,0,0,0,1,0,0,4,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         // P_65_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,10,
+         0,1,0,-1,1,0,0,0,1,0,0,2,
+         0,-1,0,1,-1,0,0,0,1,0,0,8,
+         -1,1,0,-1,0,0,0,0,1,0,0,4,
+         1,-1,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,-1,1,0,0,0,-1,0,0,4,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,-1,0,0,8,
+         0,-1,0,-1,0,0,0,0,-1,0,0,2,
+         -1,1,0,0,1,0,0,0,-1,0,0,6,
+         1,0,0,1,-1,0,0,0,-1,0,0,10,
+         // P_6_2_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,-1,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,-1,0,0,0,
+         1,0,0,1,-1,0,0,0,-1,0,0,0,
+         // P_6_c_c
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,1,-1,0,0,0,1,0,0,6,
+         0,-1,0,-1,0,0,0,0,1,0,0,6,
+         0,1,0,1,0,0,0,0,1,0,0,6,
+         1,-1,0,0,-1,0,0,0,1,0,0,6,
+         -1,0,0,-1,1,0,0,0,1,0,0,6,
+         // P_6_m_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,1,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,-1,1,0,0,0,1,0,0,0,
+         // P_a_-3
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,6,0,6,
+         0,0,1,-1,0,0,0,-1,0,6,6,0,
+         0,-1,0,0,0,1,-1,0,0,0,6,6,
+         0,0,-1,-1,0,0,0,1,0,6,0,6,
+         0,0,-1,1,0,0,0,-1,0,0,6,6,
+         0,1,0,0,0,-1,-1,0,0,6,6,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,-6,0,-6,
+         0,0,-1,1,0,0,0,1,0,-6,-6,0,
+         0,1,0,0,0,-1,1,0,0,0,-6,-6,
+         0,0,1,1,0,0,0,-1,0,-6,0,-6,
+         0,0,1,-1,0,0,0,1,0,0,-6,-6,
+         0,-1,0,0,0,1,1,0,0,-6,-6,0,
+         -1,0,0,0,1,0,0,0,1,-6,-6,0,
+         1,0,0,0,-1,0,0,0,1,0,-6,-6,
+         1,0,0,0,1,0,0,0,-1,-6,0,-6,
+         // P_b_a_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         // P_b_a_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,-6,-6,0,
+         1,0,0,0,-1,0,0,0,1,-6,-6,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         // P_b_a_n:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,6,6,0,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         1,0,0,0,1,0,0,0,-1,6,6,0,
+         // P_b_a_n:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,0,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,-6,0,
+         1,0,0,0,-1,0,0,0,1,-6,0,0,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         // P_b_c_a
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,-6,-6,0,
+         1,0,0,0,-1,0,0,0,1,0,-6,-6,
+         1,0,0,0,1,0,0,0,-1,-6,0,-6,
+         // P_b_c_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,-6,0,
+         1,0,0,0,-1,0,0,0,1,0,-6,-6,
+         1,0,0,0,1,0,0,0,-1,0,0,-6,
+         // P_b_c_n
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,-6,-6,0,
+         1,0,0,0,-1,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,-1,-6,-6,-6,
+         // P_c_a_21
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         -1,0,0,0,1,0,0,0,1,6,0,6,
+         1,0,0,0,-1,0,0,0,1,6,0,0,
+         // P_c_c_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         // P_c_c_a
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,-6,0,-6,
+         1,0,0,0,-1,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,-1,-6,0,0,
+         // P_c_c_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,0,1,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,-6,
+         1,0,0,0,-1,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         // P_c_c_n
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,0,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,-6,0,-6,
+         1,0,0,0,-1,0,0,0,1,0,-6,-6,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         // P_m_-3
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,1,0,0,0,-1,0,0,0,0,
+         0,0,1,-1,0,0,0,1,0,0,0,0,
+         0,-1,0,0,0,1,1,0,0,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         // P_m_-3_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,0,0,0,
+         1,0,0,0,0,1,0,-1,0,0,0,0,
+         0,0,1,0,1,0,-1,0,0,0,0,0,
+         0,0,-1,0,1,0,1,0,0,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         0,0,1,0,-1,0,1,0,0,0,0,0,
+         0,0,-1,0,-1,0,-1,0,0,0,0,0,
+         -1,0,0,0,0,1,0,1,0,0,0,0,
+         -1,0,0,0,0,-1,0,-1,0,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,0,0,0,
+         -1,0,0,0,0,-1,0,1,0,0,0,0,
+         0,0,-1,0,-1,0,1,0,0,0,0,0,
+         0,0,1,0,-1,0,-1,0,0,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,1,0,0,0,-1,0,0,0,0,
+         0,0,1,-1,0,0,0,1,0,0,0,0,
+         0,-1,0,0,0,1,1,0,0,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         0,0,-1,0,1,0,-1,0,0,0,0,0,
+         0,0,1,0,1,0,1,0,0,0,0,0,
+         1,0,0,0,0,-1,0,-1,0,0,0,0,
+         1,0,0,0,0,1,0,1,0,0,0,0,
+         // P_m_-3_n
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,6,6,6,
+         1,0,0,0,0,1,0,-1,0,6,6,6,
+         0,0,1,0,1,0,-1,0,0,6,6,6,
+         0,0,-1,0,1,0,1,0,0,6,6,6,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         0,0,1,0,-1,0,1,0,0,6,6,6,
+         0,0,-1,0,-1,0,-1,0,0,6,6,6,
+         -1,0,0,0,0,1,0,1,0,6,6,6,
+         -1,0,0,0,0,-1,0,-1,0,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,-6,-6,-6,
+         -1,0,0,0,0,-1,0,1,0,-6,-6,-6,
+         0,0,-1,0,-1,0,1,0,0,-6,-6,-6,
+         0,0,1,0,-1,0,-1,0,0,-6,-6,-6,
+         0,1,0,-1,0,0,0,0,-1,-6,-6,-6,
+         0,-1,0,1,0,0,0,0,-1,-6,-6,-6,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,1,0,0,0,-1,0,0,0,0,
+         0,0,1,-1,0,0,0,1,0,0,0,0,
+         0,-1,0,0,0,1,1,0,0,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,-6,-6,-6,
+         0,1,0,1,0,0,0,0,1,-6,-6,-6,
+         0,0,-1,0,1,0,-1,0,0,-6,-6,-6,
+         0,0,1,0,1,0,1,0,0,-6,-6,-6,
+         1,0,0,0,0,-1,0,-1,0,-6,-6,-6,
+         1,0,0,0,0,1,0,1,0,-6,-6,-6,
+         // P_m_a_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,6,0,0,
+         1,0,0,0,-1,0,0,0,1,6,0,0,
+         // P_m_c_21
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,6,
+         // P_m_m_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         // P_m_m_a
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,6,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,-6,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,-6,0,0,
+         // P_m_m_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         // P_m_m_n:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,-1,6,6,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,-1,6,6,0,
+         // P_m_m_n:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,-6,0,0,
+         1,0,0,0,-1,0,0,0,1,0,-6,0,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         // P_m_n_21
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,6,0,6,
+         // P_m_n_a
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,1,-6,0,-6,
+         1,0,0,0,1,0,0,0,-1,-6,0,-6,
+         // P_n_-3:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         0,0,-1,-1,0,0,0,-1,0,6,6,6,
+         0,-1,0,0,0,-1,-1,0,0,6,6,6,
+         0,1,0,0,0,1,-1,0,0,6,6,6,
+         0,0,-1,1,0,0,0,1,0,6,6,6,
+         0,1,0,0,0,-1,1,0,0,6,6,6,
+         0,0,1,1,0,0,0,-1,0,6,6,6,
+         0,0,1,-1,0,0,0,1,0,6,6,6,
+         0,-1,0,0,0,1,1,0,0,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         // P_n_-3:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,-1,0,0,0,1,0,6,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,0,6,
+         0,1,0,0,0,-1,-1,0,0,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,-6,-6,0,
+         0,0,-1,1,0,0,0,1,0,0,-6,-6,
+         0,1,0,0,0,-1,1,0,0,-6,0,-6,
+         0,0,1,1,0,0,0,-1,0,-6,-6,0,
+         0,0,1,-1,0,0,0,1,0,-6,0,-6,
+         0,-1,0,0,0,1,1,0,0,0,-6,-6,
+         -1,0,0,0,1,0,0,0,1,0,-6,-6,
+         1,0,0,0,-1,0,0,0,1,-6,0,-6,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         // P_n_-3_m:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,6,6,6,
+         1,0,0,0,0,1,0,-1,0,6,6,6,
+         0,0,1,0,1,0,-1,0,0,6,6,6,
+         0,0,-1,0,1,0,1,0,0,6,6,6,
+         0,-1,0,1,0,0,0,0,1,6,6,6,
+         0,1,0,-1,0,0,0,0,1,6,6,6,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         0,0,1,0,-1,0,1,0,0,6,6,6,
+         0,0,-1,0,-1,0,-1,0,0,6,6,6,
+         -1,0,0,0,0,1,0,1,0,6,6,6,
+         -1,0,0,0,0,-1,0,-1,0,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,0,1,0,-1,0,0,0,0,
+         -1,0,0,0,0,-1,0,1,0,0,0,0,
+         0,0,-1,0,-1,0,1,0,0,0,0,0,
+         0,0,1,0,-1,0,-1,0,0,0,0,0,
+         0,1,0,-1,0,0,0,0,-1,0,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,0,0,
+         0,0,-1,-1,0,0,0,-1,0,6,6,6,
+         0,-1,0,0,0,-1,-1,0,0,6,6,6,
+         0,1,0,0,0,1,-1,0,0,6,6,6,
+         0,0,-1,1,0,0,0,1,0,6,6,6,
+         0,1,0,0,0,-1,1,0,0,6,6,6,
+         0,0,1,1,0,0,0,-1,0,6,6,6,
+         0,0,1,-1,0,0,0,1,0,6,6,6,
+         0,-1,0,0,0,1,1,0,0,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         0,0,-1,0,1,0,-1,0,0,0,0,0,
+         0,0,1,0,1,0,1,0,0,0,0,0,
+         1,0,0,0,0,-1,0,-1,0,0,0,0,
+         1,0,0,0,0,1,0,1,0,0,0,0,
+         // P_n_-3_m:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,6,0,6,
+         1,0,0,0,0,1,0,-1,0,6,6,0,
+         0,0,1,0,1,0,-1,0,0,6,6,0,
+         0,0,-1,0,1,0,1,0,0,0,6,6,
+         0,-1,0,1,0,0,0,0,1,0,6,6,
+         0,1,0,-1,0,0,0,0,1,6,0,6,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,-1,0,0,0,1,0,6,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,0,6,
+         0,1,0,0,0,-1,-1,0,0,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,6,6,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         0,0,1,0,-1,0,1,0,0,6,0,6,
+         0,0,-1,0,-1,0,-1,0,0,0,0,0,
+         -1,0,0,0,0,1,0,1,0,0,6,6,
+         -1,0,0,0,0,-1,0,-1,0,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,-6,0,-6,
+         -1,0,0,0,0,-1,0,1,0,-6,-6,0,
+         0,0,-1,0,-1,0,1,0,0,-6,-6,0,
+         0,0,1,0,-1,0,-1,0,0,0,-6,-6,
+         0,1,0,-1,0,0,0,0,-1,0,-6,-6,
+         0,-1,0,1,0,0,0,0,-1,-6,0,-6,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,-6,-6,0,
+         0,0,-1,1,0,0,0,1,0,0,-6,-6,
+         0,1,0,0,0,-1,1,0,0,-6,0,-6,
+         0,0,1,1,0,0,0,-1,0,-6,-6,0,
+         0,0,1,-1,0,0,0,1,0,-6,0,-6,
+         0,-1,0,0,0,1,1,0,0,0,-6,-6,
+         -1,0,0,0,1,0,0,0,1,0,-6,-6,
+         1,0,0,0,-1,0,0,0,1,-6,0,-6,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         0,-1,0,-1,0,0,0,0,1,-6,-6,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         0,0,-1,0,1,0,-1,0,0,-6,0,-6,
+         0,0,1,0,1,0,1,0,0,0,0,0,
+         1,0,0,0,0,-1,0,-1,0,0,-6,-6,
+         1,0,0,0,0,1,0,1,0,0,0,0,
+         // P_n_-3_n:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,0,0,0,
+         1,0,0,0,0,1,0,-1,0,0,0,0,
+         0,0,1,0,1,0,-1,0,0,0,0,0,
+         0,0,-1,0,1,0,1,0,0,0,0,0,
+         0,-1,0,1,0,0,0,0,1,0,0,0,
+         0,1,0,-1,0,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,0,0,0,
+         0,0,1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,1,-1,0,0,0,0,0,
+         0,0,-1,-1,0,0,0,1,0,0,0,0,
+         0,0,-1,1,0,0,0,-1,0,0,0,0,
+         0,1,0,0,0,-1,-1,0,0,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         0,0,1,0,-1,0,1,0,0,0,0,0,
+         0,0,-1,0,-1,0,-1,0,0,0,0,0,
+         -1,0,0,0,0,1,0,1,0,0,0,0,
+         -1,0,0,0,0,-1,0,-1,0,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,0,1,0,-1,0,6,6,6,
+         -1,0,0,0,0,-1,0,1,0,6,6,6,
+         0,0,-1,0,-1,0,1,0,0,6,6,6,
+         0,0,1,0,-1,0,-1,0,0,6,6,6,
+         0,1,0,-1,0,0,0,0,-1,6,6,6,
+         0,-1,0,1,0,0,0,0,-1,6,6,6,
+         0,0,-1,-1,0,0,0,-1,0,6,6,6,
+         0,-1,0,0,0,-1,-1,0,0,6,6,6,
+         0,1,0,0,0,1,-1,0,0,6,6,6,
+         0,0,-1,1,0,0,0,1,0,6,6,6,
+         0,1,0,0,0,-1,1,0,0,6,6,6,
+         0,0,1,1,0,0,0,-1,0,6,6,6,
+         0,0,1,-1,0,0,0,1,0,6,6,6,
+         0,-1,0,0,0,1,1,0,0,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         0,-1,0,-1,0,0,0,0,1,6,6,6,
+         0,1,0,1,0,0,0,0,1,6,6,6,
+         0,0,-1,0,1,0,-1,0,0,6,6,6,
+         0,0,1,0,1,0,1,0,0,6,6,6,
+         1,0,0,0,0,-1,0,-1,0,6,6,6,
+         1,0,0,0,0,1,0,1,0,6,6,6,
+         // P_n_-3_n:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,0,-1,0,1,0,0,6,0,
+         1,0,0,0,0,1,0,-1,0,0,0,6,
+         0,0,1,0,1,0,-1,0,0,0,0,6,
+         0,0,-1,0,1,0,1,0,0,6,0,0,
+         0,-1,0,1,0,0,0,0,1,6,0,0,
+         0,1,0,-1,0,0,0,0,1,0,6,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,0,0,-1,1,0,0,6,6,0,
+         0,0,1,-1,0,0,0,-1,0,0,6,6,
+         0,-1,0,0,0,1,-1,0,0,6,0,6,
+         0,0,-1,-1,0,0,0,1,0,6,6,0,
+         0,0,-1,1,0,0,0,-1,0,6,0,6,
+         0,1,0,0,0,-1,-1,0,0,0,6,6,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         0,0,1,0,-1,0,1,0,0,0,6,0,
+         0,0,-1,0,-1,0,-1,0,0,6,6,6,
+         -1,0,0,0,0,1,0,1,0,6,0,0,
+         -1,0,0,0,0,-1,0,-1,0,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,0,1,0,-1,0,0,-6,0,
+         -1,0,0,0,0,-1,0,1,0,0,0,-6,
+         0,0,-1,0,-1,0,1,0,0,0,0,-6,
+         0,0,1,0,-1,0,-1,0,0,-6,0,0,
+         0,1,0,-1,0,0,0,0,-1,-6,0,0,
+         0,-1,0,1,0,0,0,0,-1,0,-6,0,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,0,0,1,-1,0,0,-6,-6,0,
+         0,0,-1,1,0,0,0,1,0,0,-6,-6,
+         0,1,0,0,0,-1,1,0,0,-6,0,-6,
+         0,0,1,1,0,0,0,-1,0,-6,-6,0,
+         0,0,1,-1,0,0,0,1,0,-6,0,-6,
+         0,-1,0,0,0,1,1,0,0,0,-6,-6,
+         -1,0,0,0,1,0,0,0,1,0,-6,-6,
+         1,0,0,0,-1,0,0,0,1,-6,0,-6,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,-6,
+         0,1,0,1,0,0,0,0,1,-6,-6,-6,
+         0,0,-1,0,1,0,-1,0,0,0,-6,0,
+         0,0,1,0,1,0,1,0,0,-6,-6,-6,
+         1,0,0,0,0,-1,0,-1,0,-6,0,0,
+         1,0,0,0,0,1,0,1,0,-6,-6,-6,
+         // P_n_a_21
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,0,
+         // P_n_c_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,6,6,
+         1,0,0,0,-1,0,0,0,1,0,6,6,
+         // P_n_m_a
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,0,6,0,
+         -1,0,0,0,-1,0,0,0,1,6,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,-6,-6,-6,
+         1,0,0,0,-1,0,0,0,1,0,-6,0,
+         1,0,0,0,1,0,0,0,-1,-6,0,-6,
+         // P_n_n_2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         // P_n_n_a
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,6,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,-6,-6,
+         1,0,0,0,-1,0,0,0,1,-6,-6,-6,
+         1,0,0,0,1,0,0,0,-1,-6,0,0,
+         // P_n_n_m
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,6,6,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,-6,-6,-6,
+         1,0,0,0,-1,0,0,0,1,-6,-6,-6,
+         1,0,0,0,1,0,0,0,-1,0,0,0,
+         // P_n_n_n:1
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,6,6,6,
+         -1,0,0,0,1,0,0,0,1,6,6,6,
+         1,0,0,0,-1,0,0,0,1,6,6,6,
+         1,0,0,0,1,0,0,0,-1,6,6,6,
+         // P_n_n_n:2
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,0,-1,0,0,0,-1,0,6,6,
+         -1,0,0,0,1,0,0,0,-1,6,0,6,
+         -1,0,0,0,-1,0,0,0,1,6,6,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,0,1,0,0,0,1,0,-6,-6,
+         1,0,0,0,-1,0,0,0,1,-6,0,-6,
+         1,0,0,0,1,0,0,0,-1,-6,-6,0,
+         // R_-3:H
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,1,0,0,0,-1,0,0,0,
+         1,-1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,1,4,8,8,
+         0,-1,0,1,-1,0,0,0,1,4,8,8,
+         -1,1,0,-1,0,0,0,0,1,4,8,8,
+         -1,0,0,0,-1,0,0,0,-1,4,8,8,
+         0,1,0,-1,1,0,0,0,-1,4,8,8,
+         1,-1,0,1,0,0,0,0,-1,4,8,8,
+         1,0,0,0,1,0,0,0,1,8,4,4,
+         0,-1,0,1,-1,0,0,0,1,8,4,4,
+         -1,1,0,-1,0,0,0,0,1,8,4,4,
+         -1,0,0,0,-1,0,0,0,-1,8,4,4,
+         0,1,0,-1,1,0,0,0,-1,8,4,4,
+         1,-1,0,1,0,0,0,0,-1,8,4,4,
+         // R_-3:R
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         // R_-3_c:H
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,-1,0,0,6,
+         -1,0,0,-1,1,0,0,0,-1,0,0,6,
+         0,1,0,1,0,0,0,0,-1,0,0,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,1,0,0,0,-1,0,0,0,
+         1,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,-6,
+         1,0,0,1,-1,0,0,0,1,0,0,-6,
+         0,-1,0,-1,0,0,0,0,1,0,0,-6,
+         1,0,0,0,1,0,0,0,1,4,8,8,
+         0,-1,0,1,-1,0,0,0,1,4,8,8,
+         -1,1,0,-1,0,0,0,0,1,4,8,8,
+         1,-1,0,0,-1,0,0,0,-1,4,8,14,
+         -1,0,0,-1,1,0,0,0,-1,4,8,14,
+         0,1,0,1,0,0,0,0,-1,4,8,14,
+         -1,0,0,0,-1,0,0,0,-1,4,8,8,
+         0,1,0,-1,1,0,0,0,-1,4,8,8,
+         1,-1,0,1,0,0,0,0,-1,4,8,8,
+         -1,1,0,0,1,0,0,0,1,4,8,2,
+         1,0,0,1,-1,0,0,0,1,4,8,2,
+         0,-1,0,-1,0,0,0,0,1,4,8,2,
+         1,0,0,0,1,0,0,0,1,8,4,4,
+         0,-1,0,1,-1,0,0,0,1,8,4,4,
+         -1,1,0,-1,0,0,0,0,1,8,4,4,
+         1,-1,0,0,-1,0,0,0,-1,8,4,10,
+         -1,0,0,-1,1,0,0,0,-1,8,4,10,
+         0,1,0,1,0,0,0,0,-1,8,4,10,
+         -1,0,0,0,-1,0,0,0,-1,8,4,4,
+         0,1,0,-1,1,0,0,0,-1,8,4,4,
+         1,-1,0,1,0,0,0,0,-1,8,4,4,
+         -1,1,0,0,1,0,0,0,1,8,4,-2,
+         1,0,0,1,-1,0,0,0,1,8,4,-2,
+         0,-1,0,-1,0,0,0,0,1,8,4,-2,
+         // R_-3_c:R
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,6,6,6,
+         0,0,-1,0,-1,0,-1,0,0,6,6,6,
+         -1,0,0,0,0,-1,0,-1,0,6,6,6,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,1,0,0,0,0,1,-6,-6,-6,
+         0,0,1,0,1,0,1,0,0,-6,-6,-6,
+         1,0,0,0,0,1,0,1,0,-6,-6,-6,
+         // R_-3_m:H
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,-1,1,0,0,0,-1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,1,0,-1,1,0,0,0,-1,0,0,0,
+         1,-1,0,1,0,0,0,0,-1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,1,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,4,8,8,
+         0,-1,0,1,-1,0,0,0,1,4,8,8,
+         -1,1,0,-1,0,0,0,0,1,4,8,8,
+         1,-1,0,0,-1,0,0,0,-1,4,8,8,
+         -1,0,0,-1,1,0,0,0,-1,4,8,8,
+         0,1,0,1,0,0,0,0,-1,4,8,8,
+         -1,0,0,0,-1,0,0,0,-1,4,8,8,
+         0,1,0,-1,1,0,0,0,-1,4,8,8,
+         1,-1,0,1,0,0,0,0,-1,4,8,8,
+         -1,1,0,0,1,0,0,0,1,4,8,8,
+         1,0,0,1,-1,0,0,0,1,4,8,8,
+         0,-1,0,-1,0,0,0,0,1,4,8,8,
+         1,0,0,0,1,0,0,0,1,8,4,4,
+         0,-1,0,1,-1,0,0,0,1,8,4,4,
+         -1,1,0,-1,0,0,0,0,1,8,4,4,
+         1,-1,0,0,-1,0,0,0,-1,8,4,4,
+         -1,0,0,-1,1,0,0,0,-1,8,4,4,
+         0,1,0,1,0,0,0,0,-1,8,4,4,
+         -1,0,0,0,-1,0,0,0,-1,8,4,4,
+         0,1,0,-1,1,0,0,0,-1,8,4,4,
+         1,-1,0,1,0,0,0,0,-1,8,4,4,
+         -1,1,0,0,1,0,0,0,1,8,4,4,
+         1,0,0,1,-1,0,0,0,1,8,4,4,
+         0,-1,0,-1,0,0,0,0,1,8,4,4,
+         // R_-3_m:R
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         0,0,-1,0,-1,0,-1,0,0,0,0,0,
+         -1,0,0,0,0,-1,0,-1,0,0,0,0,
+         -1,0,0,0,-1,0,0,0,-1,0,0,0,
+         0,0,-1,-1,0,0,0,-1,0,0,0,0,
+         0,-1,0,0,0,-1,-1,0,0,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         0,0,1,0,1,0,1,0,0,0,0,0,
+         1,0,0,0,0,1,0,1,0,0,0,0,
+         // R_3:H
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,4,8,8,
+         0,-1,0,1,-1,0,0,0,1,4,8,8,
+         -1,1,0,-1,0,0,0,0,1,4,8,8,
+         1,0,0,0,1,0,0,0,1,8,4,4,
+         0,-1,0,1,-1,0,0,0,1,8,4,4,
+         -1,1,0,-1,0,0,0,0,1,8,4,4,
+         // R_3:R
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         // R_3_2:H
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         1,-1,0,0,-1,0,0,0,-1,0,0,0,
+         -1,0,0,-1,1,0,0,0,-1,0,0,0,
+         0,1,0,1,0,0,0,0,-1,0,0,0,
+         1,0,0,0,1,0,0,0,1,4,8,8,
+         0,-1,0,1,-1,0,0,0,1,4,8,8,
+         -1,1,0,-1,0,0,0,0,1,4,8,8,
+         1,-1,0,0,-1,0,0,0,-1,4,8,8,
+         -1,0,0,-1,1,0,0,0,-1,4,8,8,
+         0,1,0,1,0,0,0,0,-1,4,8,8,
+         1,0,0,0,1,0,0,0,1,8,4,4,
+         0,-1,0,1,-1,0,0,0,1,8,4,4,
+         -1,1,0,-1,0,0,0,0,1,8,4,4,
+         1,-1,0,0,-1,0,0,0,-1,8,4,4,
+         -1,0,0,-1,1,0,0,0,-1,8,4,4,
+         0,1,0,1,0,0,0,0,-1,8,4,4,
+         // R_3_2:R
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,-1,0,-1,0,0,0,0,-1,0,0,0,
+         0,0,-1,0,-1,0,-1,0,0,0,0,0,
+         -1,0,0,0,0,-1,0,-1,0,0,0,0,
+         // R_3_c:H
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,6,
+         1,0,0,1,-1,0,0,0,1,0,0,6,
+         0,-1,0,-1,0,0,0,0,1,0,0,6,
+         1,0,0,0,1,0,0,0,1,4,8,8,
+         0,-1,0,1,-1,0,0,0,1,4,8,8,
+         -1,1,0,-1,0,0,0,0,1,4,8,8,
+         -1,1,0,0,1,0,0,0,1,4,8,14,
+         1,0,0,1,-1,0,0,0,1,4,8,14,
+         0,-1,0,-1,0,0,0,0,1,4,8,14,
+         1,0,0,0,1,0,0,0,1,8,4,4,
+         0,-1,0,1,-1,0,0,0,1,8,4,4,
+         -1,1,0,-1,0,0,0,0,1,8,4,4,
+         -1,1,0,0,1,0,0,0,1,8,4,10,
+         1,0,0,1,-1,0,0,0,1,8,4,10,
+         0,-1,0,-1,0,0,0,0,1,8,4,10,
+         // R_3_c:R
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,1,0,1,0,0,0,0,1,6,6,6,
+         0,0,1,0,1,0,1,0,0,6,6,6,
+         1,0,0,0,0,1,0,1,0,6,6,6,
+         // R_3_m:H
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,-1,0,1,-1,0,0,0,1,0,0,0,
+         -1,1,0,-1,0,0,0,0,1,0,0,0,
+         -1,1,0,0,1,0,0,0,1,0,0,0,
+         1,0,0,1,-1,0,0,0,1,0,0,0,
+         0,-1,0,-1,0,0,0,0,1,0,0,0,
+         1,0,0,0,1,0,0,0,1,4,8,8,
+         0,-1,0,1,-1,0,0,0,1,4,8,8,
+         -1,1,0,-1,0,0,0,0,1,4,8,8,
+         -1,1,0,0,1,0,0,0,1,4,8,8,
+         1,0,0,1,-1,0,0,0,1,4,8,8,
+         0,-1,0,-1,0,0,0,0,1,4,8,8,
+         1,0,0,0,1,0,0,0,1,8,4,4,
+         0,-1,0,1,-1,0,0,0,1,8,4,4,
+         -1,1,0,-1,0,0,0,0,1,8,4,4,
+         -1,1,0,0,1,0,0,0,1,8,4,4,
+         1,0,0,1,-1,0,0,0,1,8,4,4,
+         0,-1,0,-1,0,0,0,0,1,8,4,4,
+         // R_3_m:R
+         1,0,0,0,1,0,0,0,1,0,0,0,
+         0,0,1,1,0,0,0,1,0,0,0,0,
+         0,1,0,0,0,1,1,0,0,0,0,0,
+         0,1,0,1,0,0,0,0,1,0,0,0,
+         0,0,1,0,1,0,1,0,0,0,0,0,
+         1,0,0,0,0,1,0,1,0,0,0,0,
+      };
+
+      // 3D space groups, sorted by name
+      constexpr GroupTableEntry groupTable3[] = {
+         {"A_b_a_2", 8, 0},
+         {"A_b_m_2", 8, 96},
+         {"A_m_a_2", 8, 192},
+         {"A_m_m_2", 8, 288},
+         {"C_1_2%c_1", 8, 384},
+         {"C_1_2%m_1", 8, 480},
+         {"C_1_2_1", 4, 576},
+         {"C_1_c_1", 4, 624},
+         {"C_1_m_1", 4, 672},
+         {"C_2_2_2", 8, 720},
+         {"C_2_2_21", 8, 816},
+         {"C_c_c_2", 8, 912},
+         {"C_c_c_a:1", 16, 1008},
+         {"C_c_c_a:2", 16, 1200},
+         {"C_c_c_m", 16, 1392},
+         {"C_m_c_21", 8, 1584},
+         {"C_m_c_a", 16, 1680},
+         {"C_m_c_m", 16, 1872},
+         {"C_m_m_2", 8, 2064},
+         {"C_m_m_a", 16, 2160},
+         {"C_m_m_m", 16, 2352},
+         {"F_-4_3_c", 96, 2544},
+         {"F_-4_3_m", 96, 3696},
+         {"F_2_2_2", 16, 4848},
+         {"F_2_3", 48, 5040},
+         {"F_41_3_2", 96, 5616},
+         {"F_4_3_2", 96, 6768},
+         {"F_d_-3:1", 96, 7920},
+         {"F_d_-3:2", 96, 9072},
+         {"F_d_-3_c:1", 192, 10224},
+         {"F_d_-3_c:2", 192, 12528},
+         {"F_d_-3_m:1", 192, 14832},
+         {"F_d_-3_m:2", 192, 17136},
+         {"F_d_d_2", 16, 19440},
+         {"F_d_d_d:1", 32, 19632},
+         {"F_d_d_d:2", 32, 20016},
+         {"F_m_-3", 96, 20400},
+         {"F_m_-3_c", 192, 21552},
+         {"F_m_-3_m", 192, 23856},
+         {"F_m_m_2", 16, 26160},
+         {"F_m_m_m", 32, 26352},
+         {"I_-4", 8, 26736},
+         {"I_-4_2_d", 16, 26832},
+         {"I_-4_2_m", 16, 27024},
+         {"I_-4_3_d", 48, 27216},
+         {"I_-4_3_m", 48, 27792},
+         {"I_-4_c_2", 16, 28368},
+         {"I_-4_m_2", 16, 28560},
+         {"I_21_21_21", 8, 28752},
+         {"I_21_3", 24, 28848},
+         {"I_2_2_2", 8, 29136},
+         {"I_2_3", 24, 29232},
+         {"I_4", 8, 29520},
+         {"I_4%m", 16, 29616},
+         {"I_4%m_c_m", 32, 29808},
+         {"I_4%m_m_m", 32, 30192},
+         {"I_41", 8, 30576},
+         {"I_41%a:1", 16, 30672},
+         {"I_41%a:2", 16, 30864},
+         {"I_41%a_c_d:1", 32, 31056},
+         {"I_41%a_c_d:2", 32, 31440},
+         {"I_41%a_m_d:1", 32, 31824},
+         {"I_41%a_m_d:2", 32, 32208},
+         {"I_41_2_2", 16, 32592},
+         {"I_41_3_2", 48, 32784},
+         {"I_41_c_d", 16, 33360},
+         {"I_41_m_d", 16, 33552},
+         {"I_4_2_2", 16, 33744},
+         {"I_4_3_2", 48, 33936},
+         {"I_4_c_m", 16, 34512},
+         {"I_4_m_m", 16, 34704},
+         {"I_a_-3", 48, 34896},
+         {"I_a_-3_d", 96, 35472},
+         {"I_b_a_2", 8, 36624},
+         {"I_b_a_m", 16, 36720},
+         {"I_b_c_a", 16, 36912},
+         {"I_m_-3", 48, 37104},
+         {"I_m_-3_m", 96, 37680},
+         {"I_m_a_2", 8, 38832},
+         {"I_m_m_2", 8, 38928},
+         {"I_m_m_a", 16, 39024},
+         {"I_m_m_m", 16, 39216},
+         {"P_-1", 2, 39408},
+         {"P_-3", 6, 39432},
+         {"P_-3_1_c", 12, 39504},
+         {"P_-3_1_m", 12, 39648},
+         {"P_-3_c_1", 12, 39792},
+         {"P_-3_m_1", 12, 39936},
+         {"P_-4", 4, 40080},
+         {"P_-4_21_c", 8, 40128},
+         {"P_-4_21_m", 8, 40224},
+         {"P_-4_2_c", 8, 40320},
+         {"P_-4_2_m", 8, 40416},
+         {"P_-4_3_m", 24, 40512},
+         {"P_-4_3_n", 24, 40800},
+         {"P_-4_b_2", 8, 41088},
+         {"P_-4_c_2", 8, 41184},
+         {"P_-4_m_2", 8, 41280},
+         {"P_-4_n_2", 8, 41376},
+         {"P_-6", 6, 41472},
+         {"P_-6_2_c", 12, 41544},
+         {"P_-6_2_m", 12, 41688},
+         {"P_-6_c_2", 12, 41832},
+         {"P_-6_m_2", 12, 41976},
+         {"P_1", 1, 42120},
+         {"P_1_2%c_1", 4, 42132},
+         {"P_1_2%m_1", 4, 42180},
+         {"P_1_21%c_1", 4, 42228},
+         {"P_1_21%m_1", 4, 42276},
+         {"P_1_21_1", 2, 42324},
+         {"P_1_2_1", 2, 42348},
+         {"P_1_c_1", 2, 42372},
+         {"P_1_m_1", 2, 42396},
+         {"P_21_21_2", 4, 42420},
+         {"P_21_21_21", 4, 42468},
+         {"P_21_3", 12, 42516},
+         {"P_2_2_2", 4, 42660},
+         {"P_2_2_21", 4, 42708},
+         {"P_2_3", 12, 42756},
+         {"P_3", 3, 42900},
+         {"P_31", 3, 42936},
+         {"P_31_1_2", 6, 42972},
+         {"P_31_2_1", 6, 43044},
+         {"P_32", 3, 43116},
+         {"P_32_1_2", 6, 43152},
+         {"P_32_2_1", 6, 43224},
+         {"P_3_1_2", 6, 43296},
+         {"P_3_1_c", 6, 43368},
+         {"P_3_1_m", 6, 43440},
+         {"P_3_2_1", 6, 43512},
+         {"P_3_c_1", 6, 43584},
+         {"P_3_m_1", 6, 43656},
+         {"P_4", 4, 43728},
+         {"P_4%m", 8, 43776},
+         {"P_4%m_b_m", 16, 43872},
+         {"P_4%m_c_c", 16, 44064},
+         {"P_4%m_m_m", 16, 44256},
+         {"P_4%m_n_c", 16, 44448},
+         {"P_4%n:1", 8, 44640},
+         {"P_4%n:2", 8, 44736},
+         {"P_4%n_b_m:1", 16, 44832},
+         {"P_4%n_b_m:2", 16, 45024},
+         {"P_4%n_c_c:1", 16, 45216},
+         {"P_4%n_c_c:2", 16, 45408},
+         {"P_4%n_m_m:1", 16, 45600},
+         {"P_4%n_m_m:2", 16, 45792},
+         {"P_4%n_n_c:1", 16, 45984},
+         {"P_4%n_n_c:2", 16, 46176},
+         {"P_41", 4, 46368},
+         {"P_41_21_2", 8, 46416},
+         {"P_41_2_2", 8, 46512},
+         {"P_41_3_2", 24, 46608},
+         {"P_42", 4, 46896},
+         {"P_42%m", 8, 46944},
+         {"P_42%m_b_c", 16, 47040},
+         {"P_42%m_c_m", 16, 47232},
+         {"P_42%m_m_c", 16, 47424},
+         {"P_42%m_n_m", 16, 47616},
+         {"P_42%n:1", 8, 47808},
+         {"P_42%n:2", 8, 47904},
+         {"P_42%n_b_c:1", 16, 48000},
+         {"P_42%n_b_c:2", 16, 48192},
+         {"P_42%n_c_m:1", 16, 48384},
+         {"P_42%n_c_m:2", 16, 48576},
+         {"P_42%n_m_c:1", 16, 48768},
+         {"P_42%n_m_c:2", 16, 48960},
+         {"P_42%n_n_m:1", 16, 49152},
+         {"P_42%n_n_m:2", 16, 49344},
+         {"P_42_21_2", 8, 49536},
+         {"P_42_2_2", 8, 49632},
+         {"P_42_3_2", 24, 49728},
+         {"P_42_b_c", 8, 50016},
+         {"P_42_c_m", 8, 50112},
+         {"P_42_m_c", 8, 50208},
+         {"P_42_n_m", 8, 50304},
+         {"P_43", 4, 50400},
+         {"P_43_21_2", 8, 50448},
+         {"P_43_2_2", 8, 50544},
+         {"P_43_3_2", 24, 50640},
+         {"P_4_21_2", 8, 50928},
+         {"P_4_2_2", 8, 51024},
+         {"P_4_3_2", 24, 51120},
+         {"P_4_b_m", 8, 51408},
+         {"P_4_c_c", 8, 51504},
+         {"P_4_m_m", 8, 51600},
+         {"P_4_n_c", 8, 51696},
+         {"P_6", 6, 51792},
+         {"P_6%m", 12, 51864},
+         {"P_6%m_c_c", 24, 52008},
+         {"P_6%m_m_m", 24, 52296},
+         {"P_61", 6, 52584},
+         {"P_61_2_2", 12, 52656},
+         {"P_62", 6, 52800},
+         {"P_62_2_2", 12, 52872},
+         {"P_63", 6, 53016},
+         {"P_63%m", 12, 53088},
+         {"P_63%m_c_m", 24, 53232},
+         {"P_63%m_m_c", 24, 53520},
+         {"P_63_2_2", 12, 53808},
+         {"P_63_c_m", 12, 53952},
+         {"P_63_m_c", 12, 54096},
+         {"P_64", 6, 54240},
+         {"P_64_2_2", 12, 54312},
+         {"P_65", 6, 54456},
+         {"P_65_2_2", 12, 54528},
+         {"P_6_2_2", 12, 54672},
+         {"P_6_c_c", 12, 54816},
+         {"P_6_m_m", 12, 54960},
+         {"P_a_-3", 24, 55104},
+         {"P_b_a_2", 4, 55392},
+         {"P_b_a_m", 8, 55440},
+         {"P_b_a_n:1", 8, 55536},
+         {"P_b_a_n:2", 8, 55632},
+         {"P_b_c_a", 8, 55728},
+         {"P_b_c_m", 8, 55824},
+         {"P_b_c_n", 8, 55920},
+         {"P_c_a_21", 4, 56016},
+         {"P_c_c_2", 4, 56064},
+         {"P_c_c_a", 8, 56112},
+         {"P_c_c_m", 8, 56208},
+         {"P_c_c_n", 8, 56304},
+         {"P_m_-3", 24, 56400},
+         {"P_m_-3_m", 48, 56688},
+         {"P_m_-3_n", 48, 57264},
+         {"P_m_a_2", 4, 57840},
+         {"P_m_c_21", 4, 57888},
+         {"P_m_m_2", 4, 57936},
+         {"P_m_m_a", 8, 57984},
+         {"P_m_m_m", 8, 58080},
+         {"P_m_m_n:1", 8, 58176},
+         {"P_m_m_n:2", 8, 58272},
+         {"P_m_n_21", 4, 58368},
+         {"P_m_n_a", 8, 58416},
+         {"P_n_-3:1", 24, 58512},
+         {"P_n_-3:2", 24, 58800},
+         {"P_n_-3_m:1", 48, 59088},
+         {"P_n_-3_m:2", 48, 59664},
+         {"P_n_-3_n:1", 48, 60240},
+         {"P_n_-3_n:2", 48, 60816},
+         {"P_n_a_21", 4, 61392},
+         {"P_n_c_2", 4, 61440},
+         {"P_n_m_a", 8, 61488},
+         {"P_n_n_2", 4, 61584},
+         {"P_n_n_a", 8, 61632},
+         {"P_n_n_m", 8, 61728},
+         {"P_n_n_n:1", 8, 61824},
+         {"P_n_n_n:2", 8, 61920},
+         {"R_-3:H", 18, 62016},
+         {"R_-3:R", 6, 62232},
+         {"R_-3_c:H", 36, 62304},
+         {"R_-3_c:R", 12, 62736},
+         {"R_-3_m:H", 36, 62880},
+         {"R_-3_m:R", 12, 63312},
+         {"R_3:H", 9, 63456},
+         {"R_3:R", 3, 63564},
+         {"R_3_2:H", 18, 63600},
+         {"R_3_2:R", 6, 63816},
+         {"R_3_c:H", 18, 63888},
+         {"R_3_c:R", 6, 64104},
+         {"R_3_m:H", 18, 64176},
+         {"R_3_m:R", 6, 64392},
+      };
+
+      constexpr int nGroup3 = 261;
+
+      /*
+      * Comparator for binary search of a table by group name.
+      */
+      struct GroupTableNameComp
+      {
+         bool operator() (GroupTableEntry const & a, char const * b) const
+         {  return (std::strcmp(a.name, b) < 0); }
+      };
+
+   }
+
+   /*
+   * Get number of space groups in the table for dimension D.
+   */
+   int nTableGroup(int D)
+   {
+      if (D == 1) return nGroup1;
+      if (D == 2) return nGroup2;
+      if (D == 3) return nGroup3;
+      UTIL_THROW("Invalid dimension of space");
+      return 0;
+   }
+
+   /*
+   * Get an entry in the table for dimension D.
+   */
+   GroupTableEntry const & tableGroup(int D, int i)
+   {
+      UTIL_CHECK(i >= 0 && i < nTableGroup(D));
+      if (D == 1) return groupTable1[i];
+      if (D == 2) return groupTable2[i];
+      return groupTable3[i];
+   }
+
+   /*
+   * Get array of symmetry elements of all groups for dimension D.
+   */
+   signed char const * tableGroupData(int D)
+   {
+      if (D == 1) return groupData1;
+      if (D == 2) return groupData2;
+      if (D == 3) return groupData3;
+      UTIL_THROW("Invalid dimension of space");
+      return 0;
+   }
+
+   /*
+   * Find index of a group in the table for dimension D.
+   */
+   int findTableGroup(int D, std::string const & groupName)
+   {
+      int n = nTableGroup(D);
+      GroupTableEntry const * begin = &tableGroup(D, 0);
+      GroupTableEntry const * end = begin + n;
+      GroupTableNameComp comp;
+      GroupTableEntry const * ptr
+                    = std::lower_bound(begin, end, groupName.c_str(), comp);
+      if (ptr != end && groupName == ptr->name) {
+         return (int)(ptr - begin);
+      } else {
+         return -1;
+      }
+   }
+
+} // namespace Pscf
@@ -0,0 +1,85 @@
+#ifndef PSCF_GROUP_TABLES_H
+#define PSCF_GROUP_TABLES_H
+
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include <string>
+
+namespace Pscf {
+
+   /**
+   * Entry for one space group in a table compiled into the library.
+   *
+   * The symmetry elements of all groups of a given dimension D are
+   * stored consecutively in an array returned by tableGroupData(D).
+   * Each element is stored as D*D elements of the rotation matrix, in
+   * row major order, followed by the D elements of the translation
+   * vector, each multiplied by groupTableDenominator.
+   *
+   * \ingroup Pscf_Crystal_Module
+   */
+   struct GroupTableEntry
+   {
+      /// Standard name of the group (name of file in data/groups/D).
+      char const * name;
+      /// Number of symmetry elements.
+      int size;
+      /// Index of the first value for this group in the data array.
+      int offset;
+   };
+
+   /**
+   * Common denominator of translations in space group tables.
+   *
+   * \ingroup Pscf_Crystal_Module
+   */
+   const int groupTableDenominator = 12;
+
+   /**
+   * Get number of space groups in the compiled table for dimension D.
+   *
+   * \param D dimensionality of space (D=1,2 or 3)
+   *
+   * \ingroup Pscf_Crystal_Module
+   */
+   int nTableGroup(int D);
+
+   /**
+   * Get an entry in the compiled table of groups for dimension D.
+   *
+   * Entries are sorted by group name.
+   *
+   * \param D dimensionality of space (D=1,2 or 3)
+   * \param i index of group, 0 <= i < nTableGroup(D)
+   *
+   * \ingroup Pscf_Crystal_Module
+   */
+   GroupTableEntry const & tableGroup(int D, int i);
+
+   /**
+   * Get the array of symmetry elements of all groups for dimension D.
+   *
+   * \param D dimensionality of space (D=1,2 or 3)
+   *
+   * \ingroup Pscf_Crystal_Module
+   */
+   signed char const * tableGroupData(int D);
+
+   /**
+   * Find a group in the compiled table for dimension D.
+   *
+   * \param D dimensionality of space (D=1,2 or 3)
+   * \param groupName standard name of space group
+   * \return index of group in table, or -1 if not found
+   *
+   * \ingroup Pscf_Crystal_Module
+   */
+   int findTableGroup(int D, std::string const & groupName);
+
+} // namespace Pscf
+#endif
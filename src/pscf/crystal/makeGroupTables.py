@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+#
+# PSCF - Polymer Self-Consistent Field Theory
+#
+# Generates the source file groupTables.cpp, which contains tables of all
+# space groups in the data/groups directory, from the group files in that
+# directory.
+#
+# Usage:
+#
+#    python3 makeGroupTables.py groupDir outputFile
+#
+# in which groupDir is the path to data/groups, and outputFile is the
+# name of the C++ source file to be written (usually groupTables.cpp).
+# This script is invoked by the groupTables target of the makefile in
+# src/pscf/crystal, and must be rerun after any group file is added to
+# or modified in data/groups.
+#
+# Each symmetry element is stored as D*D elements of the rotation matrix,
+# in row major order, followed by D elements of the translation vector,
+# each multiplied by a common denominator.
+
+import os
+import sys
+from fractions import Fraction
+
+# Common denominator of all translations (see groupTables.h)
+DENOMINATOR = 12
+
+def readGroup(filename, dim):
+   tokens = open(filename).read().split()
+   if tokens[0] != 'dim' or int(tokens[1]) != dim:
+      raise Exception('Invalid dimension in group file ' + filename)
+   if tokens[2] != 'size':
+      raise Exception('Missing size label in group file ' + filename)
+   size = int(tokens[3])
+   values = tokens[4:]
+   nValue = dim*dim + dim
+   if len(values) != size*nValue:
+      raise Exception('Incorrect number of values in ' + filename)
+   elements = []
+   for k in range(size):
+      element = values[k*nValue:(k+1)*nValue]
+      row = [int(x) for x in element[:dim*dim]]
+      for x in element[dim*dim:]:
+         t = Fraction(x)*DENOMINATOR
+         if t.denominator != 1:
+            raise Exception('Invalid translation ' + x + ' in ' + filename)
+         row.append(int(t))
+      elements.append(row)
+   return elements
+
+def writeTables(out, groupDir, dim):
+   names = sorted(os.listdir(os.path.join(groupDir, str(dim))))
+   groups = []
+   for name in names:
+      filename = os.path.join(groupDir, str(dim), name)
+      groups.append((name, readGroup(filename, dim)))
+
+   out.write('      // Symmetry elements of %dD space groups\n' % dim)
+   out.write('      constexpr signed char groupData%d[] = {\n' % dim)
+   for name, elements in groups:
+      out.write('         // %s\n' % name)
+      for row in elements:
+         out.write('         ' + ','.join([str(x) for x in row]) + ',\n')
+   out.write('      };\n\n')
+
+   out.write('      // %dD space groups, sorted by name\n' % dim)
+   out.write('      constexpr GroupTableEntry groupTable%d[] = {\n' % dim)
+   offset = 0
+   for name, elements in groups:
+      out.write('         {"%s", %d, %d},\n' % (name, len(elements), offset))
+      offset += len(elements)*(dim*dim + dim)
+   out.write('      };\n\n')
+   out.write('      constexpr int nGroup%d = %d;\n\n' % (dim, len(groups)))
+
+HEADER = '''/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+/*
+* This file was generated by makeGroupTables.py from the group files in
+* data/groups. Do not edit it by hand. Run "make groupTables" in the
+* src/pscf/crystal directory to regenerate it.
+*/
+
+#include "groupTables.h"
+#include <util/global.h>
+#include <algorithm>
+#include <cstring>
+
+namespace Pscf {
+
+   using namespace Util;
+
+   namespace {
+
+'''
+
+FOOTER = '''      /*
+      * Comparator for binary search of a table by group name.
+      */
+      struct GroupTableNameComp
+      {
+         bool operator() (GroupTableEntry const & a, char const * b) const
+         {  return (std::strcmp(a.name, b) < 0); }
+      };
+
+   }
+
+   /*
+   * Get number of space groups in the table for dimension D.
+   */
+   int nTableGroup(int D)
+   {
+      if (D == 1) return nGroup1;
+      if (D == 2) return nGroup2;
+      if (D == 3) return nGroup3;
+      UTIL_THROW("Invalid dimension of space");
+      return 0;
+   }
+
+   /*
+   * Get an entry in the table for dimension D.
+   */
+   GroupTableEntry const & tableGroup(int D, int i)
+   {
+      UTIL_CHECK(i >= 0 && i < nTableGroup(D));
+      if (D == 1) return groupTable1[i];
+      if (D == 2) return groupTable2[i];
+      return groupTable3[i];
+   }
+
+   /*
+   * Get array of symmetry elements of all groups for dimension D.
+   */
+   signed char const * tableGroupData(int D)
+   {
+      if (D == 1) return groupData1;
+      if (D == 2) return groupData2;
+      if (D == 3) return groupData3;
+      UTIL_THROW("Invalid dimension of space");
+      return 0;
+   }
+
+   /*
+   * Find index of a group in the table for dimension D.
+   */
+   int findTableGroup(int D, std::string const & groupName)
+   {
+      int n = nTableGroup(D);
+      GroupTableEntry const * begin = &tableGroup(D, 0);
+      GroupTableEntry const * end = begin + n;
+      GroupTableNameComp comp;
+      GroupTableEntry const * ptr
+                    = std::lower_bound(begin, end, groupName.c_str(), comp);
+      if (ptr != end && groupName == ptr->name) {
+         return (int)(ptr - begin);
+      } else {
+         return -1;
+      }
+   }
+
+} // namespace Pscf
+'''
+
+if __name__ == '__main__':
+   if len(sys.argv) != 3:
+      print('Usage: python3 makeGroupTables.py groupDir outputFile')
+      sys.exit(1)
+   groupDir = sys.argv[1]
+   out = open(sys.argv[2], 'w')
+   out.write(HEADER)
+   for dim in [1, 2, 3]:
+      writeTables(out, groupDir, dim)
+   out.write(FOOTER)
+   out.close()
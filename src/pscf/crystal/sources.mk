@@ -6,7 +6,8 @@ pscf_crystal_= \
   pscf/crystal/SpaceSymmetry.cpp \
   pscf/crystal/SymmetryGroup.cpp \
   pscf/crystal/Basis.cpp \
-  pscf/crystal/groupFile.cpp
+  pscf/crystal/groupFile.cpp \
+  pscf/crystal/groupTables.cpp
 
 pscf_crystal_SRCS=\
      $(addprefix $(SRC_DIR)/, $(pscf_crystal_))
@@ -0,0 +1,104 @@
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "GramMatrix.h"
+
+namespace Pscf
+{
+
+   using namespace Util;
+
+   /*
+   * Constructor.
+   */
+   GramMatrix::GramMatrix()
+    : data_(),
+      first_(0),
+      size_(0),
+      capacity_(0)
+   {}
+
+   /*
+   * Destructor.
+   */
+   GramMatrix::~GramMatrix()
+   {}
+
+   /*
+   * Allocate memory.
+   */
+   void GramMatrix::allocate(int capacity)
+   {
+      UTIL_CHECK(capacity > 0);
+      UTIL_CHECK(capacity_ == 0);
+      data_.allocate(capacity, capacity);
+      capacity_ = capacity;
+      if (capacity > 1) {
+         umn_.allocate(capacity - 1, capacity - 1);
+         vm_.allocate(capacity - 1);
+         solver_.allocate(capacity - 1);
+      }
+      clear();
+   }
+
+   /*
+   * Clear the history.
+   */
+   void GramMatrix::clear()
+   {
+      first_ = 0;
+      size_ = 0;
+   }
+
+   /*
+   * Add a new vector, discarding the oldest if the history is full.
+   */
+   void GramMatrix::advance()
+   {
+      UTIL_CHECK(capacity_ > 0);
+      first_ = (first_ > 0) ? first_ - 1 : capacity_ - 1;
+      if (size_ < capacity_) {
+         ++size_;
+      }
+   }
+
+   /*
+   * Set the inner product of the newest vector with vector k.
+   */
+   void GramMatrix::set(int k, double value)
+   {
+      UTIL_CHECK(k >= 0 && k < size_);
+      int s = slot(k);
+      data_(first_, s) = value;
+      data_(s, first_) = value;
+   }
+
+   /*
+   * Compute Anderson mixing coefficients.
+   */
+   void GramMatrix::computeCoefficients(Array<double>& coeffs)
+   {
+      int n = size_ - 1;
+      UTIL_CHECK(n > 0);
+      UTIL_CHECK(coeffs.capacity() >= n);
+      int i, j;
+      for (i = 0; i < n; ++i) {
+         for (j = i; j < n; ++j) {
+            umn_(i, j) = umn(i, j);
+            umn_(j, i) = umn_(i, j);
+         }
+         vm_[i] = vm(i);
+      }
+      if (n == 1) {
+         coeffs[0] = vm_[0]/umn_(0, 0);
+      } else {
+         solver_.computeLU(umn_, n);
+         solver_.solve(vm_, coeffs);
+      }
+   }
+
+}
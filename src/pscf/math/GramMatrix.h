@@ -0,0 +1,194 @@
+#ifndef PSCF_GRAM_MATRIX_H
+#define PSCF_GRAM_MATRIX_H
+
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include <pscf/math/LuSolver.h>
+#include <util/containers/DMatrix.h>
+#include <util/containers/DArray.h>
+#include <util/containers/Array.h>
+#include <util/global.h>
+
+namespace Pscf 
+{
+
+   using namespace Util;
+
+   /**
+   * Ring-buffered matrix of inner products of a history of vectors.
+   *
+   * A GramMatrix stores the inner products G(i,j) = (v_i, v_j) of the
+   * most recent vectors in a history, where v_0 is the most recent 
+   * vector, v_1 is the previous vector, etc., using the same indexing 
+   * convention as a Util::RingBuffer. When a new vector is added, the
+   * advance() function shifts all indices by one, discarding the oldest
+   * vector if the history is full, and the inner products of the new 
+   * vector with all retained vectors (including itself) must then be
+   * set by calls to set(k, value). All other elements are retained, so
+   * only one row and column are computed per step.
+   *
+   * The functions umn and vm return the elements of the matrix and 
+   * vector used to compute mixing coefficients in Anderson mixing, in 
+   * which v_k are residual vectors, and computeCoefficients solves the
+   * resulting linear least squares problem. This class thus contains
+   * all of the history and least squares code of an Anderson mixing
+   * iterator that does not depend on the representation of a field.
+   *
+   * \ingroup Pscf_Math_Module
+   */  
+   class GramMatrix
+   {
+   public:
+
+      /**
+      * Constructor.
+      */
+      GramMatrix();
+
+      /**
+      * Destructor.
+      */
+      ~GramMatrix();
+
+      /**
+      * Allocate memory.
+      *
+      * \param capacity maximum number of vectors in the history
+      */
+      void allocate(int capacity);
+
+      /**
+      * Clear the history (set size to zero).
+      */
+      void clear();
+
+      /**
+      * Add a new vector to the history.
+      *
+      * Upon return, index 0 refers to the new vector, for which inner
+      * products must be set by calling set(k, value) for all 
+      * 0 <= k < size().
+      */
+      void advance();
+
+      /**
+      * Set the inner product of the newest vector with vector k.
+      *
+      * \param k index of vector in history (0 = newest)
+      * \param value inner product (v_0, v_k)
+      */
+      void set(int k, double value);
+
+      /**
+      * Return the inner product of vectors i and j.
+      *
+      * \param i index of vector in history (0 = newest)
+      * \param j index of vector in history (0 = newest)
+      */
+      double operator () (int i, int j) const;
+
+      /**
+      * Return element (m,n) of the Anderson mixing matrix.
+      *
+      * Returns (v_0 - v_{m+1}, v_0 - v_{n+1}).
+      *
+      * \param m row index, 0 <= m < size() - 1
+      * \param n column index, 0 <= n < size() - 1
+      */
+      double umn(int m, int n) const;
+
+      /**
+      * Return element m of the Anderson mixing vector.
+      *
+      * Returns (v_0 - v_{m+1}, v_0).
+      *
+      * \param m index, 0 <= m < size() - 1
+      */
+      double vm(int m) const;
+
+      /**
+      * Compute Anderson mixing coefficients.
+      *
+      * Computes the coefficients C_m, for 0 <= m < size() - 1, that 
+      * minimize the norm of v_0 + sum_m C_m (v_{m+1} - v_0), by solving
+      * the linear equations sum_n umn(m,n) C_n = vm(m). Requires that 
+      * size() > 1.
+      *
+      * \param coeffs array of coefficients C_m (output)
+      */
+      void computeCoefficients(Array<double>& coeffs);
+
+      /**
+      * Return the number of vectors in the history.
+      */
+      int size() const;
+
+      /**
+      * Return the maximum number of vectors in the history.
+      */
+      int capacity() const;
+
+   private:
+
+      /// Inner products, indexed by storage slot.
+      DMatrix<double> data_;
+
+      /// Storage slot of the newest vector.
+      int first_;
+
+      /// Number of vectors in the history.
+      int size_;
+
+      /// Maximum number of vectors in the history.
+      int capacity_;
+
+      /// Anderson mixing matrix (work space).
+      DMatrix<double> umn_;
+
+      /// Anderson mixing vector (work space).
+      DArray<double> vm_;
+
+      /// Solver for the mixing coefficients.
+      LuSolver solver_;
+
+      /// Return storage slot of vector i.
+      int slot(int i) const;
+
+   };
+
+   // Inline member functions
+
+   inline int GramMatrix::slot(int i) const
+   {
+      int k = first_ + i;
+      return (k < capacity_) ? k : k - capacity_;
+   }
+
+   inline double GramMatrix::operator () (int i, int j) const
+   {
+      UTIL_ASSERT(i < size_ && j < size_);
+      return data_(slot(i), slot(j)); 
+   }
+
+   inline double GramMatrix::umn(int m, int n) const
+   {
+      return data_(first_, first_) + (*this)(m+1, n+1) 
+             - (*this)(0, m+1) - (*this)(0, n+1);
+   }
+
+   inline double GramMatrix::vm(int m) const
+   {  return data_(first_, first_) - (*this)(0, m+1); }
+
+   inline int GramMatrix::size() const
+   {  return size_; }
+
+   inline int GramMatrix::capacity() const
+   {  return capacity_; }
+
+}
+#endif
@@ -14,7 +14,8 @@ namespace Pscf
    LuSolver::LuSolver()
     : luPtr_(0),
       permPtr_(0),
-      n_(0)
+      n_(0),
+      m_(0)
    {
       // Initialize gs_vector b_ 
       b_.size = 0;
@@ -29,6 +30,16 @@ namespace Pscf
       x_.data = 0;
       x_.block = 0;
       x_.owner = 0;
+
+      // Initialize views of the LU matrix and permutation
+      lu_.size1 = 0;
+      lu_.size2 = 0;
+      lu_.tda = 0;
+      lu_.data = 0;
+      lu_.block = 0;
+      lu_.owner = 0;
+      perm_.size = 0;
+      perm_.data = 0;
    }
 
    LuSolver::~LuSolver()
@@ -55,6 +66,7 @@ namespace Pscf
       b_.size = n;
       x_.size = n;
       n_ = n;
+      m_ = n;
    }
 
    /*
@@ -75,6 +87,46 @@ namespace Pscf
          }
       }
       gsl_linalg_LU_decomp(luPtr_, permPtr_, &signum_);
+      m_ = n_;
+      b_.size = n_;
+      x_.size = n_;
+   }
+
+   /*
+   * Compute the LU decomposition of the leading n x n block of A.
+   */
+   void LuSolver::computeLU(const Matrix<double>& A, int n)
+   {
+      UTIL_CHECK(n_ > 0);
+      UTIL_CHECK(n > 0 && n <= n_);
+      UTIL_CHECK(A.capacity1() >= n);
+      UTIL_CHECK(A.capacity2() >= n);
+      if (n == n_ && A.capacity1() == n_ && A.capacity2() == n_) {
+         computeLU(A);
+         return;
+      }
+
+      // Copy leading block into contiguous n x n storage 
+      int i, j;
+      int k = 0;
+      for (i = 0; i < n;  ++i) {
+         for (j = 0; j < n; ++j) {
+            luPtr_->data[k] = A(i,j);
+            ++k;
+         }
+      }
+
+      // Decompose using views of the leading parts of luPtr_, permPtr_
+      lu_.size1 = n;
+      lu_.size2 = n;
+      lu_.tda = n;
+      lu_.data = luPtr_->data;
+      perm_.size = n;
+      perm_.data = permPtr_->data;
+      gsl_linalg_LU_decomp(&lu_, &perm_, &signum_);
+      m_ = n;
+      b_.size = n;
+      x_.size = n;
    }
 
    /*
@@ -83,15 +135,19 @@ namespace Pscf
    void LuSolver::solve(Array<double>& b, Array<double>& x)
    {
       UTIL_CHECK(n_ > 0);
-      UTIL_CHECK(b.capacity() == n_);
-      UTIL_CHECK(x.capacity() == n_);
+      UTIL_CHECK(b.capacity() >= m_);
+      UTIL_CHECK(x.capacity() >= m_);
 
       // Associate gsl_vectors b_ and x_ with Arrays b and x
       b_.data = b.cArray();
       x_.data = x.cArray();
 
       // Solve system of equations
-      gsl_linalg_LU_solve(luPtr_, permPtr_, &b_, &x_);
+      if (m_ == n_) {
+         gsl_linalg_LU_solve(luPtr_, permPtr_, &b_, &x_);
+      } else {
+         gsl_linalg_LU_solve(&lu_, &perm_, &b_, &x_);
+      }
 
       // Destroy temporary associations
       b_.data = 0;
@@ -104,6 +160,7 @@ namespace Pscf
    void LuSolver::inverse(Matrix<double>& inv)
    {   
       UTIL_CHECK(n_ > 0); 
+      UTIL_CHECK(m_ == n_); 
 
       gMatInverse_->data = inv.cArray();
       gsl_linalg_LU_invert(luPtr_, permPtr_, gMatInverse_);
@@ -55,6 +55,20 @@ namespace Pscf
       */
       void computeLU(const Matrix<double>& A);
 
+      /**
+      * Compute the LU decomposition of the leading n x n block of A.
+      *
+      * This allows a solver that was allocated with a maximum dimension
+      * to be reused for smaller systems without reallocation. Matrix A 
+      * may have any dimensions greater than or equal to n, and n may 
+      * not exceed the dimension passed to allocate. Subsequent calls to 
+      * solve use the leading n elements of arrays b and x.
+      *
+      * \param A the square matrix A in problem Ax=b (leading block).
+      * \param n dimension of the leading block of A
+      */
+      void computeLU(const Matrix<double>& A, int n);
+
       /**
       * Solve Ax = b for known b to compute x.
       *
@@ -81,6 +95,12 @@ namespace Pscf
       /// Pointer to LU decomposition matrix.
       gsl_matrix* luPtr_;
 
+      /// View of the leading m_ x m_ block of luPtr_->data.
+      gsl_matrix lu_;
+
+      /// View of the first m_ elements of permPtr_->data.
+      gsl_permutation perm_;
+
       /// Pointer to inverse matrix.
       gsl_matrix* gMatInverse_;
 
@@ -93,6 +113,9 @@ namespace Pscf
       /// Number of rows and columns in matrix.
       int n_;
 
+      /// Number of rows and columns in most recent decomposition.
+      int m_;
+
    };
 
 }
@@ -9,6 +9,7 @@
 #include <iostream>
 
 #include "TridiagonalSolver.h"
+#include <util/global.h>
 
 namespace Pscf
 {
@@ -133,4 +134,52 @@ namespace Pscf
        }
    }
 
+   /*
+   * Solve Ax = b for several interleaved vectors b.
+   */
+   void TridiagonalSolver::solve(const Array<double>& b, Array<double>& x,
+                                 int nBatch)
+   {
+      UTIL_CHECK(nBatch > 0);
+      UTIL_CHECK(b.capacity() >= n_*nBatch);
+      UTIL_CHECK(x.capacity() >= n_*nBatch);
+      double const * bp = &b[0];
+      double * xp = &x[0];
+      double li, ui, di;
+      int i, k, j;
+
+      // Solve Ly = b by forward substitution, storing y in x.
+      for (k = 0; k < nBatch; ++k) {
+         xp[k] = bp[k];
+      }
+      for (i = 1; i < n_; ++i) {
+         li = l_[i-1];
+         j = i*nBatch;
+         #ifdef PSCF_OPENMP
+         #pragma omp simd
+         #endif
+         for (k = 0; k < nBatch; ++k) {
+            xp[j + k] = bp[j + k] - li*xp[j - nBatch + k];
+         }
+      }
+
+      // Solve Ux = y by back substitution.
+      di = d_[n_ - 1];
+      j = (n_ - 1)*nBatch;
+      for (k = 0; k < nBatch; ++k) {
+         xp[j + k] = xp[j + k]/di;
+      }
+      for (i = n_ - 2; i >= 0; --i) {
+         ui = u_[i];
+         di = d_[i];
+         j = i*nBatch;
+         #ifdef PSCF_OPENMP
+         #pragma omp simd
+         #endif
+         for (k = 0; k < nBatch; ++k) {
+            xp[j + k] = (xp[j + k] - ui*xp[j + nBatch + k])/di;
+         }
+      }
+   }
+
 }
@@ -8,6 +8,7 @@
 * Distributed under the terms of the GNU General Public License.
 */
 
+#include <util/containers/Array.h>
 #include <util/containers/DArray.h>
 
 #include <string>
@@ -80,6 +81,21 @@ namespace Pscf
       */
       void solve(const DArray<double>& b, DArray<double>& x);
 
+      /**
+      * Solve Ax = b for several vectors b, stored in interleaved order.
+      *
+      * Element i of vector k is stored in element i*nBatch + k of the
+      * arrays b and x, so that the innermost loops over vectors can
+      * be vectorized. Each vector is processed by exactly the same 
+      * operations as in solve(b, x). The arrays b and x may be the 
+      * same array, for in-place solution.
+      *
+      * \param b known vectors on RHS (input)
+      * \param x unknown solution vectors of Ax = b (output)
+      * \param nBatch number of vectors
+      */
+      void solve(const Array<double>& b, Array<double>& x, int nBatch);
+
    private:
 
       // Diagonal elements
@@ -0,0 +1,52 @@
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "continuation.h"
+#include <util/global.h>
+
+namespace Pscf
+{
+
+   /*
+   * Compute Lagrange polynomial extrapolation coefficients.
+   */
+   void lagrangeCoefficients(Array<double> const & x, int n, 
+                             double xNew, Array<double>& c)
+   {
+      UTIL_CHECK(n > 0);
+      UTIL_CHECK(n <= x.capacity());
+      UTIL_CHECK(n <= c.capacity());
+      int j, k;
+      for (k = 0; k < n; ++k) {
+         c[k] = 1.0;
+         for (j = 0; j < n; ++j) {
+            if (j != k) {
+               UTIL_CHECK(x[k] != x[j]);
+               c[k] *= (xNew - x[j])/(x[k] - x[j]);
+            }
+         }
+      }
+   }
+
+   /*
+   * Adjust a continuation step size to a target number of iterations.
+   */
+   double adjustStepSize(double ds, int nItr, int nItrTarget, 
+                         double dsMin, double dsMax)
+   {
+      UTIL_CHECK(nItrTarget > 0);
+      if (nItr < 1) nItr = 1;
+      double factor = double(nItrTarget)/double(nItr);
+      if (factor > 2.0) factor = 2.0;
+      if (factor < 0.5) factor = 0.5;
+      ds *= factor;
+      if (ds > dsMax) ds = dsMax;
+      if (ds < dsMin) ds = dsMin;
+      return ds;
+   }
+
+}
@@ -0,0 +1,55 @@
+#ifndef PSCF_CONTINUATION_H
+#define PSCF_CONTINUATION_H
+
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include <util/containers/Array.h>
+
+namespace Pscf
+{
+
+   using namespace Util;
+
+   /**
+   * Compute Lagrange polynomial extrapolation coefficients.
+   *
+   * On return, a polynomial of degree n - 1 through values f[k] at
+   * points x[k], for k = 0, ..., n - 1, has the value sum_k c[k]*f[k]
+   * at point xNew. The points x[k] must be distinct. This is used by
+   * sweeps to construct an initial guess from previous solutions.
+   *
+   * \param x  array of points (input)
+   * \param n  number of points (input)
+   * \param xNew  point at which to extrapolate (input)
+   * \param c  array of coefficients (output)
+   *
+   * \ingroup Pscf_Math_Module
+   */
+   void lagrangeCoefficients(Array<double> const & x, int n, 
+                             double xNew, Array<double>& c);
+
+   /**
+   * Adjust a continuation step size to a target number of iterations.
+   *
+   * Returns ds multiplied by nItrTarget/nItr, with the factor limited
+   * to the range [0.5, 2], and the result limited to [dsMin, dsMax].
+   *
+   * \param ds  step size of the last converged step
+   * \param nItr  number of iterations required by the last step
+   * \param nItrTarget  desired number of iterations per step (> 0)
+   * \param dsMin  minimum step size
+   * \param dsMax  maximum step size
+   * \return new step size
+   *
+   * \ingroup Pscf_Math_Module
+   */
+   double adjustStepSize(double ds, int nItr, int nItrTarget, 
+                         double dsMin, double dsMax);
+
+}
+#endif
@@ -1,6 +1,8 @@
 pscf_math_= \
   pscf/math/LuSolver.cpp \
+  pscf/math/GramMatrix.cpp \
   pscf/math/TridiagonalSolver.cpp \
+  pscf/math/continuation.cpp \
   pscf/math/IntVec.cpp \
   pscf/math/Field.cpp
 
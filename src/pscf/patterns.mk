@@ -21,6 +21,11 @@ LIBS=$(PSCF_LIBS)
 INCLUDES+=$(GSL_INC)
 LIBS+=$(GSL_LIB) 
 
+# Add OpenMP runtime library, if threading is enabled
+ifdef PSCF_OPENMP
+LIBS+=$(OPENMP_FLAGS)
+endif
+
 # Preprocessor macro definitions needed in src/pscf
 DEFINES=$(PSCF_DEFS) $(UTIL_DEFS)
 
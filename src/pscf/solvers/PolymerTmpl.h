@@ -16,9 +16,14 @@
 #include <util/containers/Pair.h>        // member template
 #include <util/containers/DArray.h>      // member template
 #include <util/containers/DMatrix.h>
+#include <util/containers/GArray.h>      // member template
 
 #include <cmath>
 
+#if defined(PSCF_OPENMP) && defined(_OPENMP)
+#include <omp.h>
+#endif
+
 namespace Pscf
 { 
 
@@ -73,8 +78,32 @@ namespace Pscf
       *
       * Upon return, q functions and block concentration fields
       * are computed for all propagators and blocks. 
+      *
+      * If compiled with OpenMP and more than one thread is available,
+      * propagators are solved by tasks that are launched as soon as 
+      * all of their source propagators have been solved, so that
+      * independent propagators (e.g., those that start at different
+      * chain ends) are solved concurrently. The two propagators of
+      * one block share work space within the Block, and so are never
+      * solved at the same time. Threads may be disabled by 
+      * setUseThreads(false), in which case solveUnthreaded() is used.
       */ 
       virtual void solve();
+
+      /**
+      * Allow or forbid concurrent solution of propagators by threads.
+      *
+      * Threads are allowed by default. If forbidden, solve() always
+      * calls solveUnthreaded(), even when compiled with OpenMP.
+      *
+      * \param useThreads  true to allow threads, false to forbid them
+      */
+      void setUseThreads(bool useThreads);
+
+      /**
+      * May propagators be solved concurrently by threads?
+      */
+      bool useThreads() const;
  
       /// \name Accessors (objects, by reference)
       //@{
@@ -166,6 +195,27 @@ namespace Pscf
 
       virtual void makePlan();
 
+      /**
+      * Solve the MDE for all propagators, and compute phi or mu.
+      *
+      * This function does everything done by solve() except compute
+      * block concentrations. It returns the molecular partition 
+      * function q, so that a subclass can compute concentrations with
+      * the prefactor phi/(q*length()) used by solve().
+      *
+      * \return molecular partition function q
+      */
+      double solvePropagators();
+
+      /**
+      * Solve the MDE for all propagators, without threads.
+      *
+      * This function is called by solvePropagators() when threads
+      * are not used. The default implementation solves propagators 
+      * one at a time, in the order of the computation plan.
+      */
+      virtual void solveUnthreaded();
+
    private:
 
       /// Array of Block objects in this polymer.
@@ -186,6 +236,35 @@ namespace Pscf
       /// Number of propagators (two per block).
       int nPropagator_;
 
+      /// Number of sources of each propagator, indexed in plan order.
+      DArray<int> nSource_;
+
+      /// Number of unsolved sources of each propagator (work space).
+      DArray<int> nUnsolved_;
+
+      /// Plan indices of propagators that depend on each propagator.
+      DArray< GArray<int> > dependents_;
+
+      /// May propagators be solved concurrently by threads?
+      bool useThreads_;
+
+      #if defined(PSCF_OPENMP) && defined(_OPENMP)
+      /// Locks that prevent concurrent use of a Block by two tasks.
+      DArray<omp_lock_t> blockLocks_;
+
+      /**
+      * Solve all propagators using a dependency-driven task scheduler.
+      */
+      void solveThreaded();
+
+      /**
+      * Solve one propagator, and launch tasks for dependents (private).
+      *
+      * \param id  index of propagator, in order of computation plan
+      */
+      void solvePropagatorTask(int id);
+      #endif
+
    };
 
    /*
@@ -285,6 +364,20 @@ namespace Pscf
       return propagator(propId[0], propId[1]); 
    }
 
+   /*
+   * Allow or forbid concurrent solution of propagators by threads.
+   */
+   template <class Block>
+   inline void PolymerTmpl<Block>::setUseThreads(bool useThreads)
+   {  useThreads_ = useThreads; }
+
+   /*
+   * May propagators be solved concurrently by threads?
+   */
+   template <class Block>
+   inline bool PolymerTmpl<Block>::useThreads() const
+   {  return useThreads_; }
+
    // Non-inline functions
 
    /*
@@ -298,7 +391,11 @@ namespace Pscf
       propagatorIds_(),
       nBlock_(0),
       nVertex_(0),
-      nPropagator_(0)
+      nPropagator_(0),
+      nSource_(),
+      nUnsolved_(),
+      dependents_(),
+      useThreads_(true)
    {  setClassName("PolymerTmpl"); }
 
    /*
@@ -422,6 +519,36 @@ namespace Pscf
          }
       }
 
+      // Map (block, direction) pairs to indices in plan order
+      DMatrix<int> planIndex;
+      planIndex.allocate(nBlock_, 2);
+      for (int i = 0; i < nPropagator_; ++i) {
+         planIndex(propagatorIds_[i][0], propagatorIds_[i][1]) = i;
+      }
+
+      // Construct dependency graph used by the threaded solver
+      nSource_.allocate(nPropagator_);
+      nUnsolved_.allocate(nPropagator_);
+      dependents_.allocate(nPropagator_);
+      int iBlock, iSource;
+      for (int i = 0; i < nPropagator_; ++i) {
+         nSource_[i] = 0;
+      }
+      for (int i = 0; i < nPropagator_; ++i) {
+         iBlock = propagatorIds_[i][0];
+         inVertexId = blocks_[iBlock].vertexId(propagatorIds_[i][1]);
+         inVertexPtr = &vertices_[inVertexId];
+         for (int j = 0; j < inVertexPtr->size(); ++j) {
+            propagatorId = inVertexPtr->inPropagatorId(j);
+            if (propagatorId[0] != iBlock) {
+               iSource = planIndex(propagatorId[0], propagatorId[1]);
+               UTIL_CHECK(iSource < i);
+               dependents_[iSource].append(i);
+               ++nSource_[i];
+            }
+         }
+      }
+
    }
 
    /*
@@ -429,6 +556,21 @@ namespace Pscf
    */ 
    template <class Block>
    void PolymerTmpl<Block>::solve()
+   {
+      double q = solvePropagators();
+
+      // Compute block concentration fields
+      double prefactor = phi_ / (q *length() );
+      for (int i = 0; i < nBlock(); ++i) {
+         block(i).computeConcentration(prefactor);
+      }
+   }
+
+   /*
+   * Solve MDE for all propagators, and compute phi or mu.
+   */ 
+   template <class Block>
+   double PolymerTmpl<Block>::solvePropagators()
    {
 
       // Clear all propagators
@@ -437,10 +579,15 @@ namespace Pscf
       }
 
       // Solve modified diffusion equation for all propagators
-      for (int j = 0; j < nPropagator(); ++j) {
-         UTIL_CHECK(propagator(j).isReady());
-         propagator(j).solve();
+      #if defined(PSCF_OPENMP) && defined(_OPENMP)
+      if (useThreads_ && nBlock_ > 1 && omp_get_max_threads() > 1) {
+         solveThreaded();
+      } else {
+         solveUnthreaded();
       }
+      #else
+      solveUnthreaded();
+      #endif
 
       // Compute molecular partition function
       double q = block(0).propagator(0).computeQ();
@@ -451,13 +598,87 @@ namespace Pscf
          phi_ = exp(mu_)*q;
       }
 
-      // Compute block concentration fields
-      double prefactor = phi_ / (q *length() );
-      for (int i = 0; i < nBlock(); ++i) {
-         block(i).computeConcentration(prefactor);
+      return q;
+   }
+
+   /*
+   * Solve all propagators one at a time, in plan order.
+   */
+   template <class Block>
+   void PolymerTmpl<Block>::solveUnthreaded()
+   {
+      for (int j = 0; j < nPropagator(); ++j) {
+         UTIL_CHECK(propagator(j).isReady());
+         propagator(j).solve();
       }
+   }
 
+   #if defined(PSCF_OPENMP) && defined(_OPENMP)
+   /*
+   * Solve all propagators, using one task per propagator.
+   */
+   template <class Block>
+   void PolymerTmpl<Block>::solveThreaded()
+   {
+      for (int j = 0; j < nPropagator_; ++j) {
+         nUnsolved_[j] = nSource_[j];
+      }
+
+      if (!blockLocks_.isAllocated()) {
+         blockLocks_.allocate(nBlock_);
+      }
+      for (int i = 0; i < nBlock_; ++i) {
+         omp_init_lock(&blockLocks_[i]);
+      }
+
+      // Launch tasks for propagators with no sources (chain ends).
+      // Other tasks are launched by solvePropagatorTask. All tasks 
+      // are complete at the implicit barrier of the parallel region.
+      #pragma omp parallel
+      {
+         #pragma omp single
+         {
+            for (int j = 0; j < nPropagator_; ++j) {
+               if (nSource_[j] == 0) {
+                  #pragma omp task firstprivate(j)
+                  solvePropagatorTask(j);
+               }
+            }
+         }
+      }
+
+      for (int i = 0; i < nBlock_; ++i) {
+         omp_destroy_lock(&blockLocks_[i]);
+      }
+   }
+
+   /*
+   * Solve one propagator, then launch tasks for dependents that are ready.
+   */
+   template <class Block>
+   void PolymerTmpl<Block>::solvePropagatorTask(int id)
+   {
+      #pragma omp flush
+      omp_lock_t& lock = blockLocks_[propagatorIds_[id][0]];
+      omp_set_lock(&lock);
+      UTIL_CHECK(propagator(id).isReady());
+      propagator(id).solve();
+      omp_unset_lock(&lock);
+
+      // Decrement counters of dependents, launch those that are ready
+      #pragma omp flush
+      int k, nUnsolved;
+      for (int j = 0; j < dependents_[id].size(); ++j) {
+         k = dependents_[id][j];
+         #pragma omp atomic capture
+         nUnsolved = --nUnsolved_[k];
+         if (nUnsolved == 0) {
+            #pragma omp task firstprivate(k)
+            solvePropagatorTask(k);
+         }
+      }
    }
+   #endif
  
 }
 #endif
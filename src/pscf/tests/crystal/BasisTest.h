@@ -21,6 +21,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <iterator>
 
 using namespace Util;
 using namespace Pscf;
@@ -351,6 +352,86 @@ public:
 
    }
 
+   void testCache3D_I_a_3b_d()
+   {
+      printMethod(TEST_FUNC);
+
+      UnitCell<3> unitCell;
+      std::ifstream in;
+      openInputFile("in/Cubic", in);
+      in >> unitCell;
+      in.close();
+
+      IntVec<3> d;
+      d[0] = 8;
+      d[1] = 8;
+      d[2] = 8;
+      Mesh<3> mesh(d);
+
+      SpaceGroup<3> group;
+      openInputFile("in/I_a_-3_d", in);
+      in >> group;
+      in.close();
+
+      Basis<3> basis;
+      basis.makeBasis(mesh, unitCell, group);
+      std::string filename = filePrefix() + "out/basisCache";
+      basis.writeCache(filename, "I_a_-3_d");
+
+      // Read cache with the same key
+      Basis<3> other;
+      TEST_ASSERT(other.readCache(filename, mesh, unitCell, 
+                                  "I_a_-3_d"));
+      TEST_ASSERT(other.nWave() == basis.nWave());
+      TEST_ASSERT(other.nStar() == basis.nStar());
+      TEST_ASSERT(other.nBasis() == basis.nBasis());
+      int i;
+      for (i = 0; i < basis.nWave(); ++i) {
+         TEST_ASSERT(other.wave(i).indicesDft == basis.wave(i).indicesDft);
+         TEST_ASSERT(other.wave(i).indicesBz == basis.wave(i).indicesBz);
+         TEST_ASSERT(other.wave(i).starId == basis.wave(i).starId);
+         TEST_ASSERT(eq(other.wave(i).coeff.real(), 
+                        basis.wave(i).coeff.real()));
+         TEST_ASSERT(eq(other.wave(i).coeff.imag(), 
+                        basis.wave(i).coeff.imag()));
+      }
+      for (i = 0; i < basis.nStar(); ++i) {
+         TEST_ASSERT(other.star(i).beginId == basis.star(i).beginId);
+         TEST_ASSERT(other.star(i).invertFlag == basis.star(i).invertFlag);
+         TEST_ASSERT(other.star(i).cancel == basis.star(i).cancel);
+         TEST_ASSERT(other.star(i).waveBz == basis.star(i).waveBz);
+      }
+
+      // Reject cache for a different group or mesh
+      Basis<3> rejected;
+      TEST_ASSERT(!rejected.readCache(filename, mesh, unitCell, 
+                                      "I_m_-3_m"));
+      d[2] = 16;
+      Mesh<3> mesh2(d);
+      TEST_ASSERT(!rejected.readCache(filename, mesh2, unitCell, 
+                                      "I_a_-3_d"));
+      filename = filePrefix() + "out/noSuchFile";
+      TEST_ASSERT(!rejected.readCache(filename, mesh, unitCell, 
+                                      "I_a_-3_d"));
+
+      // Reject a truncated file, then construct the basis instead
+      std::ifstream full((filePrefix() + "out/basisCache").c_str(),
+                         std::ios::in | std::ios::binary);
+      std::string contents((std::istreambuf_iterator<char>(full)),
+                            std::istreambuf_iterator<char>());
+      full.close();
+      filename = filePrefix() + "out/basisCacheTruncated";
+      std::ofstream truncated(filename.c_str(), 
+                              std::ios::out | std::ios::binary);
+      truncated.write(contents.c_str(), contents.size()/2);
+      truncated.close();
+      TEST_ASSERT(!rejected.readCache(filename, mesh, unitCell, 
+                                      "I_a_-3_d"));
+      TEST_ASSERT(rejected.nStar() == 0);
+      rejected.makeBasis(mesh, unitCell, group);
+      TEST_ASSERT(rejected.nStar() == basis.nStar());
+   }
+
 };
 
 TEST_BEGIN(BasisTest)
@@ -363,6 +444,7 @@ TEST_ADD(BasisTest, testMake2DBasis_hex)
 TEST_ADD(BasisTest, testMake3DBasis_I)
 TEST_ADD(BasisTest, testMake3DBasis_I_m_3b_m)
 TEST_ADD(BasisTest, testMake3DBasis_I_a_3b_d) 
+TEST_ADD(BasisTest, testCache3D_I_a_3b_d)
 TEST_END(BasisTest)
 
 #endif
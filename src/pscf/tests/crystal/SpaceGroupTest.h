@@ -228,6 +228,90 @@ public:
       //std::cout << g << std::endl;
    }
 
+   void testReflections() 
+   {
+      printMethod(TEST_FUNC);
+
+      std::ifstream in;
+
+      // Hexagonal group: Inversion, but no reflection x[0] -> -x[0]
+      SpaceGroup<2> g2;
+      openInputFile("in/p_6_m_m", in);
+      in >> g2;
+      in.close();
+      TEST_ASSERT(g2.hasInversionCenter());
+      TEST_ASSERT(!g2.hasAxisReflections());
+
+      // Identity group
+      SpaceGroup<2> e2;
+      e2.makeCompleteGroup();
+      TEST_ASSERT(!e2.hasInversionCenter());
+      TEST_ASSERT(!e2.hasAxisReflections());
+
+      // BCC group: Mirror planes through origin
+      SpaceGroup<3> g3;
+      openInputFile("in/I_m_-3_m", in);
+      in >> g3;
+      in.close();
+      TEST_ASSERT(g3.hasInversionCenter());
+      TEST_ASSERT(g3.hasAxisReflections());
+
+      // Gyroid group: Inversion center, but no mirror planes
+      SpaceGroup<3> h3;
+      openInputFile("in/I_a_-3_d", in);
+      in >> h3;
+      in.close();
+      TEST_ASSERT(h3.hasInversionCenter());
+      TEST_ASSERT(!h3.hasAxisReflections());
+   }
+
+   /*
+   * Compare all groups in compiled tables to groups in data/groups.
+   */
+   template <int D>
+   void checkTableGroups()
+   {
+      int n = nTableGroup(D);
+      TEST_ASSERT(n > 0);
+      std::ifstream in;
+      for (int i = 0; i < n; ++i) {
+         std::string name = tableGroup(D, i).name;
+         TEST_ASSERT(findTableGroup(D, name) == i);
+
+         SpaceGroup<D> table;
+         TEST_ASSERT(makeTableGroup(name, table));
+         TEST_ASSERT(table.isValid());
+
+         SpaceGroup<D> file;
+         in.open(makeGroupFileName(D, name).c_str());
+         TEST_ASSERT(in.is_open());
+         in >> file;
+         in.close();
+
+         TEST_ASSERT(table.size() == file.size());
+         for (int j = 0; j < file.size(); ++j) {
+            TEST_ASSERT(table[j] == file[j]);
+         }
+      }
+      SpaceGroup<D> g;
+      TEST_ASSERT(findTableGroup(D, "not_a_group") == -1);
+      TEST_ASSERT(!makeTableGroup("not_a_group", g));
+   }
+
+   void testGroupTables() 
+   {
+      printMethod(TEST_FUNC);
+      checkTableGroups<1>();
+      checkTableGroups<2>();
+      checkTableGroups<3>();
+
+      // Lookup by readGroup
+      SpaceGroup<3> g;
+      readGroup("I_a_-3_d", g);
+      TEST_ASSERT(g.size() == 96);
+      TEST_ASSERT(g.isValid());
+   }
+
 };
 
 TEST_BEGIN(SpaceGroupTest)
@@ -237,6 +321,8 @@ TEST_ADD(SpaceGroupTest, test2Dmake2)
 TEST_ADD(SpaceGroupTest, test2Dmake3)
 TEST_ADD(SpaceGroupTest, test3Dmake)
 TEST_ADD(SpaceGroupTest, test2Dread)
+TEST_ADD(SpaceGroupTest, testReflections)
+TEST_ADD(SpaceGroupTest, testGroupTables)
 TEST_END(SpaceGroupTest)
 
 #endif
@@ -0,0 +1,80 @@
+#ifndef PSCF_CONTINUATION_TEST_H
+#define PSCF_CONTINUATION_TEST_H
+
+#include <test/UnitTest.h>
+#include <test/UnitTestRunner.h>
+
+#include <pscf/math/continuation.h>
+#include <util/containers/DArray.h>
+
+using namespace Util;
+using namespace Pscf;
+
+class ContinuationTest : public UnitTest 
+{
+
+public:
+
+   void setUp()
+   {}
+
+   void tearDown()
+   {}
+
+   void testLagrangeCoefficients()
+   {
+      printMethod(TEST_FUNC);
+
+      // Extrapolation from n points is exact for polynomials of
+      // degree n-1, and is a simple copy for n = 1
+      DArray<double> x, c;
+      x.allocate(3);
+      c.allocate(3);
+      x[0] = 0.5;
+      x[1] = 0.3;
+      x[2] = 0.2;
+      double xNew = 0.6;
+
+      lagrangeCoefficients(x, 1, xNew, c);
+      TEST_ASSERT(eq(c[0], 1.0));
+
+      lagrangeCoefficients(x, 2, xNew, c);
+      double y = 0.0;
+      for (int k = 0; k < 2; ++k) {
+         y += c[k]*(2.0 - 3.0*x[k]);
+      }
+      TEST_ASSERT(eq(y, 2.0 - 3.0*xNew));
+
+      lagrangeCoefficients(x, 3, xNew, c);
+      y = 0.0;
+      for (int k = 0; k < 3; ++k) {
+         y += c[k]*(2.0 - 3.0*x[k] + x[k]*x[k]);
+      }
+      TEST_ASSERT(eq(y, 2.0 - 3.0*xNew + xNew*xNew));
+   }
+
+   void testAdjustStepSize()
+   {
+      printMethod(TEST_FUNC);
+
+      // Proportional to nItrTarget/nItr
+      TEST_ASSERT(eq(adjustStepSize(0.1, 10, 8, 0.01, 1.0), 0.08));
+
+      // Factor is limited to [0.5, 2]
+      TEST_ASSERT(eq(adjustStepSize(0.1, 1, 8, 0.01, 1.0), 0.2));
+      TEST_ASSERT(eq(adjustStepSize(0.1, 0, 8, 0.01, 1.0), 0.2));
+      TEST_ASSERT(eq(adjustStepSize(0.1, 40, 8, 0.01, 1.0), 0.05));
+
+      // Result is limited to [dsMin, dsMax]
+      TEST_ASSERT(eq(adjustStepSize(0.1, 1, 8, 0.01, 0.15), 0.15));
+      TEST_ASSERT(eq(adjustStepSize(0.1, 40, 8, 0.07, 1.0), 0.07));
+   }
+
+};
+
+TEST_BEGIN(ContinuationTest)
+TEST_ADD(ContinuationTest, testLagrangeCoefficients)
+TEST_ADD(ContinuationTest, testAdjustStepSize)
+TEST_END(ContinuationTest)
+
+#endif
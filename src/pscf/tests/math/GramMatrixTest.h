@@ -0,0 +1,142 @@
+#ifndef PSCF_GRAM_MATRIX_TEST_H
+#define PSCF_GRAM_MATRIX_TEST_H
+
+#include <test/UnitTest.h>
+#include <test/UnitTestRunner.h>
+
+#include <pscf/math/GramMatrix.h>
+#include <util/containers/DMatrix.h>
+#include <util/containers/DArray.h>
+
+#include <cmath>
+
+using namespace Util;
+using namespace Pscf;
+
+class GramMatrixTest : public UnitTest 
+{
+
+public:
+
+   void setUp()
+   {}
+
+   void tearDown()
+   {}
+
+   // Vector number t in a sequence of test vectors of dimension 3
+   void makeVector(int t, double* v)
+   {
+      v[0] = cos(0.7*t) + 0.1*t;
+      v[1] = sin(1.3*t);
+      v[2] = 1.0/double(t + 1);
+   }
+
+   void testAllocate()
+   {
+      printMethod(TEST_FUNC);
+      GramMatrix g;
+      g.allocate(4);
+      TEST_ASSERT(g.capacity() == 4);
+      TEST_ASSERT(g.size() == 0);
+   }
+
+   void testAdvance()
+   {
+      printMethod(TEST_FUNC);
+
+      int capacity = 4;
+      GramMatrix g;
+      g.allocate(capacity);
+
+      // Add vectors one at a time, computing one new row per step
+      DMatrix<double> v;
+      int nVector = 10;
+      v.allocate(nVector, 3);
+      int t, i, j, k;
+      for (t = 0; t < nVector; ++t) {
+         makeVector(t, &v(t,0));
+         g.advance();
+         TEST_ASSERT(g.size() == (t < capacity ? t + 1 : capacity));
+         for (k = 0; k < g.size(); ++k) {
+            g.set(k, v(t,0)*v(t-k,0) + v(t,1)*v(t-k,1) + v(t,2)*v(t-k,2));
+         }
+
+         // Compare all elements to direct evaluation
+         double dot;
+         for (i = 0; i < g.size(); ++i) {
+            for (j = 0; j < g.size(); ++j) {
+               dot = v(t-i,0)*v(t-j,0) + v(t-i,1)*v(t-j,1) 
+                   + v(t-i,2)*v(t-j,2);
+               TEST_ASSERT(eq(g(i,j), dot));
+            }
+         }
+
+         // Anderson mixing matrix and vector
+         double d0, d1, u, w;
+         for (i = 0; i < g.size() - 1; ++i) {
+            for (j = 0; j < g.size() - 1; ++j) {
+               u = 0.0;
+               for (k = 0; k < 3; ++k) {
+                  d0 = v(t,k) - v(t-i-1,k);
+                  d1 = v(t,k) - v(t-j-1,k);
+                  u += d0*d1;
+               }
+               TEST_ASSERT(eq(g.umn(i,j), u));
+            }
+            w = 0.0;
+            for (k = 0; k < 3; ++k) {
+               w += (v(t,k) - v(t-i-1,k))*v(t,k);
+            }
+            TEST_ASSERT(eq(g.vm(i), w));
+         }
+      }
+
+      g.clear();
+      TEST_ASSERT(g.size() == 0);
+   }
+
+   void testComputeCoefficients()
+   {
+      printMethod(TEST_FUNC);
+
+      int capacity = 3;
+      GramMatrix g;
+      g.allocate(capacity);
+      DArray<double> c;
+      c.allocate(capacity - 1);
+
+      DMatrix<double> v;
+      int nVector = 6;
+      v.allocate(nVector, 3);
+      int t, k, m, n;
+      double sum;
+      for (t = 0; t < nVector; ++t) {
+         makeVector(t, &v(t,0));
+         g.advance();
+         for (k = 0; k < g.size(); ++k) {
+            g.set(k, v(t,0)*v(t-k,0) + v(t,1)*v(t-k,1) + v(t,2)*v(t-k,2));
+         }
+         if (g.size() < 2) continue;
+
+         // Check that coefficients solve U C = V
+         g.computeCoefficients(c);
+         for (m = 0; m < g.size() - 1; ++m) {
+            sum = 0.0;
+            for (n = 0; n < g.size() - 1; ++n) {
+               sum += g.umn(m,n)*c[n];
+            }
+            TEST_ASSERT(eq(sum, g.vm(m)));
+         }
+      }
+   }
+
+};
+
+TEST_BEGIN(GramMatrixTest)
+TEST_ADD(GramMatrixTest, testAllocate)
+TEST_ADD(GramMatrixTest, testAdvance)
+TEST_ADD(GramMatrixTest, testComputeCoefficients)
+TEST_END(GramMatrixTest)
+
+#endif
@@ -6,6 +6,7 @@
 
 #include <pscf/math/LuSolver.h>
 #include <util/containers/DMatrix.h>
+#include <util/containers/DArray.h>
 
 #include <fstream>
 
@@ -95,12 +96,61 @@ public:
       TEST_ASSERT(eq(b[1], y[1]));
       TEST_ASSERT(eq(b[2], y[2]));
    }
+
+   void testSolveBlock()
+   {
+      printMethod(TEST_FUNC);
+
+      // Leading 3 x 3 block of a 4 x 4 matrix
+      DMatrix<double> a;
+      a.allocate(4,4);
+      int i, j;
+      for (i = 0; i < 4; ++i) {
+         for (j = 0; j < 4; ++j) {
+            a(i,j) = 7.0;
+         }
+      }
+      a(0,0) = 1.0;
+      a(1,1) = 3.0;
+      a(2,2) = 4.0;
+      a(0,1) = 2.0;
+      a(1,0) = 2.0;
+      a(1,2) = 5.0;
+      a(2,1) = 5.0;
+      a(0,2) = 0.0;
+      a(2,0) = 0.0;
+
+      DArray<double> b, x;
+      b.allocate(4);
+      x.allocate(4);
+      b[0] = 1.0;
+      b[1] = 2.0;
+      b[2] = 3.0;
+      b[3] = 4.0;
+
+      // Solve for the 3 x 3 and then the 2 x 2 leading block
+      LuSolver solver;
+      solver.allocate(4);
+      double y;
+      for (int n = 3; n > 1; --n) {
+         solver.computeLU(a, n);
+         solver.solve(b, x);
+         for (i = 0; i < n; ++i) {
+            y = 0.0;
+            for (j = 0; j < n; ++j) {
+               y += a(i,j)*x[j];
+            }
+            TEST_ASSERT(eq(b[i], y));
+         }
+      }
+   }
 };
 
 TEST_BEGIN(LuSolverTest)
 TEST_ADD(LuSolverTest, testConstructor)
 TEST_ADD(LuSolverTest, testDecompose)
 TEST_ADD(LuSolverTest, testSolve)
+TEST_ADD(LuSolverTest, testSolveBlock)
 TEST_END(LuSolverTest)
 
 #endif
@@ -7,12 +7,16 @@
 #include "RealVecTest.h"
 #include "TridiagonalSolverTest.h"
 #include "LuSolverTest.h"
+#include "GramMatrixTest.h"
+#include "ContinuationTest.h"
 
 TEST_COMPOSITE_BEGIN(MathTestComposite)
 TEST_COMPOSITE_ADD_UNIT(IntVecTest);
 TEST_COMPOSITE_ADD_UNIT(RealVecTest);
 TEST_COMPOSITE_ADD_UNIT(TridiagonalSolverTest);
 TEST_COMPOSITE_ADD_UNIT(LuSolverTest);
+TEST_COMPOSITE_ADD_UNIT(GramMatrixTest);
+TEST_COMPOSITE_ADD_UNIT(ContinuationTest);
 TEST_COMPOSITE_END
 
 #endif
@@ -226,6 +226,58 @@ public:
       TEST_ASSERT(eq(b[1], y[1]));
       TEST_ASSERT(eq(b[2], y[2]));
    }
+   void testSolveBatch()
+   {
+      printMethod(TEST_FUNC);
+      int n = 5;
+      int nBatch = 3;
+      TridiagonalSolver solver;
+      solver.allocate(n);
+
+      DArray<double> d, u, l;
+      d.allocate(n);
+      u.allocate(n-1);
+      l.allocate(n-1);
+      for (int i = 0; i < n; ++i) {
+         d[i] = 4.0 + 0.5*i;
+      }
+      for (int i = 0; i < n - 1; ++i) {
+         u[i] = 1.0 - 0.2*i;
+         l[i] = -1.0 + 0.3*i;
+      }
+      solver.computeLU(d, u, l);
+
+      // Interleaved right hand sides
+      DArray<double> b, x, b1, x1;
+      b.allocate(n*nBatch);
+      x.allocate(n*nBatch);
+      b1.allocate(n);
+      x1.allocate(n);
+      for (int i = 0; i < n; ++i) {
+         for (int k = 0; k < nBatch; ++k) {
+            b[i*nBatch + k] = 1.0 + i - 2.0*k + 0.1*i*k;
+         }
+      }
+      solver.solve(b, x, nBatch);
+
+      // Compare to separate solutions
+      for (int k = 0; k < nBatch; ++k) {
+         for (int i = 0; i < n; ++i) {
+            b1[i] = b[i*nBatch + k];
+         }
+         solver.solve(b1, x1);
+         for (int i = 0; i < n; ++i) {
+            TEST_ASSERT(x1[i] == x[i*nBatch + k]);
+         }
+      }
+
+      // In place solution
+      solver.solve(b, b, nBatch);
+      for (int i = 0; i < n*nBatch; ++i) {
+         TEST_ASSERT(b[i] == x[i]);
+      }
+   }
+
    #if 0
    #endif
 
@@ -239,6 +291,7 @@ TEST_ADD(TridiagonalSolverTest, testSymmetricSolve)
 TEST_ADD(TridiagonalSolverTest, testDecompose)
 TEST_ADD(TridiagonalSolverTest, testMultiply)
 TEST_ADD(TridiagonalSolverTest, testSolve)
+TEST_ADD(TridiagonalSolverTest, testSolveBatch)
 TEST_END(TridiagonalSolverTest)
 
 #endif
@@ -30,8 +30,8 @@ namespace Pscf {
 namespace Pspc
 {
    template <int D> class AmIterator;
-   class Sweep;
-   class SweepFactory;
+   template <int D> class Sweep;
+   template <int D> class SweepFactory;
 
    using namespace Util;
 
@@ -74,6 +74,9 @@ namespace Pspc
 
       /**
       * Process command line options.
+      *
+      * Option -t nThread sets the number of threads used by FFTs and
+      * threaded loops, and overrides any value in the parameter file.
       */
       void setOptions(int argc, char **argv);
 
@@ -296,6 +299,11 @@ namespace Pspc
       */  
       std::string groupName() const;
 
+      /** 
+      * Get number of threads used by FFTs and threaded loops.
+      */  
+      int nThread() const;
+
       /** 
       * Have monomer chemical potential fields (w fields) been set?
       *
@@ -381,17 +389,15 @@ namespace Pspc
       */
       AmIterator<D>* iteratorPtr_;
 
-      #if 0
       /**
       * Pointer to an Sweep object
       */
-      Sweep* sweepPtr_;
+      Sweep<D>* sweepPtr_;
 
       /**
       * Pointer to SweepFactory object
       */
-      SweepFactory* sweepFactoryPtr_;
-      #endif
+      SweepFactory<D>* sweepFactoryPtr_;
 
       /**
       * Array of chemical potential fields for monomer types.
@@ -453,6 +459,26 @@ namespace Pspc
       */
       double pressure_;
 
+      /**
+      * Number of threads used by FFTs and threaded loops.
+      */
+      int nThread_;
+
+      /**
+      * Was the number of threads set by a command line option?
+      */
+      bool hasNThreadOption_;
+
+      /**
+      * Base name of FFTW wisdom file (empty if none).
+      */
+      std::string wisdomFileName_;
+
+      /**
+      * Base name of basis cache file (empty if none).
+      */
+      std::string basisCacheFileName_;
+
       /**
       * Has the mixture been initialized?
       */
@@ -487,12 +513,10 @@ namespace Pspc
       */
       bool hasCFields_;
 
-      #if 0
       /**
       * Does this system have a Sweep object?
       */
       bool hasSweep_;
-      #endif
 
       // Private member functions
 
@@ -501,6 +525,30 @@ namespace Pspc
       */
       void allocate();
 
+      /**
+      * Set the number of threads used by FFTs and threaded loops.
+      *
+      * \param nThread number of threads (nThread > 0)
+      */
+      void setNThread(int nThread);
+
+      /**
+      * Get name of FFTW wisdom file for the current mesh.
+      *
+      * Returns wisdomFileName_ with a suffix appended that contains the 
+      * mesh dimensions, e.g., "wisdom_32x32x32" for base name "wisdom".
+      */
+      std::string wisdomFile() const;
+
+      /**
+      * Get name of basis cache file for the current group and mesh.
+      *
+      * Returns basisCacheFileName_ with a suffix appended that contains 
+      * the group name (without any directory path) and mesh dimensions, 
+      * e.g., "basis_I_a_-3_d_32x32x32" for base name "basis".
+      */
+      std::string basisCacheFile() const;
+
       /**
       * Initialize Homogeneous::Mixture object.
       */
@@ -549,6 +597,11 @@ namespace Pspc
    inline std::string System<D>::groupName() const
    { return groupName_; }
 
+   // Get the number of threads.
+   template <int D>
+   inline int System<D>::nThread() const
+   { return nThread_; }
+
    // Get the Basis<D> object.
    template <int D>
    inline Basis<D>& System<D>::basis()
@@ -10,14 +10,13 @@
 
 #include "System.h"
 
-#if 0
 #include <pspc/sweep/Sweep.h>
 #include <pspc/sweep/SweepFactory.h>
-#endif
-
 #include <pspc/iterator/AmIterator.h>
+#include <pspc/field/FCT.h>
 
 #include <pscf/mesh/MeshIterator.h>
+#include <pscf/crystal/SpaceGroup.h>
 #include <pscf/crystal/shiftToMinimum.h>
 #include <pscf/inter/Interaction.h>
 #include <pscf/inter/ChiInteraction.h>
@@ -27,12 +26,17 @@
 #include <util/format/Int.h>
 #include <util/format/Dbl.h>
 
+#include <cstdlib>
 #include <ctime>
 #include <iomanip>
 #include <sstream>
 #include <string>
 #include <unistd.h>
 
+#ifdef PSCF_OPENMP
+#include <omp.h>
+#endif
+
 namespace Pscf {
 namespace Pspc
 {
@@ -55,20 +59,24 @@ namespace Pspc
       homogeneous_(),
       interactionPtr_(0),
       iteratorPtr_(0),
-      // sweepPtr_(0),
-      // sweepFactoryPtr_(0),
+      sweepPtr_(0),
+      sweepFactoryPtr_(0),
       wFields_(),
       cFields_(),
       f_(),
       c_(),
       fHelmholtz_(0.0),
       pressure_(0.0),
+      nThread_(1),
+      hasNThreadOption_(false),
+      wisdomFileName_(),
+      basisCacheFileName_(),
       hasMixture_(false),
       hasUnitCell_(false),
       isAllocated_(false),
       hasWFields_(false),
-      hasCFields_(false)
-      //hasSweep_(false)
+      hasCFields_(false),
+      hasSweep_(false)
    {  
       setClassName("System"); 
 
@@ -78,7 +86,7 @@ namespace Pspc
       interactionPtr_ = new ChiInteraction(); 
       iteratorPtr_ = new AmIterator<D>(this); 
 
-      // sweepFactoryPtr_ = new SweepFactory(*this);
+      sweepFactoryPtr_ = new SweepFactory<D>(*this);
    }
 
    /*
@@ -93,6 +101,12 @@ namespace Pspc
       if (iteratorPtr_) {
          delete iteratorPtr_;
       }
+      if (sweepPtr_) {
+         delete sweepPtr_;
+      }
+      if (sweepFactoryPtr_) {
+         delete sweepFactoryPtr_;
+      }
    }
 
    /*
@@ -106,15 +120,17 @@ namespace Pspc
       bool cFlag = false;  // command file 
       bool iFlag = false;  // input prefix
       bool oFlag = false;  // output prefix
+      bool tFlag = false;  // number of threads
       char* pArg = 0;
       char* cArg = 0;
       char* iArg = 0;
       char* oArg = 0;
+      char* tArg = 0;
    
       // Read program arguments
       int c;
       opterr = 0;
-      while ((c = getopt(argc, argv, "er:p:c:i:o:f")) != -1) {
+      while ((c = getopt(argc, argv, "er:p:c:i:o:t:f")) != -1) {
          switch (c) {
          case 'e':
             eflag = true;
@@ -135,6 +151,10 @@ namespace Pspc
             iFlag = true;
             oArg  = optarg;
             break;
+         case 't': // number of threads
+            tFlag = true;
+            tArg  = optarg;
+            break;
          case '?':
            Log::file() << "Unknown option -" << optopt << std::endl;
            UTIL_THROW("Invalid command line option");
@@ -166,6 +186,12 @@ namespace Pspc
          fileMaster().setOutputPrefix(std::string(oArg));
       }
 
+      // If option -t, set number of threads (overrides parameter file)
+      if (tFlag) {
+         setNThread(atoi(tArg));
+         hasNThreadOption_ = true;
+      }
+
    }
 
    /*
@@ -198,19 +224,87 @@ namespace Pspc
 
       read(in, "groupName", groupName_);
 
+      // Optionally read number of threads, unless set on command line
+      int nThread = nThread_;
+      readOptional(in, "nThread", nThread);
+      if (!hasNThreadOption_) {
+         setNThread(nThread);
+      }
+
+      // Optionally read FFTW planning rigor and wisdom file base name
+      std::string fftRigor = "estimate";
+      readOptional(in, "fftRigor", fftRigor);
+      FFT<D>::setPlanRigor(fftRigor);
+      readOptional(in, "wisdomFile", wisdomFileName_);
+
+      // Use cosine transforms in the MDE solver if fields are even in
+      // each coordinate, unless disabled by optional parameter.
+      SpaceGroup<D> group;
+      readGroup(groupName_, group);
+      bool cosine = true;
+      readOptional(in, "cosineTransforms", cosine);
+      cosine = cosine && group.hasAxisReflections() 
+                      && FCT<D>::isValidMesh(mesh().dimensions());
+
+      // Optionally read base name of basis cache file
+      readOptional(in, "basisCache", basisCacheFileName_);
+
+      // Read iterator parameters (iterator is allocated below)
+      readParamComposite(in, iterator());
+
+      // Cosine transforms impose mirror symmetry on every propagator,
+      // and so may only be used if the iterator keeps w fields symmetric.
+      if (cosine && !iterator().isSymmetric()) {
+         cosine = false;
+         Log::file() << "Cosine transforms disabled: "
+                     << "w fields are not symmetrized" << std::endl;
+      }
+      mixture().setCosineTransforms(cosine);
+      if (cosine) {
+         Log::file() << "Using cosine transforms in MDE solver" 
+                     << std::endl;
+      }
+
+      // Import FFTW wisdom for this mesh, if any, before making plans
+      if (!wisdomFileName_.empty()) {
+         if (FFT<D>::readWisdom(wisdomFile())) {
+            Log::file() << "Read FFTW wisdom file " << wisdomFile() 
+                        << std::endl;
+         }
+      }
+
       mixture().setMesh(mesh());
+      if (mixture().checkpointInterval() > 1 
+          || mixture().isSinglePrecision()) {
+         mixture().writeStorageReport(Log::file());
+      }
       mixture().setupUnitCell(unitCell());
-      basis().makeBasis(mesh(), unitCell(), groupName_);
+
+      // Read basis from cache file if valid, else construct and cache it
+      bool hasBasis = false;
+      if (!basisCacheFileName_.empty()) {
+         hasBasis = basis().readCache(basisCacheFile(), mesh(), 
+                                      unitCell(), groupName_);
+         if (hasBasis) {
+            Log::file() << "Read basis cache file " << basisCacheFile()
+                        << std::endl;
+         }
+      }
+      if (!hasBasis) {
+         basis().makeBasis(mesh(), unitCell(), group);
+         if (!basisCacheFileName_.empty()) {
+            basis().writeCache(basisCacheFile(), groupName_);
+            Log::file() << "Wrote basis cache file " << basisCacheFile()
+                        << std::endl;
+         }
+      }
 
       allocate();
       isAllocated_ = true;
-
-      // Initialize iterator
-      readParamComposite(in, iterator());
       iterator().allocate();
 
-      #if 0
       // Optionally instantiate a Sweep object
+      hasSweep_ = false;
       readOptional<bool>(in, "hasSweep", hasSweep_);
       if (hasSweep_) {
          std::string className;
@@ -220,9 +314,7 @@ namespace Pspc
          if (!sweepPtr_) {
             UTIL_THROW("Unrecognized Sweep subclass name");
          }
-         sweepPtr_->setSystem(*this);
       }
-      #endif
    }
 
    /*
@@ -243,6 +335,59 @@ namespace Pspc
    void System<D>::readParam()
    {  readParam(fileMaster().paramFile()); }
 
+   /*
+   * Set the number of threads used by FFTs and threaded loops.
+   */
+   template <int D>
+   void System<D>::setNThread(int nThread)
+   {
+      UTIL_CHECK(nThread > 0);
+      #ifndef PSCF_OPENMP
+      if (nThread > 1) {
+         UTIL_THROW("nThread > 1 requires compilation with PSCF_OPENMP");
+      }
+      #else
+      omp_set_num_threads(nThread);
+      #endif
+      FFT<D>::setNThread(nThread);
+      nThread_ = nThread;
+   }
+
+   /*
+   * Get name of FFTW wisdom file, with suffix for the mesh dimensions.
+   */
+   template <int D>
+   std::string System<D>::wisdomFile() const
+   {
+      std::stringstream name;
+      name << wisdomFileName_ << "_";
+      for (int i = 0; i < D; ++i) {
+         if (i > 0) name << "x";
+         name << mesh_.dimension(i);
+      }
+      return name.str();
+   }
+
+   /*
+   * Get name of basis cache file for the current group and mesh.
+   */
+   template <int D>
+   std::string System<D>::basisCacheFile() const
+   {
+      std::string group = groupName_;
+      std::string::size_type pos = group.find_last_of('/');
+      if (pos != std::string::npos) {
+         group = group.substr(pos + 1);
+      }
+      std::stringstream name;
+      name << basisCacheFileName_ << "_" << group << "_";
+      for (int i = 0; i < D; ++i) {
+         if (i > 0) name << "x";
+         name << mesh_.dimension(i);
+      }
+      return name.str();
+   }
+
    /*
    * Read parameters and initialize.
    */
@@ -296,6 +441,10 @@ namespace Pspc
          if (command == "FINISH") {
             Log::file() << std::endl;
             readNext = false;
+            // Save FFTW wisdom accumulated during this run
+            if (!wisdomFileName_.empty()) {
+               FFT<D>::writeWisdom(wisdomFile());
+            }
          } else
          if (command == "READ_W_BASIS") {
             in >> filename;
@@ -338,6 +487,24 @@ namespace Pspc
                outputThermo(Log::file());
             }
 
+         } else
+         if (command == "SWEEP") {
+            UTIL_CHECK(hasSweep_);
+            UTIL_CHECK(sweepPtr_);
+
+            // Read w (chemical potential fields) if not done previously 
+            if (!hasWFields_) {
+               in >> filename;
+               Log::file() << " " << Str(filename, 20) <<std::endl;
+               fieldIo().readFieldsBasis(filename, wFields());
+               fieldIo().convertBasisToRGrid(wFields(), wFieldsRGrid());
+               hasWFields_ = true;
+            }
+
+            // Solve SCF equations along the path of the sweep
+            sweepPtr_->solve();
+            hasCFields_ = true;
+
          } else
          if (command == "SOLVE_MDE") {
             Log::file() << std::endl;
@@ -578,20 +745,49 @@ namespace Pspc
       }
 
       int nm  = mixture().nMonomer();
-      int nStar = basis().nStar();
       double temp = 0;
 
-      for (int i = 0; i < nm; ++i) {
+      if (iterator().isSymmetric()) {
+
+         // Use orthonormality of basis functions
+         int nStar = basis().nStar();
+         for (int i = 0; i < nm; ++i) {
          
-         for (int j = i + 1; j < nm; ++j) {
-            for (int k = 0; k < nStar; ++k) {
-               fHelmholtz_+=
-                  cFields_[i][k] * interaction().chi(i,j) * cFields_[j][k];
+            for (int j = i + 1; j < nm; ++j) {
+               for (int k = 0; k < nStar; ++k) {
+                  fHelmholtz_+=
+                     cFields_[i][k] * interaction().chi(i,j) * cFields_[j][k];
+               }
+            }
+
+            for (int j = 0; j < nStar; ++j) {
+               temp += wFields_[i][j] * cFields_[i][j];
             }
+
          }
 
-         for (int j = 0; j < nStar; ++j) {
-            temp += wFields_[i][j] * cFields_[i][j];
+      } else {
+
+         // Use spatial averages on the grid, since fields may have 
+         // lower symmetry than the space group
+         int nx = mesh().size();
+         double sum;
+         for (int i = 0; i < nm; ++i) {
+         
+            for (int j = i + 1; j < nm; ++j) {
+               sum = 0.0;
+               for (int k = 0; k < nx; ++k) {
+                  sum += cFieldsRGrid_[i][k] * cFieldsRGrid_[j][k];
+               }
+               fHelmholtz_ += interaction().chi(i,j) * sum / double(nx);
+            }
+
+            sum = 0.0;
+            for (int k = 0; k < nx; ++k) {
+               sum += wFieldsRGrid_[i][k] * cFieldsRGrid_[i][k];
+            }
+            temp += sum / double(nx);
+
          }
 
       }
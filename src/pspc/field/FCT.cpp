@@ -0,0 +1,22 @@
+/*
+* PSCF++ Package 
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "FCT.tpp"
+
+namespace Pscf {
+namespace Pspc {
+
+   using namespace Util;
+
+   // Explicit class instantiations
+
+   template class FCT<1>;
+   template class FCT<2>;
+   template class FCT<3>;
+
+}
+}
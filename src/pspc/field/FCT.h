@@ -0,0 +1,216 @@
+#ifndef PSPC_FCT_H
+#define PSPC_FCT_H
+
+/*
+* PSCF++ Package
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include <pspc/field/Field.h>
+#include <pscf/math/IntVec.h>
+#include <util/global.h>
+
+#include <fftw3.h>
+
+namespace Pscf {
+namespace Pspc {
+
+   using namespace Util;
+   using namespace Pscf;
+
+   /**
+   * Fast cosine transform for batches of fields with reflection symmetry.
+   *
+   * A field f(r) on a periodic mesh with an even number N[i] of grid 
+   * points in each direction i is even in each coordinate separately if 
+   * it is invariant under each of the reflections x[i] -> -x[i]. Such a
+   * field is completely specified by its values at grid points with
+   * 0 <= x[i] <= N[i]/2, which form the "even" mesh, with dimensions
+   * N[i]/2 + 1. Its discrete Fourier transform is real and has the same
+   * symmetry, and values at wavevectors with 0 <= G[i] <= N[i]/2 are 
+   * given by a D-dimensional type-I discrete cosine transform (FFTW 
+   * REDFT00) of the values on the even mesh.
+   *
+   * An FCT<D> computes these transforms for a contiguous batch of fields
+   * with a single FFTW r2r plan. Conventions for normalization are the 
+   * same as for FFT<D>: The forward transform is divided by the number 
+   * of points in the full mesh, and the inverse is not, so that the
+   * inverse of the forward transform is the identity. The forward and
+   * inverse transforms are otherwise identical. Plans are created using
+   * the number of threads and planning rigor currently set for FFT<D>.
+   *
+   * \ingroup Pspc_Field_Module
+   */
+   template <int D>
+   class FCT
+   {
+
+   public:
+
+      /**
+      * Default constructor.
+      */
+      FCT();
+
+      /**
+      * Destructor.
+      */
+      virtual ~FCT();
+
+      /**
+      * Setup grid dimensions, batch size, plan and work space.
+      *
+      * May be called again with different parameters, in which case
+      * the existing plan is destroyed and a new plan is created.
+      *
+      * \param meshDimensions number of points in each direction of the
+      *                       full periodic mesh (all must be even)
+      * \param batchSize number of fields in each batch
+      */
+      void setup(IntVec<D> const & meshDimensions, int batchSize);
+
+      /**
+      * Compute forward transforms of a contiguous batch of fields.
+      *
+      * \param in  values for batchSize fields on the even r-space mesh
+      * \param out  values for batchSize fields on the even k-space mesh
+      */
+      void forwardTransform(Field<double>& in, Field<double>& out);
+
+      /**
+      * Compute unnormalized forward transforms of a contiguous batch.
+      *
+      * The output is equal to that of forwardTransform multiplied by 
+      * the number of points in the full mesh. The input array is not 
+      * modified or copied.
+      *
+      * \param in  values for batchSize fields on the even r-space mesh
+      * \param out  values for batchSize fields on the even k-space mesh
+      */
+      void forwardTransformUnscaled(Field<double>& in, Field<double>& out);
+
+      /**
+      * Compute inverse transforms of a contiguous batch of fields.
+      *
+      * \param in  values for batchSize fields on the even k-space mesh
+      * \param out  values for batchSize fields on the even r-space mesh
+      */
+      void inverseTransform(Field<double>& in, Field<double>& out);
+
+      /**
+      * Return the dimensions of the full mesh.
+      */
+      const IntVec<D>& meshDimensions() const;
+
+      /**
+      * Return the dimensions of the even mesh, N[i]/2 + 1.
+      */
+      const IntVec<D>& evenDimensions() const;
+
+      /**
+      * Return the number of points in the even mesh of one field.
+      */
+      int evenSize() const;
+
+      /**
+      * Return the number of fields in each batch.
+      */
+      int batchSize() const;
+
+      /**
+      * Have the grid dimensions and plan been initialized?
+      */
+      bool isSetup() const;
+
+      /**
+      * Can cosine transforms be used for a mesh with these dimensions?
+      *
+      * Returns true iff the number of points in each direction is even.
+      *
+      * \param meshDimensions number of points in each direction
+      */
+      static bool isValidMesh(IntVec<D> const & meshDimensions);
+
+   private:
+
+      // Contiguous work array for input data.
+      Field<double> inWork_;
+
+      // Contiguous work array for output data.
+      Field<double> outWork_;
+
+      // Number of grid points in each direction of the full mesh.
+      IntVec<D> meshDimensions_;
+
+      // Number of grid points in each direction of the even mesh.
+      IntVec<D> evenDimensions_;
+
+      // Number of points in the full mesh
+      int rSize_;
+
+      // Number of points in the even mesh
+      int evenSize_;
+
+      // Number of fields in each batch
+      int batchSize_;
+
+      // Pointer to a plan for a batch of transforms.
+      fftw_plan plan_;
+
+      // Have array dimensions and plan been initialized?
+      bool isSetup_;
+
+      /**
+      * Destroy existing plan, if any.
+      */
+      void destroyPlan();
+
+   };
+
+   /*
+   * Return the dimensions of the full mesh.
+   */
+   template <int D>
+   inline const IntVec<D>& FCT<D>::meshDimensions() const
+   {  return meshDimensions_; }
+
+   /*
+   * Return the dimensions of the even mesh.
+   */
+   template <int D>
+   inline const IntVec<D>& FCT<D>::evenDimensions() const
+   {  return evenDimensions_; }
+
+   /*
+   * Return the number of points in the even mesh of one field.
+   */
+   template <int D>
+   inline int FCT<D>::evenSize() const
+   {  return evenSize_; }
+
+   /*
+   * Return the number of fields in each batch.
+   */
+   template <int D>
+   inline int FCT<D>::batchSize() const
+   {  return batchSize_; }
+
+   /*
+   * Have the grid dimensions and plan been initialized?
+   */
+   template <int D>
+   inline bool FCT<D>::isSetup() const
+   {  return isSetup_; }
+
+   #ifndef PSPC_FCT_TPP
+   // Suppress implicit instantiation
+   extern template class FCT<1>;
+   extern template class FCT<2>;
+   extern template class FCT<3>;
+   #endif
+
+} // namespace Pscf::Pspc
+} // namespace Pscf
+#endif
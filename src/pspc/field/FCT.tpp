@@ -0,0 +1,177 @@
+#ifndef PSPC_FCT_TPP
+#define PSPC_FCT_TPP
+
+/*
+* PSCF++ Package
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "FCT.h"
+#include "FFT.h"
+
+namespace Pscf {
+namespace Pspc
+{
+
+   using namespace Util;
+
+   /*
+   * Default constructor.
+   */
+   template <int D>
+   FCT<D>::FCT()
+    : inWork_(),
+      outWork_(),
+      meshDimensions_(0),
+      evenDimensions_(0),
+      rSize_(0),
+      evenSize_(0),
+      batchSize_(0),
+      plan_(0),
+      isSetup_(false)
+   {}
+
+   /*
+   * Destructor.
+   */
+   template <int D>
+   FCT<D>::~FCT()
+   {  destroyPlan(); }
+
+   /*
+   * Setup mesh dimensions, batch size, work arrays and plan.
+   */
+   template <int D>
+   void FCT<D>::setup(IntVec<D> const & meshDimensions, int batchSize)
+   {
+      UTIL_CHECK(batchSize > 0);
+      UTIL_CHECK(isValidMesh(meshDimensions));
+
+      // Return if already setup with the same parameters
+      if (isSetup_) {
+         if (meshDimensions == meshDimensions_ && batchSize == batchSize_) {
+            return;
+         }
+      }
+      destroyPlan();
+
+      // Set dimensions of full and even meshes
+      int rSize = 1;
+      int evenSize = 1;
+      int n[D];
+      fftw_r2r_kind kind[D];
+      for (int i = 0; i < D; ++i) {
+         evenDimensions_[i] = meshDimensions[i]/2 + 1;
+         n[i] = evenDimensions_[i];
+         kind[i] = FFTW_REDFT00;
+         rSize *= meshDimensions[i];
+         evenSize *= evenDimensions_[i];
+      }
+      meshDimensions_ = meshDimensions;
+      rSize_ = rSize;
+      evenSize_ = evenSize;
+      batchSize_ = batchSize;
+
+      // Allocate contiguous work arrays
+      if (inWork_.isAllocated()) {
+         inWork_.deallocate();
+      }
+      if (outWork_.isAllocated()) {
+         outWork_.deallocate();
+      }
+      inWork_.allocate(evenSize_*batchSize_);
+      outWork_.allocate(evenSize_*batchSize_);
+
+      // Make plan, using work arrays, with threads and rigor of FFT<D>
+      #ifdef PSCF_OPENMP
+      fftw_plan_with_nthreads(FFT<D>::nThread());
+      #endif
+      unsigned int flags = FFT<D>::planFlags();
+      plan_ = fftw_plan_many_r2r(D, n, batchSize_,
+                                 &inWork_[0], NULL, 1, evenSize_,
+                                 &outWork_[0], NULL, 1, evenSize_,
+                                 kind, flags);
+      UTIL_CHECK(plan_);
+
+      isSetup_ = true;
+   }
+
+   /*
+   * Execute forward transforms of a contiguous batch.
+   */
+   template <int D>
+   void FCT<D>::forwardTransform(Field<double>& in, Field<double>& out)
+   {
+      UTIL_CHECK(isSetup_);
+      UTIL_CHECK(in.capacity() == evenSize_*batchSize_);
+      UTIL_CHECK(out.capacity() == evenSize_*batchSize_);
+
+      // Copy rescaled input data into work array
+      const int n = evenSize_*batchSize_;
+      const double scale = 1.0/double(rSize_);
+      for (int i = 0; i < n; ++i) {
+         inWork_[i] = in[i]*scale;
+      }
+
+      fftw_execute_r2r(plan_, &inWork_[0], &out[0]);
+   }
+
+   /*
+   * Execute unnormalized forward transforms of a contiguous batch.
+   */
+   template <int D>
+   void 
+   FCT<D>::forwardTransformUnscaled(Field<double>& in, Field<double>& out)
+   {
+      UTIL_CHECK(isSetup_);
+      UTIL_CHECK(in.capacity() == evenSize_*batchSize_);
+      UTIL_CHECK(out.capacity() == evenSize_*batchSize_);
+
+      fftw_execute_r2r(plan_, &in[0], &out[0]);
+   }
+
+   /*
+   * Execute inverse transforms of a contiguous batch.
+   */
+   template <int D>
+   void FCT<D>::inverseTransform(Field<double>& in, Field<double>& out)
+   {
+      UTIL_CHECK(isSetup_);
+      UTIL_CHECK(in.capacity() == evenSize_*batchSize_);
+      UTIL_CHECK(out.capacity() == evenSize_*batchSize_);
+
+      fftw_execute_r2r(plan_, &in[0], &out[0]);
+   }
+
+   /*
+   * Can cosine transforms be used for a mesh with these dimensions?
+   */
+   template <int D>
+   bool FCT<D>::isValidMesh(IntVec<D> const & meshDimensions)
+   {
+      for (int i = 0; i < D; ++i) {
+         if (meshDimensions[i] < 2 || meshDimensions[i]%2 != 0) {
+            return false;
+         }
+      }
+      return true;
+   }
+
+   /*
+   * Destroy existing plan, if any.
+   */
+   template <int D>
+   void FCT<D>::destroyPlan()
+   {
+      if (plan_) {
+         fftw_destroy_plan(plan_);
+         plan_ = 0;
+      }
+      isSetup_ = false;
+   }
+
+}
+}
+#endif
@@ -14,6 +14,7 @@
 #include <util/global.h>
 
 #include <fftw3.h>
+#include <string>
 
 namespace Pscf {
 namespace Pspc {
@@ -58,6 +59,19 @@ namespace Pspc {
       */
       void forwardTransform(RField<D>& in, RFieldDft<D>& out);
 
+      /**
+      * Compute forward transform without normalization.
+      *
+      * The output is equal to that of forwardTransform multiplied by 
+      * the number of grid points. The transform is computed directly 
+      * from the input array, which is not modified, without the copy 
+      * to a work array that is required by forwardTransform.
+      *
+      * \param in  array of real values on r-space grid
+      * \param out  array of complex values on k-space grid
+      */
+      void forwardTransformUnscaled(RField<D>& in, RFieldDft<D>& out);
+
       /**
       * Compute inverse (complex-to-real) Fourier transform.
       *
@@ -71,6 +85,61 @@ namespace Pspc {
       */
       const IntVec<D>& meshDimensions() const;
 
+      /**
+      * Set the number of threads used by FFTW plans.
+      *
+      * The value applies to all plans created after this call, by any
+      * FFT<D> object, and has no effect on plans that already exist.
+      * It should thus be called before the first transform. Values 
+      * greater than 1 require compilation with PSCF_OPENMP defined.
+      *
+      * \param nThread number of threads (nThread > 0)
+      */
+      static void setNThread(int nThread);
+
+      /**
+      * Get the number of threads used by newly created FFTW plans.
+      */
+      static int nThread();
+
+      /**
+      * Set the rigor used by the FFTW planner for new plans.
+      *
+      * Allowed values are "estimate" (the default), "measure", "patient" 
+      * and "exhaustive", which correspond to the FFTW planner flags
+      * FFTW_ESTIMATE, FFTW_MEASURE, FFTW_PATIENT and FFTW_EXHAUSTIVE.
+      * More rigorous planning takes longer, but usually yields faster 
+      * transforms. Planning is always done using private work arrays,
+      * so that data in fields passed to setup is never overwritten.
+      *
+      * \param rigor planning rigor (estimate, measure, patient, exhaustive)
+      */
+      static void setPlanRigor(std::string const & rigor);
+
+      /**
+      * Get the FFTW planner flags used for new plans.
+      */
+      static unsigned int planFlags();
+
+      /**
+      * Import accumulated FFTW wisdom from a file.
+      *
+      * Wisdom must be imported before plans are created in order to
+      * be used. Returns false, and leaves the wisdom unchanged, if the
+      * file does not exist or cannot be read.
+      *
+      * \param filename name of wisdom file
+      * \return true if wisdom was successfully imported
+      */
+      static bool readWisdom(std::string const & filename);
+
+      /**
+      * Export all accumulated FFTW wisdom to a file.
+      *
+      * \param filename name of wisdom file
+      */
+      static void writeWisdom(std::string const & filename);
+
    private:
 
       // Work array for real data.
@@ -94,6 +163,12 @@ namespace Pspc {
       // Have array dimension and plan been initialized?
       bool isSetup_;
 
+      // Number of threads used by FFTW plans.
+      static int nThread_;
+
+      // Planner flags used by FFTW plans.
+      static unsigned int planFlags_;
+
       /**
       * Make FFTW plans for transform and inverse transform.
       */
@@ -119,6 +194,20 @@ namespace Pspc {
    inline const IntVec<D>& FFT<D>::meshDimensions() const
    {  return meshDimensions_; }
 
+   /*
+   * Get the number of threads used by newly created FFTW plans.
+   */
+   template <int D>
+   inline int FFT<D>::nThread()
+   {  return nThread_; }
+
+   /*
+   * Get the FFTW planner flags used for new plans.
+   */
+   template <int D>
+   inline unsigned int FFT<D>::planFlags()
+   {  return planFlags_; }
+
    #ifndef PSPC_FFT_TPP
    // Suppress implicit instantiation
    extern template class FFT<1>;
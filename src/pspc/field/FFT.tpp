@@ -16,6 +16,83 @@ namespace Pspc
 
    using namespace Util;
 
+   /*
+   * Number of threads used by FFTW plans (static member).
+   */
+   template <int D>
+   int FFT<D>::nThread_ = 1;
+
+   /*
+   * Planner flags used by FFTW plans (static member).
+   */
+   template <int D>
+   unsigned int FFT<D>::planFlags_ = FFTW_ESTIMATE;
+
+   /*
+   * Set number of threads used by FFTW plans (static).
+   */
+   template <int D>
+   void FFT<D>::setNThread(int nThread)
+   {
+      UTIL_CHECK(nThread > 0);
+      #ifdef PSCF_OPENMP
+      static bool hasThreads = false;
+      if (!hasThreads) {
+         if (!fftw_init_threads()) {
+            UTIL_THROW("Failure in fftw_init_threads");
+         }
+         hasThreads = true;
+      }
+      #else
+      if (nThread > 1) {
+         UTIL_THROW("Multi-threaded FFT requires PSCF_OPENMP");
+      }
+      #endif
+      nThread_ = nThread;
+   }
+
+   /*
+   * Set rigor of FFTW planner (static).
+   */
+   template <int D>
+   void FFT<D>::setPlanRigor(std::string const & rigor)
+   {
+      if (rigor == "estimate") {
+         planFlags_ = FFTW_ESTIMATE;
+      } else 
+      if (rigor == "measure") {
+         planFlags_ = FFTW_MEASURE;
+      } else 
+      if (rigor == "patient") {
+         planFlags_ = FFTW_PATIENT;
+      } else 
+      if (rigor == "exhaustive") {
+         planFlags_ = FFTW_EXHAUSTIVE;
+      } else {
+         UTIL_THROW("Unknown FFT planning rigor");
+      }
+   }
+
+   /*
+   * Import FFTW wisdom from a file (static).
+   */
+   template <int D>
+   bool FFT<D>::readWisdom(std::string const & filename)
+   {  return (bool) fftw_import_wisdom_from_filename(filename.c_str()); }
+
+   /*
+   * Export FFTW wisdom to a file (static).
+   */
+   template <int D>
+   void FFT<D>::writeWisdom(std::string const & filename)
+   {
+      if (!fftw_export_wisdom_to_filename(filename.c_str())) {
+         Log::file() << "Failed to write wisdom file: " 
+                     << filename << std::endl;
+         UTIL_THROW("Failure in fftw_export_wisdom_to_filename");
+      }
+   }
+
    /*
    * Default constructor.
    */
@@ -82,8 +159,17 @@ namespace Pspc
       }
       UTIL_CHECK(work_.capacity() == rSize_);
 
-      // Make FFTW plans (explicit specializations)
-      makePlans(rField, kField);
+      // Set number of threads for new plans
+      #ifdef PSCF_OPENMP
+      fftw_plan_with_nthreads(nThread_);
+      #endif
+
+      // Make FFTW plans (explicit specializations). Plans are made
+      // using private work arrays, because planning with any rigor 
+      // other than FFTW_ESTIMATE overwrites the input and output.
+      RFieldDft<D> kWork;
+      kWork.allocate(rDimensions);
+      makePlans(work_, kWork);
 
       isSetup_ = true;
    }
@@ -113,6 +199,22 @@ namespace Pspc
       fftw_execute_dft_r2c(fPlan_, &work_[0], &kField[0]);
    }
 
+   /*
+   * Execute forward transform without normalization or copying.
+   */
+   template <int D>
+   void 
+   FFT<D>::forwardTransformUnscaled(RField<D>& rField, RFieldDft<D>& kField)
+   {
+      if (isSetup_) {
+         UTIL_CHECK(rField.capacity() == rSize_);
+         UTIL_CHECK(kField.capacity() == kSize_);
+      } else {
+         setup(rField, kField);
+      }
+      fftw_execute_dft_r2c(fPlan_, &rField[0], &kField[0]);
+   }
+
    /*
    * Execute inverse (complex-to-real) transform.
    */
@@ -121,10 +223,8 @@ namespace Pspc
    {
       if (!isSetup_) {
          setup(rField, kField);
-         fftw_execute(iPlan_);
-      } else {
-         fftw_execute_dft_c2r(iPlan_, &kField[0], &rField[0]);
       }
+      fftw_execute_dft_c2r(iPlan_, &kField[0], &rField[0]);
    }
 
 }
@@ -0,0 +1,226 @@
+#ifndef PSPC_FFT_BATCHED_H
+#define PSPC_FFT_BATCHED_H
+
+/*
+* PSCF++ Package
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include <pspc/field/Field.h>
+#include <pspc/field/RField.h>
+#include <pspc/field/RFieldDft.h>
+#include <pscf/math/IntVec.h>
+#include <util/containers/DArray.h>
+#include <util/global.h>
+
+#include <fftw3.h>
+
+namespace Pscf {
+namespace Pspc {
+
+   using namespace Util;
+   using namespace Pscf;
+
+   /**
+   * Fourier transform wrapper for batches of real fields.
+   *
+   * An FFTBatched<D> computes the Fourier transforms of several fields
+   * defined on the same mesh with a single pair of FFTW plans, created
+   * with fftw_plan_many_dft_r2c and fftw_plan_many_dft_c2r. Conventions
+   * for normalization are the same as for FFT<D>: The forward transform
+   * is divided by the number of grid points, and the inverse is not.
+   * Plans are created using the number of threads and planning rigor
+   * currently set for FFT<D>.
+   *
+   * Two interfaces are provided. Transforms of contiguous batches take
+   * Field<double> and Field<fftw_complex> arrays in which the fields
+   * are stored one after another, with capacities batchSize*rSize and
+   * batchSize*kSize, respectively. Transforms of arrays of RField and
+   * RFieldDft objects copy data to and from private contiguous work
+   * arrays before and after the transform.
+   *
+   * \ingroup Pspc_Field_Module
+   */
+   template <int D>
+   class FFTBatched
+   {
+
+   public:
+
+      /**
+      * Default constructor.
+      */
+      FFTBatched();
+
+      /**
+      * Destructor.
+      */
+      virtual ~FFTBatched();
+
+      /**
+      * Setup grid dimensions, batch size, plans and work space.
+      *
+      * May be called again with different parameters, in which case
+      * existing plans are destroyed and new plans are created.
+      *
+      * \param meshDimensions number of grid points in each direction
+      * \param batchSize number of fields in each batch
+      */
+      void setup(IntVec<D> const & meshDimensions, int batchSize);
+
+      /**
+      * Compute forward transforms of a contiguous batch of fields.
+      *
+      * \param in  real values for batchSize fields on the r-space grid
+      * \param out  complex values for batchSize fields on k-space grid
+      */
+      void forwardTransform(Field<double>& in, Field<fftw_complex>& out);
+
+      /**
+      * Compute unnormalized forward transforms of a contiguous batch.
+      *
+      * The output is equal to that of forwardTransform multiplied by 
+      * rSize(). The input array is not modified or copied.
+      *
+      * \param in  real values for batchSize fields on the r-space grid
+      * \param out  complex values for batchSize fields on k-space grid
+      */
+      void forwardTransformUnscaled(Field<double>& in, 
+                                    Field<fftw_complex>& out);
+
+      /**
+      * Compute inverse transforms of a contiguous batch of fields.
+      *
+      * As for FFT<D>, the input array is overwritten.
+      *
+      * \param in  complex values for batchSize fields on k-space grid
+      * \param out  real values for batchSize fields on r-space grid
+      */
+      void inverseTransform(Field<fftw_complex>& in, Field<double>& out);
+
+      /**
+      * Compute forward transforms of an array of fields.
+      *
+      * \param in  array of batchSize fields on r-space grid
+      * \param out  array of batchSize fields on k-space grid
+      */
+      void forwardTransform(DArray< RField<D> >& in,
+                            DArray< RFieldDft<D> >& out);
+
+      /**
+      * Compute inverse transforms of an array of fields.
+      *
+      * \param in  array of batchSize fields on k-space grid
+      * \param out  array of batchSize fields on r-space grid
+      */
+      void inverseTransform(DArray< RFieldDft<D> >& in,
+                            DArray< RField<D> >& out);
+
+      /**
+      * Return the dimensions of the grid for which this was allocated.
+      */
+      const IntVec<D>& meshDimensions() const;
+
+      /**
+      * Return the number of fields in each batch.
+      */
+      int batchSize() const;
+
+      /**
+      * Return the number of points in the r-space grid of one field.
+      */
+      int rSize() const;
+
+      /**
+      * Return the number of points in the k-space grid of one field.
+      */
+      int kSize() const;
+
+      /**
+      * Have the grid dimensions and plans been initialized?
+      */
+      bool isSetup() const;
+
+   private:
+
+      // Contiguous work array for real data.
+      Field<double> rWork_;
+
+      // Contiguous work array for complex data.
+      Field<fftw_complex> kWork_;
+
+      // Vector containing number of grid points in each direction.
+      IntVec<D> meshDimensions_;
+
+      // Number of points in r-space grid of one field
+      int rSize_;
+
+      // Number of points in k-space grid of one field
+      int kSize_;
+
+      // Number of fields in each batch
+      int batchSize_;
+
+      // Pointer to a plan for a batch of forward transforms.
+      fftw_plan fPlan_;
+
+      // Pointer to a plan for a batch of inverse transforms.
+      fftw_plan iPlan_;
+
+      // Have array dimensions and plans been initialized?
+      bool isSetup_;
+
+      /**
+      * Destroy existing plans, if any.
+      */
+      void destroyPlans();
+
+   };
+
+   /*
+   * Return the dimensions of the grid for which this was allocated.
+   */
+   template <int D>
+   inline const IntVec<D>& FFTBatched<D>::meshDimensions() const
+   {  return meshDimensions_; }
+
+   /*
+   * Return the number of fields in each batch.
+   */
+   template <int D>
+   inline int FFTBatched<D>::batchSize() const
+   {  return batchSize_; }
+
+   /*
+   * Return the number of points in the r-space grid of one field.
+   */
+   template <int D>
+   inline int FFTBatched<D>::rSize() const
+   {  return rSize_; }
+
+   /*
+   * Return the number of points in the k-space grid of one field.
+   */
+   template <int D>
+   inline int FFTBatched<D>::kSize() const
+   {  return kSize_; }
+
+   /*
+   * Have the grid dimensions and plans been initialized?
+   */
+   template <int D>
+   inline bool FFTBatched<D>::isSetup() const
+   {  return isSetup_; }
+
+   #ifndef PSPC_FFT_BATCHED_TPP
+   // Suppress implicit instantiation
+   extern template class FFTBatched<1>;
+   extern template class FFTBatched<2>;
+   extern template class FFTBatched<3>;
+   #endif
+
+} // namespace Pscf::Pspc
+} // namespace Pscf
+#endif
@@ -0,0 +1,250 @@
+#ifndef PSPC_FFT_BATCHED_TPP
+#define PSPC_FFT_BATCHED_TPP
+
+/*
+* PSCF++ Package
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "FFTBatched.h"
+#include "FFT.h"
+
+namespace Pscf {
+namespace Pspc
+{
+
+   using namespace Util;
+
+   /*
+   * Default constructor.
+   */
+   template <int D>
+   FFTBatched<D>::FFTBatched()
+    : rWork_(),
+      kWork_(),
+      meshDimensions_(0),
+      rSize_(0),
+      kSize_(0),
+      batchSize_(0),
+      fPlan_(0),
+      iPlan_(0),
+      isSetup_(false)
+   {}
+
+   /*
+   * Destructor.
+   */
+   template <int D>
+   FFTBatched<D>::~FFTBatched()
+   {  destroyPlans(); }
+
+   /*
+   * Setup mesh dimensions, batch size, work arrays and plans.
+   */
+   template <int D>
+   void FFTBatched<D>::setup(IntVec<D> const & meshDimensions,
+                             int batchSize)
+   {
+      UTIL_CHECK(batchSize > 0);
+
+      // Set and check mesh dimensions
+      int rSize = 1;
+      int kSize = 1;
+      int n[D];
+      for (int i = 0; i < D; ++i) {
+         UTIL_CHECK(meshDimensions[i] > 0);
+         n[i] = meshDimensions[i];
+         rSize *= meshDimensions[i];
+         if (i < D - 1) {
+            kSize *= meshDimensions[i];
+         } else {
+            kSize *= (meshDimensions[i]/2 + 1);
+         }
+      }
+
+      // Return if already setup with the same parameters
+      if (isSetup_) {
+         if (meshDimensions == meshDimensions_ && batchSize == batchSize_) {
+            return;
+         }
+      }
+      destroyPlans();
+      meshDimensions_ = meshDimensions;
+      rSize_ = rSize;
+      kSize_ = kSize;
+      batchSize_ = batchSize;
+
+      // Allocate contiguous work arrays
+      if (rWork_.isAllocated()) {
+         rWork_.deallocate();
+      }
+      if (kWork_.isAllocated()) {
+         kWork_.deallocate();
+      }
+      rWork_.allocate(rSize_*batchSize_);
+      kWork_.allocate(kSize_*batchSize_);
+
+      // Make plans, using work arrays, with threads and rigor of FFT<D>
+      #ifdef PSCF_OPENMP
+      fftw_plan_with_nthreads(FFT<D>::nThread());
+      #endif
+      unsigned int flags = FFT<D>::planFlags();
+      fPlan_ = fftw_plan_many_dft_r2c(D, n, batchSize_,
+                                      &rWork_[0], NULL, 1, rSize_,
+                                      &kWork_[0], NULL, 1, kSize_,
+                                      flags);
+      iPlan_ = fftw_plan_many_dft_c2r(D, n, batchSize_,
+                                      &kWork_[0], NULL, 1, kSize_,
+                                      &rWork_[0], NULL, 1, rSize_,
+                                      flags);
+      UTIL_CHECK(fPlan_);
+      UTIL_CHECK(iPlan_);
+
+      isSetup_ = true;
+   }
+
+   /*
+   * Execute forward transforms of a contiguous batch.
+   */
+   template <int D>
+   void
+   FFTBatched<D>::forwardTransform(Field<double>& in,
+                                   Field<fftw_complex>& out)
+   {
+      UTIL_CHECK(isSetup_);
+      UTIL_CHECK(in.capacity() == rSize_*batchSize_);
+      UTIL_CHECK(out.capacity() == kSize_*batchSize_);
+
+      // Copy rescaled input data into work array
+      const int n = rSize_*batchSize_;
+      const double scale = 1.0/double(rSize_);
+      for (int i = 0; i < n; ++i) {
+         rWork_[i] = in[i]*scale;
+      }
+
+      fftw_execute_dft_r2c(fPlan_, &rWork_[0], &out[0]);
+   }
+
+   /*
+   * Execute unnormalized forward transforms of a contiguous batch.
+   */
+   template <int D>
+   void
+   FFTBatched<D>::forwardTransformUnscaled(Field<double>& in,
+                                           Field<fftw_complex>& out)
+   {
+      UTIL_CHECK(isSetup_);
+      UTIL_CHECK(in.capacity() == rSize_*batchSize_);
+      UTIL_CHECK(out.capacity() == kSize_*batchSize_);
+
+      fftw_execute_dft_r2c(fPlan_, &in[0], &out[0]);
+   }
+
+   /*
+   * Execute inverse transforms of a contiguous batch.
+   */
+   template <int D>
+   void
+   FFTBatched<D>::inverseTransform(Field<fftw_complex>& in,
+                                   Field<double>& out)
+   {
+      UTIL_CHECK(isSetup_);
+      UTIL_CHECK(in.capacity() == kSize_*batchSize_);
+      UTIL_CHECK(out.capacity() == rSize_*batchSize_);
+
+      fftw_execute_dft_c2r(iPlan_, &in[0], &out[0]);
+   }
+
+   /*
+   * Execute forward transforms of an array of fields.
+   */
+   template <int D>
+   void
+   FFTBatched<D>::forwardTransform(DArray< RField<D> >& in,
+                                   DArray< RFieldDft<D> >& out)
+   {
+      UTIL_CHECK(isSetup_);
+      UTIL_CHECK(in.capacity() == batchSize_);
+      UTIL_CHECK(out.capacity() == batchSize_);
+
+      // Copy rescaled input data into contiguous work array
+      const double scale = 1.0/double(rSize_);
+      int i, j, k;
+      for (j = 0; j < batchSize_; ++j) {
+         UTIL_CHECK(in[j].capacity() == rSize_);
+         k = j*rSize_;
+         for (i = 0; i < rSize_; ++i) {
+            rWork_[k + i] = in[j][i]*scale;
+         }
+      }
+
+      fftw_execute_dft_r2c(fPlan_, &rWork_[0], &kWork_[0]);
+
+      // Copy output from contiguous work array
+      for (j = 0; j < batchSize_; ++j) {
+         UTIL_CHECK(out[j].capacity() == kSize_);
+         k = j*kSize_;
+         for (i = 0; i < kSize_; ++i) {
+            out[j][i][0] = kWork_[k + i][0];
+            out[j][i][1] = kWork_[k + i][1];
+         }
+      }
+   }
+
+   /*
+   * Execute inverse transforms of an array of fields.
+   */
+   template <int D>
+   void
+   FFTBatched<D>::inverseTransform(DArray< RFieldDft<D> >& in,
+                                   DArray< RField<D> >& out)
+   {
+      UTIL_CHECK(isSetup_);
+      UTIL_CHECK(in.capacity() == batchSize_);
+      UTIL_CHECK(out.capacity() == batchSize_);
+
+      // Copy input data into contiguous work array
+      int i, j, k;
+      for (j = 0; j < batchSize_; ++j) {
+         UTIL_CHECK(in[j].capacity() == kSize_);
+         k = j*kSize_;
+         for (i = 0; i < kSize_; ++i) {
+            kWork_[k + i][0] = in[j][i][0];
+            kWork_[k + i][1] = in[j][i][1];
+         }
+      }
+
+      fftw_execute_dft_c2r(iPlan_, &kWork_[0], &rWork_[0]);
+
+      // Copy output from contiguous work array
+      for (j = 0; j < batchSize_; ++j) {
+         UTIL_CHECK(out[j].capacity() == rSize_);
+         k = j*rSize_;
+         for (i = 0; i < rSize_; ++i) {
+            out[j][i] = rWork_[k + i];
+         }
+      }
+   }
+
+   /*
+   * Destroy existing plans, if any.
+   */
+   template <int D>
+   void FFTBatched<D>::destroyPlans()
+   {
+      if (fPlan_) {
+         fftw_destroy_plan(fPlan_);
+         fPlan_ = 0;
+      }
+      if (iPlan_) {
+         fftw_destroy_plan(iPlan_);
+         iPlan_ = 0;
+      }
+      isSetup_ = false;
+   }
+
+}
+}
+#endif
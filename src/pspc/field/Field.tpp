@@ -131,6 +131,7 @@ namespace Pspc
          UTIL_THROW("Array is not allocated");
       }
       fftw_free(data_);
+      data_ = 0;
       capacity_ = 0;
    }
 
@@ -9,6 +9,7 @@
 */
 
 #include <pspc/field/FFT.h>                // member
+#include <pspc/field/FFTBatched.h>         // member
 #include <pspc/field/RField.h>             // function parameter
 #include <pspc/field/RFieldDft.h>          // function parameter
 
@@ -239,6 +240,9 @@ namespace Pspc
       /**
       * Convert field from symmetrized basis to Fourier transform (k-grid).
       *
+      * Conversions between basis and k-grid use flat index and coefficient
+      * maps that are constructed on first use for each basis and mesh.
+      *
       * \param components coefficients of symmetry-adapted basis functions
       * \param dft discrete Fourier transform of a real field
       */
@@ -277,6 +281,32 @@ namespace Pspc
       void convertKGridToBasis(DArray< RFieldDft<D> > & in,
                                DArray< DArray <double> > & out);
 
+      /**
+      * Convert field from symmetrized basis to k-grid by a loop over stars.
+      *
+      * This function computes the same result as convertBasisToKGrid by
+      * a direct loop over stars and waves of the basis, without use of
+      * precomputed maps. It is retained for testing and benchmarking.
+      *
+      * \param in  coefficients of symmetry-adapted basis functions
+      * \param out  discrete Fourier transform of a real field
+      */
+      void convertBasisToKGridStars(DArray<double> const& in,
+                                    RFieldDft<D>& out);
+
+      /**
+      * Convert field from k-grid to symmetrized basis by a loop over stars.
+      *
+      * This function computes the same result as convertKGridToBasis by
+      * a direct loop over stars of the basis, without use of precomputed
+      * maps. It is retained for testing and benchmarking.
+      *
+      * \param in  complex DFT (k-grid) representation of a field.
+      * \param out  coefficients of symmetry-adapted basis functions.
+      */
+      void convertKGridToBasisStars(RFieldDft<D> const& in,
+                                    DArray<double>& out);
+
       /**
       * Convert fields from symmetrized basis to spatial grid (rgrid).
       * 
@@ -302,6 +332,49 @@ namespace Pspc
       // DFT work array for two-step conversion basis <-> kgrid <-> rgrid.
       RFieldDft<D> workDft_;
 
+      // DFT work arrays for conversion of arrays of fields.
+      DArray< RFieldDft<D> > workDfts_;
+
+      // Batched FFT for conversion of arrays of fields.
+      FFTBatched<D> fftBatched_;
+
+      // Maps for conversion between basis and k-grid, made by makeMaps.
+
+      // Scatter map (basis -> k-grid), with one entry per explicit wave
+      // in an uncancelled star. Entry i sets the DFT coefficient at rank
+      // waveIds_[3*i] to c1*in[waveIds_[3*i+1]] + c2*in[waveIds_[3*i+2]],
+      // with real and imaginary parts of c1 and c2 in waveCoeffs_[4*i],
+      // ..., waveCoeffs_[4*i+3].
+      DArray<int> waveIds_;
+      DArray<double> waveCoeffs_;
+
+      // Gather map (k-grid -> basis), with one entry per closed star or
+      // pair of stars related by inversion. Entry i multiplies the DFT
+      // coefficient at rank starIds_[3*i] by the complex factor stored
+      // in starCoeffs_[2*i] and starCoeffs_[2*i+1], and stores the real
+      // part in component starIds_[3*i+1]. If starIds_[3*i+2] == 1, the
+      // negative of the imaginary part is stored in the next component.
+      DArray<int> starIds_;
+      DArray<double> starCoeffs_;
+
+      /// Number of entries in the scatter map.
+      int nWaveMap_;
+
+      /// Number of entries in the gather map.
+      int nStarMap_;
+
+      /// Number of waves in the basis used to make maps.
+      int mapNWave_;
+
+      /// Number of stars in the basis used to make maps.
+      int mapNStar_;
+
+      /// Dimensions of the r-grid mesh used to make maps.
+      IntVec<D> mapMeshDimensions_;
+
+      /// Have maps been constructed?
+      bool hasMaps_;
+
       // Pointers to associated objects.
 
       /// Pointer to crystallographic unit cell.
@@ -400,6 +473,43 @@ namespace Pspc
       */
       void checkWorkDft();
 
+      /**
+      * Check state of batch work arrays and batched FFT, setup if needed.
+      *
+      * \param nField number of fields in each batch
+      */
+      void checkWorkDfts(int nField);
+
+      /**
+      * Make maps if they do not exist or are outdated.
+      */
+      void checkMaps();
+
+      /**
+      * Construct gather and scatter maps for the current basis and mesh.
+      */
+      void makeMaps();
+
+      /**
+      * Convert an array of fields from basis to k-grid using maps.
+      *
+      * \param in  array of pointers to basis components of fields
+      * \param out  array of pointers to DFT arrays of fields
+      * \param nField  number of fields
+      */
+      void scatterBasisToKGrid(double const * const * in,
+                               fftw_complex * const * out, int nField);
+
+      /**
+      * Convert an array of fields from k-grid to basis using maps.
+      *
+      * \param in  array of pointers to DFT arrays of fields
+      * \param out  array of pointers to basis components of fields
+      * \param nField  number of fields
+      */
+      void gatherKGridToBasis(fftw_complex const * const * in,
+                              double * const * out, int nField);
+
    };
 
    #ifndef PSPC_FIELD_IO_TPP
@@ -18,6 +18,8 @@
 #include <util/format/Int.h>
 #include <util/format/Dbl.h>
 
+#include <cmath>
+#include <complex>
 #include <iomanip>
 #include <string>
 
@@ -32,7 +34,13 @@ namespace Pspc
    */
    template <int D>
    FieldIo<D>::FieldIo()
-    : unitCellPtr_(0),
+    : nWaveMap_(0),
+      nStarMap_(0),
+      mapNWave_(0),
+      mapNStar_(0),
+      mapMeshDimensions_(0),
+      hasMaps_(false),
+      unitCellPtr_(0),
       meshPtr_(0),
       fftPtr_(0),
       groupNamePtr_(0),
@@ -504,9 +512,12 @@ namespace Pspc
           << "          " << nMonomer << std::endl;
    }
 
+   /*
+   * Convert a field from basis to k-grid, by a loop over stars.
+   */
    template <int D>
-   void FieldIo<D>::convertBasisToKGrid(DArray<double> const& in, 
-                                        RFieldDft<D>& out)
+   void FieldIo<D>::convertBasisToKGridStars(DArray<double> const& in, 
+                                             RFieldDft<D>& out)
    {
       // Create Mesh<D> with dimensions of DFT Fourier grid.
       Mesh<D> dftMesh(out.dftDimensions());
@@ -602,9 +613,12 @@ namespace Pspc
 
    }
 
+   /*
+   * Convert a field from k-grid to basis, by a loop over stars.
+   */
    template <int D>
-   void FieldIo<D>::convertKGridToBasis(RFieldDft<D> const& in, 
-                                        DArray<double>& out)
+   void FieldIo<D>::convertKGridToBasisStars(RFieldDft<D> const& in, 
+                                             DArray<double>& out)
    {
       // Create Mesh<D> with dimensions of DFT Fourier grid.
       Mesh<D> dftMesh(in.dftDimensions());
@@ -691,26 +705,76 @@ namespace Pspc
       } //  loop over star index is
    }
 
+   /*
+   * Convert a field from basis to k-grid, using maps.
+   */
+   template <int D>
+   void FieldIo<D>::convertBasisToKGrid(DArray<double> const& in, 
+                                        RFieldDft<D>& out)
+   {
+      checkMaps();
+      UTIL_CHECK(out.meshDimensions() == mapMeshDimensions_);
+      double const * inPtr = in.cArray();
+      fftw_complex * outPtr = out.cField();
+      scatterBasisToKGrid(&inPtr, &outPtr, 1);
+   }
+
+   /*
+   * Convert a field from k-grid to basis, using maps.
+   */
+   template <int D>
+   void FieldIo<D>::convertKGridToBasis(RFieldDft<D> const& in, 
+                                        DArray<double>& out)
+   {
+      checkMaps();
+      UTIL_CHECK(in.meshDimensions() == mapMeshDimensions_);
+      fftw_complex const * inPtr = in.cField();
+      double * outPtr = out.cArray();
+      gatherKGridToBasis(&inPtr, &outPtr, 1);
+   }
+
+   /*
+   * Convert an array of fields from basis to k-grid.
+   */
    template <int D>
    void FieldIo<D>::convertBasisToKGrid(DArray< DArray <double> >& in,
                                         DArray< RFieldDft<D> >& out)
    {
       UTIL_ASSERT(in.capacity() == out.capacity());
       int n = in.capacity();
+      checkMaps();
+      DArray<double const *> inPtrs;
+      DArray<fftw_complex *> outPtrs;
+      inPtrs.allocate(n);
+      outPtrs.allocate(n);
       for (int i = 0; i < n; ++i) {
-         convertBasisToKGrid(in[i], out[i]);
+         UTIL_CHECK(out[i].meshDimensions() == mapMeshDimensions_);
+         inPtrs[i] = in[i].cArray();
+         outPtrs[i] = out[i].cField();
       }
+      scatterBasisToKGrid(inPtrs.cArray(), outPtrs.cArray(), n);
    }
 
+   /*
+   * Convert an array of fields from k-grid to basis.
+   */
    template <int D>
    void FieldIo<D>::convertKGridToBasis(DArray< RFieldDft<D> >& in,
                                         DArray< DArray <double> > & out)
    {
       UTIL_ASSERT(in.capacity() == out.capacity());
       int n = in.capacity();
+      checkMaps();
+      DArray<fftw_complex const *> inPtrs;
+      DArray<double *> outPtrs;
+      inPtrs.allocate(n);
+      outPtrs.allocate(n);
       for (int i = 0; i < n; ++i) {
-         convertKGridToBasis(in[i], out[i]);
+         UTIL_CHECK(in[i].meshDimensions() == mapMeshDimensions_);
+         inPtrs[i] = in[i].cField();
+         outPtrs[i] = out[i].cArray();
       }
+      gatherKGridToBasis(inPtrs.cArray(), outPtrs.cArray(), n);
    }
 
    template <int D>
@@ -719,13 +783,11 @@ namespace Pspc
                                    DArray< RField<D> >& out)
    {
       UTIL_ASSERT(in.capacity() == out.capacity());
-      checkWorkDft();
-
       int n = in.capacity();
-      for (int i = 0; i < n; ++i) {
-         convertBasisToKGrid(in[i], workDft_);
-         fft().inverseTransform(workDft_, out[i]);
-      }
+      checkWorkDfts(n);
+
+      convertBasisToKGrid(in, workDfts_);
+      fftBatched_.inverseTransform(workDfts_, out);
    }
 
    template <int D>
@@ -734,15 +796,300 @@ namespace Pspc
                                    DArray< DArray <double> > & out)
    {
       UTIL_ASSERT(in.capacity() == out.capacity());
-      checkWorkDft();
-
       int n = in.capacity();
-      for (int i = 0; i < n; ++i) {
-         fft().forwardTransform(in[i], workDft_);
-         convertKGridToBasis(workDft_, out[i]);
+      checkWorkDfts(n);
+
+      fftBatched_.forwardTransform(in, workDfts_);
+      convertKGridToBasis(workDfts_, out);
+   }
+
+   /*
+   * Scatter basis components of an array of fields to the k-grid.
+   */
+   template <int D>
+   void FieldIo<D>::scatterBasisToKGrid(double const * const * in,
+                                        fftw_complex * const * out,
+                                        int nField)
+   {
+      int const * ids = waveIds_.cArray();
+      double const * c = waveCoeffs_.cArray();
+      int kSize = 1;
+      for (int j = 0; j < D; ++j) {
+         kSize *= (j < D - 1) ? mapMeshDimensions_[j] 
+                              : mapMeshDimensions_[j]/2 + 1;
+      }
+      int i, k;
+
+      // Zero all DFT coefficients, including those of cancelled stars
+      #ifdef PSCF_OPENMP
+      #pragma omp parallel for private(k) schedule(static) \
+              if (kSize*nField > 4096)
+      #endif
+      for (i = 0; i < kSize; ++i) {
+         for (k = 0; k < nField; ++k) {
+            out[k][i][0] = 0.0;
+            out[k][i][1] = 0.0;
+         }
+      }
+
+      // Scatter c1*in[a] + c2*in[b] for each explicit wave
+      double x, y;
+      int rank, a, b;
+      #ifdef PSCF_OPENMP
+      #pragma omp parallel for private(k, x, y, rank, a, b) \
+              schedule(static) if (nWaveMap_*nField > 4096)
+      #endif
+      for (i = 0; i < nWaveMap_; ++i) {
+         rank = ids[3*i];
+         a = ids[3*i+1];
+         b = ids[3*i+2];
+         for (k = 0; k < nField; ++k) {
+            x = in[k][a];
+            y = in[k][b];
+            out[k][rank][0] = c[4*i]*x + c[4*i+2]*y;
+            out[k][rank][1] = c[4*i+1]*x + c[4*i+3]*y;
+         }
       }
    }
 
+   /*
+   * Gather basis components of an array of fields from the k-grid.
+   */
+   template <int D>
+   void FieldIo<D>::gatherKGridToBasis(fftw_complex const * const * in,
+                                       double * const * out,
+                                       int nField)
+   {
+      int const * ids = starIds_.cArray();
+      double const * c = starCoeffs_.cArray();
+      int i, k;
+
+      // Zero all components, including those of cancelled stars
+      for (k = 0; k < nField; ++k) {
+         for (i = 0; i < mapNStar_; ++i) {
+            out[k][i] = 0.0;
+         }
+      }
+
+      // Gather one closed star or pair of stars per entry
+      double re, im, zr, zi;
+      double maxImag = 0.0;
+      int rank, is;
+      #ifdef PSCF_OPENMP
+      #pragma omp parallel for private(k, re, im, zr, zi, rank, is) \
+              reduction(max:maxImag) schedule(static) \
+              if (nStarMap_*nField > 4096)
+      #endif
+      for (i = 0; i < nStarMap_; ++i) {
+         rank = ids[3*i];
+         is = ids[3*i+1];
+         for (k = 0; k < nField; ++k) {
+            re = in[k][rank][0];
+            im = in[k][rank][1];
+            zr = c[2*i]*re - c[2*i+1]*im;
+            zi = c[2*i]*im + c[2*i+1]*re;
+            out[k][is] = zr;
+            if (ids[3*i+2]) {
+               out[k][is+1] = -zi;
+            } else
+            if (std::abs(zi) > maxImag) {
+               maxImag = std::abs(zi);
+            }
+         }
+      }
+
+      // Components of closed stars must be real
+      UTIL_CHECK(maxImag < 1.0E-8);
+   }
+
+   /*
+   * Make maps if they do not exist, or if the basis or mesh changed.
+   */
+   template <int D>
+   void FieldIo<D>::checkMaps()
+   {
+      if (hasMaps_) {
+         if (mapNWave_ == basis().nWave() 
+             && mapNStar_ == basis().nStar()
+             && mapMeshDimensions_ == mesh().dimensions()) {
+            return;
+         }
+      }
+      makeMaps();
+   }
+
+   /*
+   * Construct scatter and gather maps for the current basis and mesh.
+   */
+   template <int D>
+   void FieldIo<D>::makeMaps()
+   {
+      UTIL_CHECK(basis().nStar() > 0);
+
+      // Mesh with dimensions of DFT Fourier grid
+      IntVec<D> dftDimensions = mesh().dimensions();
+      dftDimensions[D-1] = mesh().dimension(D-1)/2 + 1;
+      Mesh<D> dftMesh(dftDimensions);
+
+      typename Basis<D>::Star const* starPtr; // pointer to current star
+      typename Basis<D>::Wave const* wavePtr; // pointer to current wave
+      std::complex<double> c1, c2;            // scatter coefficients
+      std::complex<double> factor;            // gather coefficient
+      int nStar = basis().nStar();
+      int is, iw, js, n;
+
+      // Count entries of each map
+      nWaveMap_ = 0;
+      nStarMap_ = 0;
+      is = 0;
+      while (is < nStar) {
+         starPtr = &(basis().star(is));
+         if (starPtr->cancel) {
+            ++is;
+            continue;
+         }
+         n = (starPtr->invertFlag == 0) ? 1 : 2;
+         for (js = is; js < is + n; ++js) {
+            starPtr = &(basis().star(js));
+            for (iw = starPtr->beginId; iw < starPtr->endId; ++iw) {
+               if (!basis().wave(iw).implicit) {
+                  ++nWaveMap_;
+               }
+            }
+         }
+         ++nStarMap_;
+         is += n;
+      }
+
+      // Allocate arrays
+      if (waveIds_.isAllocated()) {
+         waveIds_.deallocate();
+         waveCoeffs_.deallocate();
+         starIds_.deallocate();
+         starCoeffs_.deallocate();
+      }
+      waveIds_.allocate(3*nWaveMap_);
+      waveCoeffs_.allocate(4*nWaveMap_);
+      starIds_.allocate(3*nStarMap_);
+      starCoeffs_.allocate(2*nStarMap_);
+
+      // Fill map entries
+      std::complex<double> I(0.0, 1.0);
+      double sqrt2 = sqrt(2.0);
+      bool isImplicit;
+      int i = 0; // scatter map entry index
+      int j = 0; // gather map entry index
+      is = 0;
+      while (is < nStar) {
+         starPtr = &(basis().star(is));
+
+         if (starPtr->cancel) {
+            ++is;
+            continue;
+         }
+
+         if (starPtr->invertFlag == 0) {
+
+            // Scatter: out = in[is]*coeff for each explicit wave
+            for (iw = starPtr->beginId; iw < starPtr->endId; ++iw) {
+               wavePtr = &basis().wave(iw);
+               if (!wavePtr->implicit) {
+                  c1 = wavePtr->coeff;
+                  waveIds_[3*i] = dftMesh.rank(wavePtr->indicesDft);
+                  waveIds_[3*i+1] = is;
+                  waveIds_[3*i+2] = is;
+                  waveCoeffs_[4*i] = c1.real();
+                  waveCoeffs_[4*i+1] = c1.imag();
+                  waveCoeffs_[4*i+2] = 0.0;
+                  waveCoeffs_[4*i+3] = 0.0;
+                  ++i;
+               }
+            }
+
+            // Gather: choose a characteristic wave that is not implicit,
+            // alternately searching from the beginning and end of star.
+            isImplicit = true;
+            iw = 0;
+            while (isImplicit) {
+                UTIL_CHECK(iw <= (starPtr->size)/2);
+                wavePtr = &basis().wave(starPtr->beginId + iw);
+                if (wavePtr->implicit) {
+                   wavePtr = &basis().wave(starPtr->endId - 1 - iw);
+                }
+                isImplicit = wavePtr->implicit;
+                ++iw;
+            }
+            UTIL_CHECK(wavePtr->starId == is);
+            factor = 1.0/wavePtr->coeff;
+            starIds_[3*j] = dftMesh.rank(wavePtr->indicesDft);
+            starIds_[3*j+1] = is;
+            starIds_[3*j+2] = 0;
+            starCoeffs_[2*j] = factor.real();
+            starCoeffs_[2*j+1] = factor.imag();
+            ++j;
+
+            ++is;
+
+         } else
+         if (starPtr->invertFlag == 1) {
+
+            // Scatter: out = coeff*(in[is] -+ i*in[is+1])/sqrt(2) for
+            // explicit waves of the first (-) and second (+) stars
+            UTIL_CHECK(is + 1 < nStar);
+            UTIL_CHECK(basis().star(is+1).invertFlag == -1);
+            for (js = is; js < is + 2; ++js) {
+               starPtr = &(basis().star(js));
+               for (iw = starPtr->beginId; iw < starPtr->endId; ++iw) {
+                  wavePtr = &basis().wave(iw);
+                  if (!wavePtr->implicit) {
+                     c1 = wavePtr->coeff/sqrt2;
+                     c2 = (js == is) ? -I*c1 : I*c1;
+                     waveIds_[3*i] = dftMesh.rank(wavePtr->indicesDft);
+                     waveIds_[3*i+1] = is;
+                     waveIds_[3*i+2] = is + 1;
+                     waveCoeffs_[4*i] = c1.real();
+                     waveCoeffs_[4*i+1] = c1.imag();
+                     waveCoeffs_[4*i+2] = c2.real();
+                     waveCoeffs_[4*i+3] = c2.imag();
+                     ++i;
+                  }
+               }
+            }
+
+            // Gather: identify a characteristic wave that is not implicit,
+            // either first wave of 1st star or last wave of 2nd star.
+            starPtr = &(basis().star(is));
+            wavePtr = &basis().wave(starPtr->beginId);
+            if (wavePtr->implicit) {
+               starPtr = &(basis().star(is+1));
+               wavePtr = &basis().wave(starPtr->endId-1);
+               UTIL_CHECK(!(wavePtr->implicit));
+            } 
+            UTIL_CHECK(abs(wavePtr->coeff) > 1.0E-8);
+            factor = sqrt2/wavePtr->coeff;
+            starIds_[3*j] = dftMesh.rank(wavePtr->indicesDft);
+            starIds_[3*j+1] = is;
+            starIds_[3*j+2] = 1;
+            starCoeffs_[2*j] = factor.real();
+            starCoeffs_[2*j+1] = factor.imag();
+            ++j;
+
+            is += 2;
+
+         } else {
+            UTIL_THROW("Invalid invertFlag value");
+         }
+
+      }
+      UTIL_CHECK(i == nWaveMap_);
+      UTIL_CHECK(j == nStarMap_);
+
+      mapNWave_ = basis().nWave();
+      mapNStar_ = nStar;
+      mapMeshDimensions_ = mesh().dimensions();
+      hasMaps_ = true;
+   }
+
    template <int D>
    void FieldIo<D>::checkWorkDft()
    {
@@ -753,6 +1100,22 @@ namespace Pspc
       }
    }
 
+   template <int D>
+   void FieldIo<D>::checkWorkDfts(int nField)
+   {
+      UTIL_CHECK(nField > 0);
+      if (workDfts_.isAllocated() && workDfts_.capacity() != nField) {
+         workDfts_.deallocate();
+      }
+      if (!workDfts_.isAllocated()) {
+         workDfts_.allocate(nField);
+         for (int i = 0; i < nField; ++i) {
+            workDfts_[i].allocate(mesh().dimensions());
+         }
+      }
+      fftBatched_.setup(mesh().dimensions(), nField);
+   }
+
 } // namespace Pspc
 } // namespace Pscf
 #endif
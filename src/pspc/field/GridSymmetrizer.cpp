@@ -0,0 +1,22 @@
+/*
+* PSCF++ Package 
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "GridSymmetrizer.tpp"
+
+namespace Pscf {
+namespace Pspc {
+
+   using namespace Util;
+
+   // Explicit class instantiations
+
+   template class GridSymmetrizer<1>;
+   template class GridSymmetrizer<2>;
+   template class GridSymmetrizer<3>;
+
+}
+}
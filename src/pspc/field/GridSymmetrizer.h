@@ -0,0 +1,127 @@
+#ifndef PSPC_GRID_SYMMETRIZER_H
+#define PSPC_GRID_SYMMETRIZER_H
+
+/*
+* PSCF++ Package
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include <pspc/field/RField.h>
+#include <pscf/crystal/SpaceGroup.h>
+#include <pscf/mesh/Mesh.h>
+#include <util/containers/DArray.h>
+#include <util/global.h>
+
+namespace Pscf {
+namespace Pspc {
+
+   using namespace Util;
+   using namespace Pscf;
+
+   /**
+   * Projects fields on a real-space grid onto a space group.
+   *
+   * The symmetry elements of a space group map the points of a mesh
+   * onto one another if the mesh is compatible with the group. The 
+   * resulting sets of equivalent grid points (orbits) are computed once
+   * by setup(), and are stored as a list of grid point ranks sorted by
+   * orbit. The function symmetrize() then replaces the value of a field
+   * at every grid point by the average over its orbit, which is the 
+   * projection of the field onto the space of invariant fields. This
+   * costs O(N) operations for a mesh of N points, and does not require
+   * an FFT or a symmetry-adapted basis.
+   *
+   * \ingroup Pspc_Field_Module
+   */
+   template <int D>
+   class GridSymmetrizer
+   {
+
+   public:
+
+      /**
+      * Default constructor.
+      */
+      GridSymmetrizer();
+
+      /**
+      * Destructor.
+      */
+      ~GridSymmetrizer();
+
+      /**
+      * Compute the orbits of grid points for a group and mesh.
+      *
+      * Throws an Exception if any symmetry element does not map the
+      * mesh onto itself. May be called again to change the group or
+      * mesh.
+      *
+      * \param group  space group, using Bravais basis coordinates
+      * \param mesh  spatial discretization mesh
+      */
+      void setup(SpaceGroup<D> const & group, Mesh<D> const & mesh);
+
+      /**
+      * Replace field values by averages over orbits of grid points.
+      *
+      * \param field  field on the real-space grid (in/out)
+      */
+      void symmetrize(RField<D>& field) const;
+
+      /**
+      * Get the number of distinct orbits of grid points.
+      */
+      int nOrbit() const;
+
+      /**
+      * Get the number of grid points in the mesh.
+      */
+      int meshSize() const;
+
+      /**
+      * Have the orbits been computed?
+      */
+      bool isSetup() const;
+
+   private:
+
+      // Ranks of all grid points, sorted by orbit.
+      DArray<int> points_;
+
+      // Index in points_ of the first point of each orbit (nOrbit_ + 1).
+      DArray<int> orbitBegins_;
+
+      // Number of orbits.
+      int nOrbit_;
+
+      // Number of grid points.
+      int meshSize_;
+
+   };
+
+   // Inline member functions
+
+   template <int D>
+   inline int GridSymmetrizer<D>::nOrbit() const
+   {  return nOrbit_; }
+
+   template <int D>
+   inline int GridSymmetrizer<D>::meshSize() const
+   {  return meshSize_; }
+
+   template <int D>
+   inline bool GridSymmetrizer<D>::isSetup() const
+   {  return (meshSize_ > 0); }
+
+   #ifndef PSPC_GRID_SYMMETRIZER_TPP
+   // Suppress implicit instantiation
+   extern template class GridSymmetrizer<1>;
+   extern template class GridSymmetrizer<2>;
+   extern template class GridSymmetrizer<3>;
+   #endif
+
+}
+}
+#endif
@@ -0,0 +1,147 @@
+#ifndef PSPC_GRID_SYMMETRIZER_TPP
+#define PSPC_GRID_SYMMETRIZER_TPP
+
+/*
+* PSCF++ Package
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "GridSymmetrizer.h"
+
+namespace Pscf {
+namespace Pspc {
+
+   using namespace Util;
+
+   /*
+   * Default constructor.
+   */
+   template <int D>
+   GridSymmetrizer<D>::GridSymmetrizer()
+    : points_(),
+      orbitBegins_(),
+      nOrbit_(0),
+      meshSize_(0)
+   {}
+
+   /*
+   * Destructor.
+   */
+   template <int D>
+   GridSymmetrizer<D>::~GridSymmetrizer()
+   {}
+
+   /*
+   * Compute orbits of grid points.
+   */
+   template <int D>
+   void GridSymmetrizer<D>::setup(SpaceGroup<D> const & group, 
+                                  Mesh<D> const & mesh)
+   {
+      int nPoint = mesh.size();
+      int nElement = group.size();
+      IntVec<D> const & dim = mesh.dimensions();
+
+      if (points_.isAllocated()) {
+         points_.deallocate();
+         orbitBegins_.deallocate();
+      }
+      points_.allocate(nPoint);
+
+      // Image of every grid point under every symmetry element:
+      // Element k maps grid position n to n'[i] = sum_j R(i,j) n[j] 
+      // dim[i]/dim[j] + t[i] dim[i], which must be an integer.
+      DArray<int> images;
+      images.allocate(nPoint*nElement);
+      IntVec<D> n, m;
+      int i, j, k, r, num;
+      for (k = 0; k < nElement; ++k) {
+         SpaceSymmetry<D> const & s = group[k];
+         for (r = 0; r < nPoint; ++r) {
+            n = mesh.position(r);
+            for (i = 0; i < D; ++i) {
+               m[i] = 0;
+               for (j = 0; j < D; ++j) {
+                  num = s.R(i, j)*n[j]*dim[i];
+                  if (num % dim[j] != 0) {
+                     UTIL_THROW("Mesh is incompatible with space group");
+                  }
+                  m[i] += num/dim[j];
+               }
+               num = s.t(i).num()*dim[i];
+               if (num % s.t(i).den() != 0) {
+                  UTIL_THROW("Mesh is incompatible with space group");
+               }
+               m[i] += num/s.t(i).den();
+            }
+            mesh.shift(m);
+            images[k*nPoint + r] = mesh.rank(m);
+         }
+      }
+
+      // Collect orbits. The orbit of a point is the set of its images,
+      // because the group is closed under multiplication.
+      DArray<int> orbitIds;
+      orbitIds.allocate(nPoint);
+      for (r = 0; r < nPoint; ++r) {
+         orbitIds[r] = -1;
+      }
+      DArray<int> begins;
+      begins.allocate(nPoint + 1);
+      int nStored = 0;
+      int image;
+      nOrbit_ = 0;
+      for (r = 0; r < nPoint; ++r) {
+         if (orbitIds[r] >= 0) continue;
+         begins[nOrbit_] = nStored;
+         for (k = 0; k < nElement; ++k) {
+            image = images[k*nPoint + r];
+            if (orbitIds[image] < 0) {
+               orbitIds[image] = nOrbit_;
+               points_[nStored] = image;
+               ++nStored;
+            }
+         }
+         ++nOrbit_;
+      }
+      UTIL_CHECK(nStored == nPoint);
+      begins[nOrbit_] = nPoint;
+
+      orbitBegins_.allocate(nOrbit_ + 1);
+      for (i = 0; i <= nOrbit_; ++i) {
+         orbitBegins_[i] = begins[i];
+      }
+      meshSize_ = nPoint;
+   }
+
+   /*
+   * Replace field values by averages over orbits.
+   */
+   template <int D>
+   void GridSymmetrizer<D>::symmetrize(RField<D>& field) const
+   {
+      UTIL_CHECK(isSetup());
+      UTIL_CHECK(field.capacity() == meshSize_);
+
+      #ifdef PSCF_OPENMP
+      #pragma omp parallel for
+      #endif
+      for (int i = 0; i < nOrbit_; ++i) {
+         int begin = orbitBegins_[i];
+         int end = orbitBegins_[i+1];
+         double sum = 0.0;
+         for (int j = begin; j < end; ++j) {
+            sum += field[points_[j]];
+         }
+         sum /= double(end - begin);
+         for (int j = begin; j < end; ++j) {
+            field[points_[j]] = sum;
+         }
+      }
+   }
+
+}
+}
+#endif
@@ -3,6 +3,9 @@ pspc_field_= \
   pspc/field/RField.cpp \
   pspc/field/RFieldDft.cpp \
   pspc/field/FFT.cpp \
+  pspc/field/FFTBatched.cpp \
+  pspc/field/FCT.cpp \
+  pspc/field/GridSymmetrizer.cpp \
   pspc/field/FieldIo.cpp 
 
 pspc_field_SRCS=\
@@ -10,14 +10,14 @@
 
 #include <pspc/iterator/Iterator.h> // base class
 #include <pspc/solvers/Mixture.h>
-#include <pscf/math/LuSolver.h>
+#include <pscf/math/GramMatrix.h>
 #include <util/containers/DArray.h>
 #include <util/containers/FArray.h>
 #include <util/containers/FSArray.h>
-#include <util/containers/DMatrix.h>
 #include <util/containers/RingBuffer.h>
 //#include <pspc/iterator/RingBuffer.h>
 #include <pspc/field/RField.h>
+#include <pspc/field/GridSymmetrizer.h>
 
 
 namespace Pscf {
@@ -29,6 +29,18 @@ namespace Pspc
    /**
    * Anderson mixing iterator for the pseudo spectral method.
    *
+   * By default, histories of fields and residuals are stored and mixed
+   * as components in the symmetry-adapted basis, which requires a 
+   * conversion between the basis and the real-space grid for every 
+   * field in every iteration. If the optional parameter useBasis is 0,
+   * the iterator instead works directly with field values on the 
+   * real-space grid, and converts fields to the basis only once after
+   * convergence. The spatial average of each w field is then held 
+   * fixed, as is the coefficient of the homogeneous star in the basis
+   * mode. If the optional parameter symmetrize is also 1, every new
+   * w field is projected onto the space group by averaging over orbits
+   * of equivalent grid points (see GridSymmetrizer).
+   *
    * \ingroup Pspc_Iterator_Module
    */
    template <int D>
@@ -83,6 +95,35 @@ namespace Pspc
       */
       int maxItr();
 
+      /**
+      * Get the number of iterations used by the most recent solve().
+      *
+      * Equal to maxItr() if the last call to solve() failed.
+      */
+      int nIteration();
+
+      /**
+      * Is the unit cell adjusted during iteration (flexible cell)?
+      */
+      bool isFlexible();
+
+      /**
+      * Are fields mixed as components in the symmetry-adapted basis?
+      *
+      * If false, fields are mixed as values on the real-space grid.
+      */
+      bool useBasis();
+
+      /**
+      * Does the iterator preserve the space group symmetry of w fields?
+      *
+      * True if fields are mixed in the symmetry-adapted basis, or on
+      * the real-space grid with symmetrize enabled. If false, the 
+      * basis format w and c fields of the System are only updated 
+      * after convergence if the solution has the space group symmetry.
+      */
+      bool isSymmetric();
+
       /**
       * Compute the deviation of wFields from a mean field solution
       */
@@ -96,7 +137,7 @@ namespace Pspc
       bool isConverged();
 
       /**
-      * Determine the coefficients that would minimize invertMatrix_ Umn
+      * Determine the coefficients that minimize the mixed deviation.
       */
       void minimizeCoeff(int itr);
 
@@ -113,6 +154,15 @@ namespace Pspc
       /// Flexible cell computation (1) or rigid (0), default value = 0
       bool isFlexible_;
 
+      /// Mix basis components (1, default) or r-grid values (0)
+      bool useBasis_;
+
+      /// Project r-grid w fields onto the space group (default 0)
+      bool symmetrize_;
+
+      /// Orbits of grid points, used in r-grid mode
+      GridSymmetrizer<D> symmetrizer_;
+
       /// Free parameter for minimization
       double lambda_;
 
@@ -125,6 +175,9 @@ namespace Pspc
       /// Maximum number of iterations to attempt.
       int maxItr_;
 
+      /// Number of iterations used by the most recent solve().
+      int nIteration_;
+
       // Work Array for iterating on parameters 
       FSArray<double, 6> parameters;
 
@@ -142,14 +195,12 @@ namespace Pspc
 
       RingBuffer< FSArray<double, 6> > CpHists_;
 
-      /// Umn, matrix to be minimized
-      DMatrix<double> invertMatrix_;
+      /// Inner products of deviation histories, updated incrementally
+      GramMatrix histMat_;
 
       /// Cn, coefficient to convolute previous histories with
       DArray<double> coeffs_;
 
-      DArray<double> vM_;
-
       /// bigW, blended omega fields
       DArray<DArray <double> > wArrays_;
 
@@ -164,6 +215,39 @@ namespace Pspc
 
       DArray< DArray<double> > tempDev;
 
+      /// Work space for copies of r-grid w fields (r-grid mode only)
+      DArray< DArray<double> > tempW_;
+
+      /**
+      * Number of mixed components of each field.
+      *
+      * Equal to nStar - 1 in basis mode, or the mesh size otherwise.
+      */
+      int nElement();
+
+      /**
+      * Copy new mixed components from wArrays_ into the w fields.
+      *
+      * In r-grid mode, also symmetrizes the w fields if requested.
+      */
+      void storeWFields();
+
+      /**
+      * Do the r-grid w fields have the symmetry of the space group?
+      *
+      * Used in r-grid mode without symmetrize, in which the converged 
+      * w fields may have lower symmetry than the space group.
+      */
+      bool hasGroupSymmetry();
+
+      /**
+      * Compute inner product of deviation histories i and j.
+      *
+      * \param i index of first history (0 = current)
+      * \param j index of second history (0 = current)
+      */
+      double computeInnerProduct(int i, int j);
+
       using Iterator<D>::setClassName;
       using Iterator<D>::systemPtr_;
       using Iterator<D>::system;
@@ -188,6 +272,22 @@ namespace Pspc
    inline int AmIterator<D>::maxItr()
    { return maxItr_; }
 
+   template<int D>
+   inline int AmIterator<D>::nIteration()
+   { return nIteration_; }
+
+   template<int D>
+   inline bool AmIterator<D>::isFlexible()
+   { return isFlexible_; }
+
+   template<int D>
+   inline bool AmIterator<D>::useBasis()
+   { return useBasis_; }
+
+   template<int D>
+   inline bool AmIterator<D>::isSymmetric()
+   { return (useBasis_ || symmetrize_); }
+
    #ifndef PSPC_AM_ITERATOR_TPP
    // Suppress implicit instantiation
    extern template class AmIterator<1>;
@@ -29,9 +29,13 @@ namespace Pspc
    AmIterator<D>::AmIterator(System<D>* system)
     : Iterator<D>(system),
       epsilon_(0),
+      isFlexible_(false),
+      useBasis_(true),
+      symmetrize_(false),
       lambda_(0),
       nHist_(0),
-      maxHist_(0)
+      maxHist_(0),
+      nIteration_(0)
    {  setClassName("AmIterator"); }
 
    /*
@@ -52,7 +56,13 @@ namespace Pspc
       read(in, "epsilon", epsilon_);
       read(in, "maxHist", maxHist_);
       readOptional(in, "isFlexible", isFlexible_);
-  }
+      useBasis_ = true; // default value (mix basis components)
+      readOptional(in, "useBasis", useBasis_);
+      symmetrize_ = false;
+      if (!useBasis_) {
+         readOptional(in, "symmetrize", symmetrize_);
+      }
+   }
 
    /*
    * Allocate memory required by iterator.
@@ -68,16 +78,45 @@ namespace Pspc
          CpHists_.allocate(maxHist_+1);
       }
 
+      // Arrays used to compute mixing coefficients, allocated once
+      histMat_.allocate(maxHist_+1);
+      if (maxHist_ > 0) {
+         coeffs_.allocate(maxHist_);
+      }
+
       int nMonomer = systemPtr_->mixture().nMonomer();
       wArrays_.allocate(nMonomer);
       dArrays_.allocate(nMonomer);
       tempDev.allocate(nMonomer);
 
-      int nStar = systemPtr_->basis().nStar();
+      int n = nElement();
       for (int i = 0; i < nMonomer; ++i) {
-         wArrays_[i].allocate(nStar - 1);
-         dArrays_[i].allocate(nStar - 1);
-         tempDev[i].allocate(nStar - 1);
+         wArrays_[i].allocate(n);
+         dArrays_[i].allocate(n);
+         tempDev[i].allocate(n);
+      }
+
+      if (!useBasis_) {
+         tempW_.allocate(nMonomer);
+         for (int i = 0; i < nMonomer; ++i) {
+            tempW_[i].allocate(n);
+         }
+         SpaceGroup<D> group;
+         readGroup(system().groupName(), group);
+         symmetrizer_.setup(group, system().mesh());
+      }
+   }
+
+   /*
+   * Number of mixed components of each field.
+   */
+   template <int D>
+   int AmIterator<D>::nElement()
+   {
+      if (useBasis_) {
+         return systemPtr_->basis().nStar() - 1;
+      } else {
+         return systemPtr_->mesh().size();
       }
    }
 
@@ -102,6 +141,16 @@ namespace Pspc
 
       FieldIo<D>& fieldIo = system().fieldIo();
 
+      // Discard inner products of histories from any previous solution
+      histMat_.clear();
+
+      // Project initial r-grid w fields onto the space group
+      if (!useBasis_ && symmetrize_) {
+         for (int i = 0; i < system().mixture().nMonomer(); ++i) {
+            symmetrizer_.symmetrize(system().wFieldRGrid(i));
+         }
+      }
+
       #if 0
       // Convert from Basis to RGrid
       convertTimer.start();
@@ -119,11 +168,13 @@ namespace Pspc
       solverTimer.stop(now);
 
       // Convert c fields from RGrid to Basis
-      convertTimer.start(now);
-      fieldIo.convertRGridToBasis(system().cFieldsRGrid(),
-                                  system().cFields());
-      now = Timer::now();
-      convertTimer.stop(now);
+      if (useBasis_) {
+         convertTimer.start(now);
+         fieldIo.convertRGridToBasis(system().cFieldsRGrid(),
+                                     system().cFields());
+         now = Timer::now();
+         convertTimer.stop(now);
+      }
 
       // Compute initial stress if needed
       if (isFlexible_) {
@@ -155,9 +206,29 @@ namespace Pspc
 
          if (done) {
 
-            updateTimer.stop();
+            now = Timer::now();
+            updateTimer.stop(now);
             Log::file() << "----------CONVERGED----------"<< std::endl;
 
+            // In r-grid mode, convert the solution to basis format once.
+            // This is skipped if the solution has lower symmetry than 
+            // the space group, which the basis cannot represent.
+            if (!useBasis_) {
+               if (symmetrize_ || hasGroupSymmetry()) {
+                  convertTimer.start(now);
+                  fieldIo.convertRGridToBasis(system().wFieldsRGrid(),
+                                              system().wFields());
+                  fieldIo.convertRGridToBasis(system().cFieldsRGrid(),
+                                              system().cFields());
+                  now = Timer::now();
+                  convertTimer.stop(now);
+               } else {
+                  Log::file() << "W fields have lower symmetry than the "
+                              << "space group: basis fields not updated"
+                              << std::endl;
+               }
+            }
+
             // Output timing results
             double updateTime = updateTimer.time();
             double convertTime = convertTimer.time();
@@ -195,36 +266,25 @@ namespace Pspc
             }
 
             // Successful completion (i.e., converged within tolerance)
+            nIteration_ = itr;
             return 0;
 
          } else {
 
-            if (itr <= maxHist_ + 1) {
-               if (nHist_ > 0) {
-                  invertMatrix_.allocate(nHist_, nHist_);
-                  coeffs_.allocate(nHist_);
-                  vM_.allocate(nHist_);
-               }
-            }
             minimizeCoeff(itr);
             buildOmega(itr);
 
-            if (itr <= maxHist_) {
-               if (nHist_ > 0) {
-                  invertMatrix_.deallocate();
-                  coeffs_.deallocate();
-                  vM_.deallocate();
-               }
-            }
             now = Timer::now();
             updateTimer.stop(now);
 
             // Convert wFields from Basis to RGrid
-            convertTimer.start(now);
-            fieldIo.convertBasisToRGrid(system().wFields(),
-                                        system().wFieldsRGrid());
-            now = Timer::now();
-            convertTimer.stop(now);
+            if (useBasis_) {
+               convertTimer.start(now);
+               fieldIo.convertBasisToRGrid(system().wFields(),
+                                           system().wFieldsRGrid());
+               now = Timer::now();
+               convertTimer.stop(now);
+            }
 
             // Solve MDE
             solverTimer.start(now);
@@ -242,67 +302,84 @@ namespace Pspc
             }
 
             // Transform computed cFields from RGrid to Basis
-            convertTimer.start(now);
-            fieldIo.convertRGridToBasis(system().cFieldsRGrid(),
-                                        system().cFields());
-            now = Timer::now();
-            convertTimer.stop(now);
+            if (useBasis_) {
+               convertTimer.start(now);
+               fieldIo.convertRGridToBasis(system().cFieldsRGrid(),
+                                           system().cFields());
+               now = Timer::now();
+               convertTimer.stop(now);
+            }
 
          }
 
       }
 
       // Failure: iteration counter itr reached maxItr without converging
+      nIteration_ = maxItr_;
       return 1;
    }
 
    template <int D>
    void AmIterator<D>::computeDeviation()
    {
+      int nMonomer = systemPtr_->mixture().nMonomer();
+      int n = nElement();
 
-      omHists_.append(systemPtr_->wFields());
+      if (useBasis_) {
+         omHists_.append(systemPtr_->wFields());
+      } else {
+         for (int i = 0; i < nMonomer; ++i) {
+            RField<D> const & w = systemPtr_->wFieldRGrid(i);
+            for (int k = 0; k < n; ++k) {
+               tempW_[i][k] = w[k];
+            }
+         }
+         omHists_.append(tempW_);
+      }
 
       if (isFlexible_)
          //CpHists_.append((systemPtr_->unitCell()).params());
          CpHists_.append((systemPtr_->unitCell()).parameters());
 
-      for (int i = 0 ; i < systemPtr_->mixture().nMonomer(); ++i) {
-         for (int j = 0; j < systemPtr_->basis().nStar() - 1; ++j) {
+      for (int i = 0 ; i < nMonomer; ++i) {
+         for (int j = 0; j < n; ++j) {
             tempDev[i][j] = 0;
          }
       }
 
-      DArray<double> temp;
-      temp.allocate(systemPtr_->basis().nStar() - 1);
-
-      #if 0
-      for (int i = 0; i < systemPtr_->mixture().nMonomer(); ++i) {
-
-         for (int j = 0; j < systemPtr_->basis().nStar() - 1; ++j) {
-            temp[j] = 0;
-         }
-
-         for (int j = 0; j < systemPtr_->mixture().nMonomer(); ++j) {
-            for (int k = 0; k < systemPtr_->basis().nStar() - 1; ++k) {
-               tempDev[i][k] += systemPtr_->interaction().chi(i,j) *
-                              systemPtr_->cField(j)[k + 1];
-               temp[k] += systemPtr_->wField(j)[k + 1];
+      ChiInteraction& interaction = systemPtr_->interaction();
+      if (useBasis_) {
+         for (int i = 0; i < nMonomer; ++i) {
+            for (int j = 0; j < nMonomer; ++j) {
+               DArray<double> const & c = systemPtr_->cField(j);
+               DArray<double> const & w = systemPtr_->wField(j);
+               double chi = interaction.chi(i,j);
+               double idemp = interaction.idemp(i,j);
+               for (int k = 0; k < n; ++k) {
+                  tempDev[i][k] += chi*c[k + 1] - idemp*w[k + 1];
+               }
             }
          }
-
-         for (int k = 0; k < systemPtr_->basis().nStar() - 1; ++k) {
-            tempDev[i][k] += ((temp[k] / systemPtr_->mixture().nMonomer())
-                             - systemPtr_->wField(i)[k + 1]);
-         }
-      }
-      #endif
-
-      for (int i = 0; i < systemPtr_->mixture().nMonomer(); ++i) {
-
-         for (int j = 0; j < systemPtr_->mixture().nMonomer(); ++j) {
-            for (int k = 0; k < systemPtr_->basis().nStar() - 1; ++k) {
-               tempDev[i][k] +=( (systemPtr_->interaction().chi(i,j)*systemPtr_->cField(j)[k + 1])
-                               - (systemPtr_->interaction().idemp(i,j)*systemPtr_->wField(j)[k + 1]) );
+      } else {
+         for (int i = 0; i < nMonomer; ++i) {
+            for (int j = 0; j < nMonomer; ++j) {
+               RField<D> const & c = systemPtr_->cFieldRGrid(j);
+               RField<D> const & w = systemPtr_->wFieldRGrid(j);
+               double chi = interaction.chi(i,j);
+               double idemp = interaction.idemp(i,j);
+               for (int k = 0; k < n; ++k) {
+                  tempDev[i][k] += chi*c[k] - idemp*w[k];
+               }
+            }
+            // Remove spatial average, which is not mixed (analogous 
+            // to omission of the homogeneous star in basis mode)
+            double average = 0.0;
+            for (int k = 0; k < n; ++k) {
+               average += tempDev[i][k];
+            }
+            average /= double(n);
+            for (int k = 0; k < n; ++k) {
+               tempDev[i][k] -= average;
             }
          }
       }
@@ -351,8 +428,9 @@ namespace Pspc
       // Error by Max Residuals
       double temp1 = 0;
       double temp2 = 0;
+      int n = nElement();
       for ( int i = 0; i < systemPtr_->mixture().nMonomer(); i++) {
-         for ( int j = 0; j < systemPtr_->basis().nStar() - 1; j++) {
+         for ( int j = 0; j < n; j++) {
             if (temp1 < fabs (devHists_[0][i][j]))
                 temp1 = fabs (devHists_[0][i][j]);
          }
@@ -393,68 +471,54 @@ namespace Pspc
       }
    }
 
+   /*
+   * Compute inner product of deviation histories i and j.
+   */
+   template <int D>
+   double AmIterator<D>::computeInnerProduct(int i, int j)
+   {
+      int nMonomer = systemPtr_->mixture().nMonomer();
+      int n = nElement();
+      double product = 0.0;
+      double elm;
+      for (int k = 0; k < nMonomer; ++k) {
+         DArray<double> const & di = devHists_[i][k];
+         DArray<double> const & dj = devHists_[j][k];
+         elm = 0.0;
+         for (int l = 0; l < n; ++l) {
+            elm += di[l]*dj[l];
+         }
+         product += elm;
+      }
+      if (!useBasis_) {
+         // Spatial average, equal to the sum over basis components
+         product /= double(n);
+      }
+      if (isFlexible_) {
+         int nParameter = systemPtr_->unitCell().nParameter();
+         for (int m = 0; m < nParameter ; ++m) {
+            product += devCpHists_[i][m]*devCpHists_[j][m];
+         }
+      }
+      return product;
+   }
+
    template <int D>
    void AmIterator<D>::minimizeCoeff(int itr)
    {
-      if (itr == 1) {
+      // Add the newest deviation to the history of inner products.
+      // Only inner products of the newest deviation are computed; all 
+      // others are retained from previous iterations.
+      histMat_.advance();
+      UTIL_CHECK(histMat_.size() == nHist_ + 1);
+      for (int k = 0; k < histMat_.size(); ++k) {
+         histMat_.set(k, computeInnerProduct(0, k));
+      }
+
+      if (itr == 1 || nHist_ == 0) {
          //do nothing
       } else {
-
-         int nMonomer = systemPtr_->mixture().nMonomer();
-         int nParameter = systemPtr_->unitCell().nParameter();
-         int nStar = systemPtr_->basis().nStar();
-         double elm, elm_cp;
-
-         for (int i = 0; i < nHist_; ++i) {
-            for (int j = i; j < nHist_; ++j) {
-
-               invertMatrix_(i,j) = 0;
-               for (int k = 0; k < nMonomer; ++k) {
-                  elm = 0;
-                  for (int l = 0; l < nStar - 1; ++l) {
-                     elm +=
-                            ((devHists_[0][k][l] - devHists_[i+1][k][l])*
-                             (devHists_[0][k][l] - devHists_[j+1][k][l]));
-                  }
-                  invertMatrix_(i,j) += elm;
-               }
-
-               if (isFlexible_){
-                  elm_cp = 0;
-                  for (int m = 0; m < nParameter ; ++m){
-                     elm_cp += ((devCpHists_[0][m] - devCpHists_[i+1][m])*
-                                (devCpHists_[0][m] - devCpHists_[j+1][m]));
-                  }
-                  invertMatrix_(i,j) += elm_cp;
-               }
-               invertMatrix_(j,i) = invertMatrix_(i,j);
-            }
-
-            vM_[i] = 0;
-            for (int j = 0; j < nMonomer; ++j) {
-               for (int k = 0; k < nStar - 1; ++k) {
-                  vM_[i] += ( (devHists_[0][j][k] - devHists_[i+1][j][k]) *
-                               devHists_[0][j][k] );
-               }
-            }
-
-            if (isFlexible_){
-               elm_cp = 0;
-               for (int m = 0; m < nParameter ; ++m){
-                  vM_[i] += ((devCpHists_[0][m] - devCpHists_[i+1][m]) *
-                             (devCpHists_[0][m]));
-               }
-            }
-         }
-
-         if (itr == 2) {
-            coeffs_[0] = vM_[0] / invertMatrix_(0,0);
-         } else {
-            LuSolver solver;
-            solver.allocate(nHist_);
-            solver.computeLU(invertMatrix_);
-            solver.solve(vM_, coeffs_);
-         }
+         histMat_.computeCoefficients(coeffs_);
       }
    }
 
@@ -463,16 +527,24 @@ namespace Pspc
    {
       UnitCell<D>& unitCell = systemPtr_->unitCell();
       Mixture<D>&  mixture = systemPtr_->mixture();
+      int nMonomer = mixture.nMonomer();
+      int n = nElement();
+
+      // Offset of mixed components in w fields: Star 0 is omitted in
+      // basis mode, but all grid points are mixed in r-grid mode.
+      int shift = useBasis_ ? 1 : 0;
 
       if (itr == 1) {
-         for (int i = 0; i < mixture.nMonomer(); ++i) {
-            for (int j = 0; j < systemPtr_->basis().nStar() - 1; ++j) {
-               systemPtr_->wField(i)[j+1]
-                      = omHists_[0][i][j+1] + lambda_*devHists_[0][i][j];
+         for (int i = 0; i < nMonomer; ++i) {
+            for (int j = 0; j < n; ++j) {
+               wArrays_[i][j] = omHists_[0][i][j+shift] 
+                              + lambda_*devHists_[0][i][j];
             }
          }
+         storeWFields();
 
          if (isFlexible_){
+            parameters.clear();
             for (int m = 0; m < unitCell.nParameter() ; ++m){
                parameters.append(CpHists_[0][m]
                               + lambda_* devCpHists_[0][m]);
@@ -485,28 +557,28 @@ namespace Pspc
          }
 
       } else {
-         for (int j = 0; j < mixture.nMonomer(); ++j) {
-            for (int k = 0; k < systemPtr_->basis().nStar() - 1; ++k) {
-               wArrays_[j][k] = omHists_[0][j][k + 1];
+         for (int j = 0; j < nMonomer; ++j) {
+            for (int k = 0; k < n; ++k) {
+               wArrays_[j][k] = omHists_[0][j][k + shift];
                dArrays_[j][k] = devHists_[0][j][k];
             }
          }
          for (int i = 0; i < nHist_; ++i) {
-            for (int j = 0; j < mixture.nMonomer(); ++j) {
-               for (int k = 0; k < systemPtr_->basis().nStar() - 1; ++k) {
-                  wArrays_[j][k] += coeffs_[i] * ( omHists_[i+1][j][k+1] -
-                                                   omHists_[0][j][k+1] );
+            for (int j = 0; j < nMonomer; ++j) {
+               for (int k = 0; k < n; ++k) {
+                  wArrays_[j][k] += coeffs_[i] * ( omHists_[i+1][j][k+shift] -
+                                                   omHists_[0][j][k+shift] );
                   dArrays_[j][k] += coeffs_[i] * ( devHists_[i+1][j][k] -
                                                    devHists_[0][j][k] );
                }
             }
          }
-         for (int i = 0; i < mixture.nMonomer(); ++i) {
-            for (int j = 0; j < systemPtr_->basis().nStar() - 1; ++j) {
-              systemPtr_->wField(i)[j+1] = wArrays_[i][j]
-                                         + lambda_ * dArrays_[i][j];
+         for (int i = 0; i < nMonomer; ++i) {
+            for (int j = 0; j < n; ++j) {
+               wArrays_[i][j] += lambda_ * dArrays_[i][j];
             }
          }
+         storeWFields();
          if (isFlexible_){
             for (int m = 0; m < unitCell.nParameter() ; ++m){
                wCpArrays_[m] = CpHists_[0][m];
@@ -526,7 +598,61 @@ namespace Pspc
             unitCell.setParameters(parameters);
             unitCell.setLattice();
             mixture.setupUnitCell(unitCell);
-	    systemPtr_->basis().update();
+            systemPtr_->basis().update();
+         }
+      }
+   }
+
+   /*
+   * Do the r-grid w fields have the symmetry of the space group?
+   */
+   template <int D>
+   bool AmIterator<D>::hasGroupSymmetry()
+   {
+      UTIL_CHECK(symmetrizer_.isSetup());
+      int nMonomer = systemPtr_->mixture().nMonomer();
+      int n = systemPtr_->mesh().size();
+      RField<D> w;
+      w.allocate(systemPtr_->mesh().dimensions());
+      for (int i = 0; i < nMonomer; ++i) {
+         RField<D> const & wField = systemPtr_->wFieldRGrid(i);
+         for (int j = 0; j < n; ++j) {
+            w[j] = wField[j];
+         }
+         symmetrizer_.symmetrize(w);
+         for (int j = 0; j < n; ++j) {
+            if (std::abs(w[j] - wField[j]) > 1.0E-8) {
+               return false;
+            }
+         }
+      }
+      return true;
+   }
+
+   /*
+   * Copy mixed components in wArrays_ into the system w fields.
+   */
+   template <int D>
+   void AmIterator<D>::storeWFields()
+   {
+      int nMonomer = systemPtr_->mixture().nMonomer();
+      int n = nElement();
+      if (useBasis_) {
+         for (int i = 0; i < nMonomer; ++i) {
+            DArray<double>& w = systemPtr_->wField(i);
+            for (int j = 0; j < n; ++j) {
+               w[j+1] = wArrays_[i][j];
+            }
+         }
+      } else {
+         for (int i = 0; i < nMonomer; ++i) {
+            RField<D>& w = systemPtr_->wFieldRGrid(i);
+            for (int j = 0; j < n; ++j) {
+               w[j] = wArrays_[i][j];
+            }
+            if (symmetrize_) {
+               symmetrizer_.symmetrize(w);
+            }
          }
       }
    }
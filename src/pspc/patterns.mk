@@ -25,8 +25,16 @@ LIBS+=$(GSL_LIB)
 
 # Add paths to FFTW Fast Fourier transform library
 INCLUDES+=$(FFTW_INC)
+ifdef PSCF_OPENMP
+LIBS+=$(FFTW_THREADS_LIB)
+endif
 LIBS+=$(FFTW_LIB) 
 
+# Add OpenMP runtime library, if threading is enabled
+ifdef PSCF_OPENMP
+LIBS+=$(OPENMP_FLAGS)
+endif
+
 # List of all preprocessor macro definitions needed in src/pspc
 # Variables $(PSPC_DEFS) etc are initialized in namespace config.mk files
 DEFINES=$(UTIL_DEFS) $(PSCF_DEFS) $(PSPC_DEFS) 
@@ -9,14 +9,19 @@
 */
 
 #include "Propagator.h"                   // base class argument
+#include "WaveList.h"                     // argument
 #include <pscf/solvers/BlockTmpl.h>       // base class template
 #include <pscf/mesh/Mesh.h>               // member
 #include <pscf/crystal/UnitCell.h>        // member
 #include <pspc/field/RField.h>            // member
 #include <pspc/field/RFieldDft.h>         // member
 #include <pspc/field/FFT.h>               // member
+#include <pspc/field/FFTBatched.h>        // member
+#include <pspc/field/FCT.h>               // member
+#include <util/containers/DArray.h>       // member template
 #include <util/containers/FArray.h>       // member template
 #include <util/containers/DMatrix.h>      // member template
+#include <util/containers/GArray.h>       // member template
 
 namespace Pscf { 
    template <int D> class Mesh; 
@@ -57,6 +62,11 @@ namespace Pspc {
       */
       typedef typename Propagator<D>::QField QField;
 
+      /**
+      * Monomer concentration field.
+      */
+      typedef typename Propagator<D>::CField CField;
+
       // Member functions
 
       /**
@@ -72,20 +82,72 @@ namespace Pspc {
       /**
       * Initialize discretization and allocate required memory.
       *
+      * If checkpointInterval = k > 1, propagator(0) only stores q-fields
+      * for every k-th contour step, and q-fields between checkpoints are
+      * recomputed as needed by computeConcentration and computeStress.
+      * This reduces the memory required for propagator(0) by a factor
+      * of roughly k, at the cost of additional MDE steps.
+      *
+      * If isSinglePrecision is true, q-fields of both propagators are
+      * stored in single precision, while the MDE is solved and integrals
+      * are accumulated in double precision.
+      *
       * \param ds desired (optimal) value for contour length step
       * \param mesh spatial discretization mesh
+      * \param checkpointInterval interval between stored steps
+      * \param isSinglePrecision store q-fields in single precision?
+      */
+      void setDiscretization(double ds, const Mesh<D>& mesh, 
+                             int checkpointInterval = 1,
+                             bool isSinglePrecision = false);
+
+      /**
+      * Set block length and readjust the contour step size.
+      *
+      * After setDiscretization has been called, the number of contour
+      * steps ns() is kept fixed, and ds() is set to length/(ns() - 1).
+      * The Boltzmann factor tables depend on ds, and so setupUnitCell
+      * must be called again before the next call to setupSolver. 
+      *
+      * \param length new block length
+      */
+      virtual void setLength(double length);
+
+      /**
+      * Choose whether step() uses cosine transforms.
+      *
+      * If cosine is true, the pseudo-spectral step is computed with 
+      * type-I discrete cosine transforms of q and w fields restricted 
+      * to the even mesh of points with 0 <= x[i] <= N[i]/2 (see FCT<D>),
+      * rather than with real-to-complex FFTs of the full fields. This
+      * gives the same result, with about 2^D times less FFT work and 
+      * k-space storage, if and only if all w fields are even in each 
+      * Bravais coordinate separately, and requires an even number of 
+      * grid points in each direction. This must be called before
+      * setDiscretization. The default is false.
+      *
+      * \param cosine use cosine transforms?
+      */
+      void setCosineTransform(bool cosine);
+
+      /**
+      * Does step() use cosine transforms?
       */
-      void setDiscretization(double ds, const Mesh<D>& mesh);
+      bool hasCosineTransform() const;
 
       /**
       * Setup parameters that depend on the unit cell.
       *
       * This should be called once after every change in unit cell
-      * parameters.
+      * parameters, after waveList.computeKSq(unitCell). The WaveList 
+      * must have been allocated for the mesh of this block, and is 
+      * retained by address for use in computeStress.
       *
       * \param unitCell unit cell, defining cell dimensions
+      * \param waveList wavevector list, with up to date |G|^2 values
       */
-      void setupUnitCell(const UnitCell<D>& unitCell);
+      void setupUnitCell(UnitCell<D> const & unitCell, 
+                         WaveList<D> const & waveList);
 
       /**
       * Set solver for this block.
@@ -97,6 +159,44 @@ namespace Pspc {
       */
       void setupSolver(WField const & w);
 
+      /**
+      * Use the Boltzmann factor tables of another block.
+      *
+      * After this is called, this block uses the tables of exp(-W ds/2)
+      * and exp(-K^2 b^2 ds/6) computed by the owner block, and frees its
+      * own. The functions setupUnitCell and setupSolver then do not 
+      * recompute these tables, and so must be called for the owner 
+      * block first. This must be called after setDiscretization, and 
+      * requires that canShareTables(owner) is true.
+      *
+      * \param owner block that owns the tables to be used
+      */
+      void shareTables(Block<D> const & owner);
+
+      /**
+      * Can this block use the Boltzmann factor tables of another block?
+      *
+      * Returns true if the other block owns its tables, and has the same
+      * mesh, monomer type, statistical segment length and step size ds,
+      * and uses the same type of transform in step().
+      *
+      * \param other another block
+      */
+      bool canShareTables(Block<D> const & other) const;
+
+      /**
+      * Allocate and use Boltzmann factor tables owned by this block.
+      *
+      * This reverses the effect of shareTables. It does nothing if this
+      * block already owns its tables.
+      */
+      void ownTables();
+
+      /**
+      * Does this block own its Boltzmann factor tables?
+      */
+      bool ownsTables() const;
+
       /**
       * Compute one step of solution of MDE, from i to i+1.
       *
@@ -125,12 +225,39 @@ namespace Pspc {
       */ 
       void computeConcentration(double prefactor);
 
+      /**
+      * Add prefactor times the block concentration integral to a field.
+      *
+      * Identical to computeConcentration(prefactor), except that the
+      * integral is added to an existing field c, such as the total
+      * concentration of the monomer type of this block, rather than 
+      * stored in cField(). The cField() array is not modified.
+      *
+      * The integral is evaluated in tiles of grid points: For each tile,
+      * products of q-fields are accumulated for all contour steps that
+      * are available in memory (all steps, or all steps of one segment
+      * between checkpoints) before moving on. Tiles are distributed 
+      * among OpenMP threads.
+      *
+      * \param prefactor constant multiplying integral
+      * \param c field to which the result is added (incremented)
+      */ 
+      void accumulateConcentration(double prefactor, CField& c);
+
       /** 
       * Compute stress contribution for this block.
       *
       * This function is called by Polymer<D>::computeStress. The
       * prefactor parameter should be the same as that passed to 
       * function computeConcentration.   
+      *
+      * For each contour step, q-fields of both propagators are Fourier
+      * transformed as one batch, and the weighted product of the 
+      * transforms is added to a single k-space integrand. Derivatives 
+      * of |G|^2 with respect to all unit cell parameters are applied
+      * to this integrand in one pass at the end. These derivatives are
+      * obtained from the associated WaveList, which must be up to date
+      * (i.e., waveList.hasdKSq() must be true).
       *   
       * \param prefactor constant multiplying integral
       */  
@@ -169,7 +296,6 @@ namespace Pspc {
       using BlockDescriptor::setId;
       using BlockDescriptor::setVertexIds;
       using BlockDescriptor::setMonomerId;
-      using BlockDescriptor::setLength;
       using BlockDescriptor::id;
       using BlockDescriptor::monomerId;
       using BlockDescriptor::vertexIds;
@@ -178,13 +304,160 @@ namespace Pspc {
 
    private:
 
-      /// Matrix to store derivatives of plane waves 
-      DMatrix<double> dGsq_;
+      /// Simpson's rule integral of products of q-field transforms.
+      Pspc::Field<double> kProduct_;
 
       /**
-      * Compute dGsq_.
+      * Apply an operation to the q-fields for every contour step.
+      *
+      * For each j = 0, ..., ns - 1, this calls op(j, q0, q1), where q0
+      * is the q-field of propagator(0) at step j and q1 is the q-field
+      * of propagator(1) at step ns - 1 - j. Each of these may be a 
+      * QField or a single precision Field<float>. Q-fields between 
+      * checkpoints of propagator(0) are recomputed as needed.
+      *
+      * Fields passed to op remain valid until op.flush() is called. 
+      * This is done at the end, and before each q-field segment is 
+      * recomputed when propagator(0) is checkpointed.
+      *
+      * \param op  functor with a templated operator (int, F0, F1)
+      *            and a flush() function
       */
-      void computedGsq();
+      template <class Op>
+      void forEachStep(Op& op);
+
+      /**
+      * Call op(j, q0, q1) with the q-field q1 of propagator(1).
+      *
+      * \param op  functor
+      * \param j  contour step index for propagator(0)
+      * \param q0  q-field of propagator(0) at step j
+      */
+      template <class Op, class F0>
+      void applyStep(Op& op, int j, F0 const & q0);
+
+      /**
+      * Add contour step j to the list of steps in slices_.
+      *
+      * \param j  contour step index for propagator(0)
+      * \param q0  q-field of propagator(0) at step j
+      * \param q1  q-field of propagator(1) at step ns - 1 - j
+      * \param scale  factor multiplying the Simpson's rule weight
+      */
+      template <class F0, class F1>
+      void addSlice(int j, F0 const & q0, F1 const & q1, double scale);
+
+      /**
+      * Get pointer to the data of a double precision field.
+      */
+      static void getData(Pspc::Field<double> const & q, 
+                          double const * & data, 
+                          float const * & dataFloat);
+
+      /**
+      * Get pointer to the data of a single precision field.
+      */
+      static void getData(Pspc::Field<float> const & q, 
+                          double const * & data, 
+                          float const * & dataFloat);
+
+      /**
+      * Add weighted products for all steps in slices_ to c, and clear.
+      *
+      * \param c  concentration field (incremented)
+      */
+      void integrateSlices(CField& c);
+
+      /**
+      * Add weight*q0[i]*q1[i] to c[i] for begin <= i < end.
+      */
+      template <typename T0, typename T1>
+      static 
+      void addProducts(double* c, T0 const * q0, T1 const * q1, 
+                       double weight, int begin, int end);
+
+      /**
+      * Add contribution of contour step j to kProduct_.
+      *
+      * \param j  contour step index for propagator(0)
+      * \param q0  q-field of propagator(0) at step j
+      * \param q1  q-field of propagator(1) at step ns - 1 - j
+      */
+      template <class F0, class F1>
+      void incrementStress(int j, F0 const & q0, F1 const & q1);
+
+      /**
+      * Functor that gathers steps for a concentration integral.
+      */
+      class ConcentrationOp
+      {
+      public:
+
+         ConcentrationOp(Block<D>& block, CField& c, double scale)
+          : blockPtr_(&block),
+            cPtr_(&c),
+            scale_(scale)
+         {}
+
+         template <class F0, class F1>
+         void operator () (int j, F0 const & q0, F1 const & q1)
+         {  blockPtr_->addSlice(j, q0, q1, scale_); }
+
+         void flush()
+         {  blockPtr_->integrateSlices(*cPtr_); }
+
+      private:
+
+         Block<D>* blockPtr_;
+
+         CField* cPtr_;
+
+         double scale_;
+
+      };
+
+      /**
+      * Functor that calls incrementStress.
+      */
+      class StressOp
+      {
+      public:
+
+         StressOp(Block<D>& block)
+          : blockPtr_(&block)
+         {}
+
+         template <class F0, class F1>
+         void operator () (int j, F0 const & q0, F1 const & q1)
+         {  blockPtr_->incrementStress(j, q0, q1); }
+
+         void flush()
+         {}
+
+      private:
+
+         Block<D>* blockPtr_;
+
+      };
+
+      /**
+      * Pointers to the q-fields for one contour step, and a weight.
+      *
+      * Only one of q0 and q0Float is non-null, depending on whether
+      * the q-field of propagator(0) is stored in double or single 
+      * precision, and similarly for q1 and q1Float.
+      */
+      struct Slice
+      {
+         double const * q0;
+         float const * q0Float;
+         double const * q1;
+         float const * q1Float;
+         double weight;
+      };
+
+      /// Contour steps gathered for a concentration integral.
+      GArray<Slice> slices_;
 
       /// Stress arising from this block
       FSArray<double, 6> stress_;
@@ -192,20 +465,30 @@ namespace Pspc {
       // Fourier transform plan
       FFT<D> fft_;
 
-      // Array of elements containing exp(-K^2 b^2 ds/6)
+      // Batched Fourier transform plan for two fields
+      FFTBatched<D> fftBatched_;
+
+      // Array of elements containing exp(-K^2 b^2 ds/6)/N, where N is
+      // the number of grid points (includes FFT normalization).
       RField<D> expKsq_;
 
       // Array of elements containing exp(-W[i] ds/2)
       RField<D> expW_;
 
-      // Array of elements containing exp(-K^2 b^2 ds/(6*2))
+      // Array of elements containing exp(-K^2 b^2 ds/(6*2))/N
       RField<D> expKsq2_;
 
       // Array of elements containing exp(-W[i] (ds/2)*0.5)
       RField<D> expW2_;
 
-      // Work array for real-space field.
-      RField<D> qf_;
+      // Array of exp(-K^2 b^2 ds/6)/N on the even k-space mesh.
+      Pspc::Field<double> expKsqEven_;
+
+      // Array of exp(-K^2 b^2 ds/(6*2))/N on the even k-space mesh.
+      Pspc::Field<double> expKsq2Even_;
+
+      /// Block that owns the Boltzmann factor tables used by this block.
+      Block<D> const * tablesPtr_;
 
       // Work array for real-space field.
       RField<D> qr_;
@@ -219,12 +502,48 @@ namespace Pspc {
       // Work array for wavevector space field.
       RFieldDft<D> qk2_;
 
+      // Contiguous work array for a batch of two real-space fields.
+      Pspc::Field<double> qrBatch_;
+
+      // Contiguous work array for a batch of two wavevector space fields.
+      Pspc::Field<fftw_complex> qkBatch_;
+
+      // Cosine transform plan for a batch of two fields.
+      FCT<D> fctBatch_;
+
+      // Cosine transform plan for one field.
+      FCT<D> fct_;
+
+      // Contiguous work array for two fields on the even r-space mesh.
+      Pspc::Field<double> qeBatch_;
+
+      // Contiguous work array for two fields on the even k-space mesh.
+      Pspc::Field<double> qkeBatch_;
+
+      // Work array for a field on the even r-space mesh.
+      Pspc::Field<double> qe2_;
+
+      // Work array for a field on the even k-space mesh.
+      Pspc::Field<double> qke2_;
+
+      // Rank in the full r-space mesh of each point of the even mesh.
+      DArray<int> evenRanks_;
+
+      // Rank in the r2c k-space mesh of each point of the even mesh.
+      DArray<int> evenKRanks_;
+
+      // Rank in the even mesh of the image of each full mesh point.
+      DArray<int> foldRanks_;
+
       /// Pointer to associated Mesh<D> object.
       Mesh<D> const* meshPtr_;
 
       /// Pointer to associated UnitCell<D>
       UnitCell<D> const* unitCellPtr_;
 
+      /// Pointer to associated WaveList<D>
+      WaveList<D> const* waveListPtr_;
+
       /// Dimensions of wavevector mesh in real-to-complex transform
       IntVec<D> kMeshDimensions_;
 
@@ -234,6 +553,22 @@ namespace Pspc {
       /// Number of contour length steps = # grid points - 1.
       int ns_;
 
+      /// Does step() use cosine transforms?
+      bool hasCosineTransform_;
+
+      /**
+      * Compute one step of solution of MDE using cosine transforms.
+      *
+      * \param q  input value of QField, from step i
+      * \param qNew  ouput value of QField, from step i+1
+      */
+      void stepCosine(QField const& q, QField& qNew);
+
+      /**
+      * Make maps between the full mesh and the even mesh.
+      */
+      void makeEvenMaps();
+
       /** 
       * Access associated UnitCell<D> as reference.
       */  
@@ -258,6 +593,16 @@ namespace Pspc {
    inline double Block<D>::stress(int n) const
    {  return stress_[n]; }
 
+   /// Does step() use cosine transforms?
+   template <int D>
+   inline bool Block<D>::hasCosineTransform() const
+   {  return hasCosineTransform_; }
+
+   /// Does this block own its Boltzmann factor tables?
+   template <int D>
+   inline bool Block<D>::ownsTables() const
+   {  return tablesPtr_ == this; }
+
    /// Get Mesh by reference.
    template <int D>
    inline Mesh<D> const & Block<D>::mesh() const
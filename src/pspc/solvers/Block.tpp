@@ -18,6 +18,9 @@
 #include <util/containers/DArray.h>      
 #include <util/containers/FArray.h>      
 #include <util/containers/FSArray.h>
+#include <util/containers/GArray.h>
+
+#include <cmath>
 
 namespace Pscf { 
 namespace Pspc {
@@ -29,10 +32,14 @@ namespace Pspc {
    */
    template <int D>
    Block<D>::Block()
-    : meshPtr_(0),
+    : tablesPtr_(0),
+      meshPtr_(0),
+      unitCellPtr_(0),
+      waveListPtr_(0),
       kMeshDimensions_(0),
       ds_(0.0),
-      ns_(0)
+      ns_(0),
+      hasCosineTransform_(false)
    {
       propagator(0).setBlock(*this);
       propagator(1).setBlock(*this);
@@ -45,8 +52,17 @@ namespace Pspc {
    Block<D>::~Block()
    {}
 
+   /*
+   * Choose whether step() uses cosine transforms.
+   */
    template <int D>
-   void Block<D>::setDiscretization(double ds, const Mesh<D>& mesh)
+   void Block<D>::setCosineTransform(bool cosine)
+   {  hasCosineTransform_ = cosine; }
+
+   template <int D>
+   void Block<D>::setDiscretization(double ds, const Mesh<D>& mesh,
+                                    int checkpointInterval,
+                                    bool isSinglePrecision)
    {  
       UTIL_CHECK(mesh.size() > 1);
       UTIL_CHECK(ds > 0.0);
@@ -92,18 +108,54 @@ namespace Pspc {
       expW_.allocate(mesh.dimensions());
       expKsq2_.allocate(kMeshDimensions_);
       expW2_.allocate(mesh.dimensions());
-      qr_.allocate(mesh.dimensions());
-      qk_.allocate(mesh.dimensions());
-      qr2_.allocate(mesh.dimensions());
-      qk2_.allocate(mesh.dimensions());
-      qf_.allocate(mesh.dimensions());
+      tablesPtr_ = this;
+      qrBatch_.allocate(2*mesh.size());
+      qkBatch_.allocate(2*kSize_);
+
+      // Create FFT plans here, because FFTW planning is not thread-safe
+      // and propagators of different blocks may be solved concurrently.
+      // The batched r2c plan is also used by computeStress.
+      fftBatched_.setup(mesh.dimensions(), 2);
+      if (hasCosineTransform_) {
+         UTIL_CHECK(FCT<D>::isValidMesh(mesh.dimensions()));
+         fctBatch_.setup(mesh.dimensions(), 2);
+         fct_.setup(mesh.dimensions(), 1);
+         int ne = fct_.evenSize();
+         expKsqEven_.allocate(ne);
+         expKsq2Even_.allocate(ne);
+         qeBatch_.allocate(2*ne);
+         qkeBatch_.allocate(2*ne);
+         qe2_.allocate(ne);
+         qke2_.allocate(ne);
+         makeEvenMaps();
+      } else {
+         qr_.allocate(mesh.dimensions());
+         qk_.allocate(mesh.dimensions());
+         qr2_.allocate(mesh.dimensions());
+         qk2_.allocate(mesh.dimensions());
+         fft_.setup(qr_, qk_);
+      }
 
-      dGsq_.allocate(kSize_, 6);
+      kProduct_.allocate(kSize_);
 
-      propagator(0).allocate(ns_, mesh);
-      propagator(1).allocate(ns_, mesh);
+      propagator(0).allocate(ns_, mesh, checkpointInterval, 
+                             isSinglePrecision);
+      propagator(1).allocate(ns_, mesh, 1, isSinglePrecision);
       cField().allocate(mesh.dimensions());
 
+      slices_.reserve(ns_);
+   }
+
+   /*
+   * Set block length, keeping the number of contour steps fixed.
+   */
+   template <int D>
+   void Block<D>::setLength(double length)
+   {
+      BlockDescriptor::setLength(length);
+      if (ns_ > 1) {
+         ds_ = length/double(ns_ - 1);
+      }
    }
 
    /*
@@ -111,33 +163,46 @@ namespace Pspc {
    */
    template <int D>
    void 
-   Block<D>::setupUnitCell(const UnitCell<D>& unitCell)
+   Block<D>::setupUnitCell(UnitCell<D> const & unitCell, 
+                           WaveList<D> const & waveList)
    {
+      int nk = kProduct_.capacity();
+      UTIL_CHECK(waveList.hasKSq());
+      UTIL_CHECK(waveList.kSize() == nk);
 
-      // Set association to unitCell
+      // Set associations to unitCell and waveList
       unitCellPtr_ = &unitCell;
-
-      MeshIterator<D> iter;
-      // std::cout << "kDimensions = " << kMeshDimensions_ << std::endl;
-      iter.setDimensions(kMeshDimensions_);
-      IntVec<D> G, Gmin;
-      double Gsq;
-      double factor = -1.0*kuhn()*kuhn()*ds_/6.0;
-      // std::cout << "factor      = " << factor << std::endl;
+      waveListPtr_ = &waveList;
+
+      // Shared tables are computed by their owner
+      if (!ownsTables()) return;
+
+      // Normalization of the forward FFT is folded into expKsq_ and 
+      // expKsq2_, so that step() can use unnormalized transforms.
+      // Only exp(-K^2 b^2 ds/12) is evaluated, and squared.
+      double const * kSq = &(waveList.kSq()[0]);
+      double* e1 = expKsq_.cField();
+      double* e2 = expKsq2_.cField();
+      double factor = -0.5*kuhn()*kuhn()*ds_/6.0;
+      double scale = 1.0/double(mesh().size());
       int i;
-      for (iter.begin(); !iter.atEnd(); ++iter) {
-         i = iter.rank(); 
-         G = iter.position();
-         Gmin = shiftToMinimum(G, mesh().dimensions(), unitCell);
-         Gsq = unitCell.ksq(Gmin);
-         expKsq_[i] = exp(Gsq*factor);
-         expKsq2_[i] = exp(Gsq*factor*0.5);
-         //std::cout << i    << "  " 
-         //         << Gmin << "  " 
-         //          << Gsq  << "  "
-         //          << expKsq_[i] << std::endl;
+      #ifdef PSCF_OPENMP
+      #pragma omp simd
+      #endif
+      for (i = 0; i < nk; ++i) {
+         double e = exp(kSq[i]*factor);
+         e2[i] = e*scale;
+         e1[i] = e*e*scale;
       }
 
+      // Copy values for wavevectors of the even k-space mesh
+      if (hasCosineTransform_) {
+         int ne = expKsqEven_.capacity();
+         for (i = 0; i < ne; ++i) {
+            expKsqEven_[i] = e1[evenKRanks_[i]];
+            expKsq2Even_[i] = e2[evenKRanks_[i]];
+         }
+      }
    }
       
    /*
@@ -151,15 +216,24 @@ namespace Pspc {
       int nx = mesh().size();
       UTIL_CHECK(nx > 0);
       
-      // Populate expW_
+      UTIL_CHECK(w.capacity() == nx);
+
+      // Shared tables are computed by their owner
+      if (!ownsTables()) return;
+      
+      // Populate expW_ and expW2_. Only exp(-W ds/4) is evaluated.
+      double const * wData = w.cField();
+      double* e1 = expW_.cField();
+      double* e2 = expW2_.cField();
+      double factor = -0.5*0.5*ds_;
       int i;
-      // std::cout << std::endl;
+      #ifdef PSCF_OPENMP
+      #pragma omp simd
+      #endif
       for (i = 0; i < nx; ++i) {
-         expW_[i] = exp(-0.5*w[i]*ds_);
-         expW2_[i] = exp(-0.5*0.5*w[i]*ds_);
-         // std::cout << "i = " << i 
-         //           << " expW_[i] = " << expW_[i]
-         //          << std::endl;
+         double e = exp(factor*wData[i]);
+         e2[i] = e;
+         e1[i] = e*e;
       }
 
       #if 0
@@ -187,6 +261,62 @@ namespace Pspc {
       
    }
 
+   /*
+   * Use the Boltzmann factor tables of another block.
+   */
+   template <int D>
+   void Block<D>::shareTables(Block<D> const & owner)
+   {
+      UTIL_CHECK(&owner != this);
+      UTIL_CHECK(canShareTables(owner));
+      if (ownsTables()) {
+         expKsq_.deallocate();
+         expW_.deallocate();
+         expKsq2_.deallocate();
+         expW2_.deallocate();
+         if (expKsqEven_.isAllocated()) {
+            expKsqEven_.deallocate();
+            expKsq2Even_.deallocate();
+         }
+      }
+      tablesPtr_ = &owner;
+   }
+
+   /*
+   * Allocate and use tables owned by this block.
+   */
+   template <int D>
+   void Block<D>::ownTables()
+   {
+      if (ownsTables()) return;
+      UTIL_CHECK(meshPtr_);
+      expKsq_.allocate(kMeshDimensions_);
+      expW_.allocate(mesh().dimensions());
+      expKsq2_.allocate(kMeshDimensions_);
+      expW2_.allocate(mesh().dimensions());
+      if (hasCosineTransform_) {
+         int ne = fct_.evenSize();
+         expKsqEven_.allocate(ne);
+         expKsq2Even_.allocate(ne);
+      }
+      tablesPtr_ = this;
+   }
+
+   /*
+   * Can this block use the Boltzmann factor tables of another block?
+   */
+   template <int D>
+   bool Block<D>::canShareTables(Block<D> const & other) const
+   {
+      if (!other.ownsTables()) return false;
+      if (other.meshPtr_ != meshPtr_) return false;
+      if (other.monomerId() != monomerId()) return false;
+      if (other.kuhn() != kuhn()) return false;
+      if (other.hasCosineTransform_ != hasCosineTransform_) return false;
+      if (std::abs(other.ds_ - ds_) > 1.0E-12*ds_) return false;
+      return true;
+   }
+
    /*
    * Integrate to calculate monomer concentration for this block
    */
@@ -203,39 +333,30 @@ namespace Pspc {
       UTIL_CHECK(cField().capacity() == nx) 
 
       // Initialize cField to zero at all points
-      int i;
-      for (i = 0; i < nx; ++i) {
+      for (int i = 0; i < nx; ++i) {
          cField()[i] = 0.0;
       }
 
-      Propagator<D> const & p0 = propagator(0);
-      Propagator<D> const & p1 = propagator(1);
-
-      // Evaluate unnormalized integral
-      for(i = 0; i < nx; ++i) {
-         cField()[i] += p0.q(0)[i]*p1.q(ns_ - 1)[i];
-         cField()[i] += p0.q(ns_ -1)[i]*p1.q(0)[i];
-      }
-
-      //odd indices
-      for(int j = 1; j < (ns_ -1); j += 2) {
-         for(int i = 0; i < nx; ++i) {
-            cField()[i] += p0.q(j)[i] * p1.q(ns_ - 1 - j)[i] * 4.0;   
-         }
-      }
-
-      //even indices
-      for(int j = 2; j < (ns_ -2); j += 2) {
-         for(int i = 0; i < nx; ++i) {
-            cField()[i] += p0.q(j)[i] * p1.q(ns_ - 1 - j)[i] * 2.0;   
-         }
-      }
+      accumulateConcentration(prefactor, cField());
+   }
 
-      prefactor *= ds_ / 3.0;
-      for (i = 0; i < nx; ++i) {
-         cField()[i] *= prefactor;
-      }
+   /*
+   * Add block concentration, times prefactor, to field c.
+   */
+   template <int D>
+   void Block<D>::accumulateConcentration(double prefactor, CField& c)
+   {
+      // Preconditions
+      UTIL_CHECK(mesh().size() > 0);
+      UTIL_CHECK(ns_ > 0);
+      UTIL_CHECK(ds_ > 0);
+      UTIL_CHECK(propagator(0).isAllocated());
+      UTIL_CHECK(propagator(1).isAllocated());
+      UTIL_CHECK(c.capacity() == mesh().size()) 
 
+      // Simpson's rule weights are multiplied by prefactor*ds/3
+      ConcentrationOp op(*this, c, prefactor*ds_/3.0);
+      forEachStep(op);
    }
 
    /*
@@ -249,106 +370,236 @@ namespace Pspc {
       UTIL_CHECK(nx > 0); 
       UTIL_CHECK(ns_ > 0); 
       UTIL_CHECK(ds_ > 0); 
+      UTIL_CHECK(unitCellPtr_);
+      UTIL_CHECK(waveListPtr_);
+      UTIL_CHECK(waveListPtr_->hasdKSq());
       UTIL_CHECK(propagator(0).isAllocated());
       UTIL_CHECK(propagator(1).isAllocated());
 
-      stress_.clear();
-
-      double dels, normal, increment;
-      int r, c, m;
- 
-      normal = 3.0*6.0;
+      // Initialize k-space integrand to zero
+      int nk = kProduct_.capacity();
+      int i, m;
+      for (m = 0; m < nk; ++m) {
+         kProduct_[m] = 0.0;
+      }
 
-      int kSize_ = 1;
-      for (int i = 0; i < D; ++i) {
-           kSize_ *= kMeshDimensions_[i];   
-      }   
-      r = unitCellPtr_->nParameter();
-      c = kSize_;
+      // Evaluate Simpson's rule integral over contour steps
+      StressOp op(*this);
+      forEachStep(op);
 
-      FSArray<double, 6> dQ;
+      // Contract integrand with dKSq for all parameters in one pass
+      DMatrix<double> const & dKSq = waveListPtr_->dKSq();
+      int r = unitCellPtr_->nParameter();
+      FArray<double, 6> dQ;
+      for (i = 0; i < r; ++i) {
+         dQ[i] = 0.0;
+      }
+      double product;
+      for (m = 0; m < nk; ++m) {
+         product = kProduct_[m];
+         for (i = 0; i < r; ++i) {
+            dQ[i] += product*dKSq(m, i);
+         }
+      }
 
-      // Initialize work array and stress_ to zero at all points
-      int i;
+      // Normalize. Unnormalized transforms introduce a factor nx^2.
+      double scale = kuhn()*kuhn()*ds_/(3.0*6.0*double(nx)*double(nx));
+      stress_.clear();
       for (i = 0; i < r; ++i) {
-         dQ.append(0.0);
-         stress_.append(0.0);
-      }   
+         stress_.append(dQ[i]*scale*prefactor);
+      }
+   }
+
+   /*
+   * Apply an operation to the q-fields of both propagators at each step.
+   */
+   template <int D>
+   template <class Op>
+   void Block<D>::forEachStep(Op& op)
+   {
+      Propagator<D>& p0 = propagator(0);
+      if (p0.isCheckpointed()) {
+
+         // Recompute q-fields of propagator(0) one segment at a time
+         int begin, m, n;
+         for (begin = 0; begin < ns_ - 1; begin += n) {
+            n = p0.computeSegment(begin);
+            for (m = 0; m < n; ++m) {
+               applyStep(op, begin + m, p0.segment(m));
+            }
+            op.flush();
+         }
 
-      computedGsq();
+      } else {
+
+         applyStep(op, 0, p0.head());
+         for (int j = 1; j < ns_ - 1; ++j) {
+            if (p0.isSinglePrecision()) {
+               applyStep(op, j, p0.qFloat(j));
+            } else {
+               applyStep(op, j, p0.q(j));
+            }
+         }
+
+      }
+      applyStep(op, ns_ - 1, p0.tail());
+      op.flush();
+   }
 
-      Propagator<D> const & p0 = propagator(0);
+   /*
+   * Apply an operation to q0 and the matching q-field of propagator(1).
+   */
+   template <int D>
+   template <class Op, class F0>
+   void Block<D>::applyStep(Op& op, int j, F0 const & q0)
+   {
       Propagator<D> const & p1 = propagator(1);
+      int k = ns_ - 1 - j;
+      if (k == 0) {
+         op(j, q0, p1.head());
+      } else 
+      if (k == ns_ - 1) {
+         op(j, q0, p1.tail());
+      } else
+      if (p1.isSinglePrecision()) {
+         op(j, q0, p1.qFloat(k));
+      } else {
+         op(j, q0, p1.q(k));
+      }
+   }
 
-      // Evaluate unnormalized integral   
-      for (int j = 0; j < ns_ ; ++j) {
-           
-           qr_ = p0.q(j);
-           fft_.forwardTransform(qr_, qk_);
-           
-           qr2_ = p1.q(ns_ - 1 - j);
-           fft_.forwardTransform(qr2_, qk2_); 
-
-           dels = ds_;
-
-           if (j != 0 && j != ns_ - 1) {
-              if (j % 2 == 0) {
-                 dels = dels*2.0;
-              } else {
-                 dels = dels*4.0;
-              }           
-           }
-
-           for (int n = 0; n < r ; ++n) {
-              increment = 0;
-
-              for (m = 0; m < c ; ++m) {
-                 double prod = 0;
-                 prod = (qk2_[m][0] * qk_[m][0]) + (qk2_[m][1] * qk_[m][1]);
-                 prod *= dGsq_(m,n); 
-                 increment += prod; 
-              }
-              increment = (increment * kuhn() * kuhn() * dels)/normal;
-              dQ [n] = dQ[n]-increment; 
-           }    
-      }   
-      
-      // Normalize
-      for (i = 0; i < r; ++i) {
-         stress_[i] = stress_[i] - (dQ[i] * prefactor);
-      }   
+   /*
+   * Get pointer to the data of a double or single precision field.
+   */
+   template <int D>
+   inline 
+   void Block<D>::getData(Pspc::Field<double> const & q, 
+                          double const * & data, 
+                          float const * & dataFloat)
+   {
+      data = q.cField();
+      dataFloat = 0;
+   }
 
+   template <int D>
+   inline 
+   void Block<D>::getData(Pspc::Field<float> const & q, 
+                          double const * & data, 
+                          float const * & dataFloat)
+   {
+      data = 0;
+      dataFloat = q.cField();
    }
 
-   /*  
-   * Compute dGsq_
-   */  
+   /*
+   * Add one contour step to the list used for a concentration integral.
+   */
    template <int D>
-   void Block<D>::computedGsq()
+   template <class F0, class F1>
+   void Block<D>::addSlice(int j, F0 const & q0, F1 const & q1, 
+                           double scale)
    {
-      IntVec<D> temp;
-      IntVec<D> vec;
-      IntVec<D> Partner;
-      MeshIterator<D> iter;
-      iter.setDimensions(kMeshDimensions_);
+      Slice slice;
+      getData(q0, slice.q0, slice.q0Float);
+      getData(q1, slice.q1, slice.q1Float);
+      slice.weight = scale;
+      if (j != 0 && j != ns_ - 1) {
+         slice.weight *= (j % 2 == 0) ? 2.0 : 4.0;
+      }
+      slices_.append(slice);
+   }
 
-      for (int n = 0; n < unitCellPtr_->nParameter() ; ++n) {
-         for (iter.begin(); !iter.atEnd(); ++iter) {
-            temp = iter.position();
-            vec = shiftToMinimum(temp, mesh().dimensions(), *unitCellPtr_);
-            dGsq_(iter.rank(), n) = unitCellPtr_->dksq(vec, n);
-            for (int p = 0; p < D; ++p) {
-               if (temp [p] != 0) {
-                  Partner[p] = mesh().dimensions()[p] - temp[p];
+   /*
+   * Add weighted products for all gathered contour steps to c.
+   */
+   template <int D>
+   void Block<D>::integrateSlices(CField& c)
+   {
+      const int nSlice = slices_.size();
+      if (nSlice == 0) return;
+
+      // Grid points are processed in tiles small enough that a tile
+      // of c stays in cache while products for all slices are added.
+      const int nx = mesh().size();
+      const int tileSize = 512;
+      const int nTile = (nx + tileSize - 1)/tileSize;
+      double* cData = c.cField();
+      Slice const * slices = &slices_[0];
+
+      int t;
+      #ifdef PSCF_OPENMP
+      #pragma omp parallel for schedule(static) if (nTile > 1)
+      #endif
+      for (t = 0; t < nTile; ++t) {
+         int begin = t*tileSize;
+         int end = (begin + tileSize < nx) ? begin + tileSize : nx;
+         for (int m = 0; m < nSlice; ++m) {
+            Slice const & s = slices[m];
+            if (s.q0) {
+               if (s.q1) {
+                  addProducts(cData, s.q0, s.q1, s.weight, begin, end);
                } else {
-                  Partner[p] = 0;
+                  addProducts(cData, s.q0, s.q1Float, s.weight, 
+                              begin, end);
+               }
+            } else {
+               if (s.q1) {
+                  addProducts(cData, s.q0Float, s.q1, s.weight, 
+                              begin, end);
+               } else {
+                  addProducts(cData, s.q0Float, s.q1Float, s.weight,
+                              begin, end);
                }
-            }
-            if (Partner[D-1] > kMeshDimensions_[D-1]) {
-               dGsq_(iter.rank(), n) *= 2;
             }
          }
       }
+
+      slices_.clear();
+   }
+
+   /*
+   * Add weighted products of two q-fields within a range of grid points.
+   */
+   template <int D>
+   template <typename T0, typename T1>
+   inline 
+   void Block<D>::addProducts(double* c, T0 const * q0, T1 const * q1, 
+                              double weight, int begin, int end)
+   {
+      #ifdef PSCF_OPENMP
+      #pragma omp simd
+      #endif
+      for (int i = begin; i < end; ++i) {
+         c[i] += weight * double(q0[i]) * double(q1[i]);
+      }
+   }
+
+   /*
+   * Add contribution of one contour step to the stress integrand.
+   */
+   template <int D>
+   template <class F0, class F1>
+   void Block<D>::incrementStress(int j, F0 const & q0, F1 const & q1)
+   {
+      // Transform both q-fields as one batch
+      int nx = mesh().size();
+      int i;
+      for (i = 0; i < nx; ++i) {
+         qrBatch_[i] = double(q0[i]);
+         qrBatch_[nx + i] = double(q1[i]);
+      }
+      fftBatched_.forwardTransformUnscaled(qrBatch_, qkBatch_);
+           
+      double weight = 1.0;
+      if (j != 0 && j != ns_ - 1) {
+         weight = (j % 2 == 0) ? 2.0 : 4.0;
+      }
+
+      int nk = kProduct_.capacity();
+      for (i = 0; i < nk; ++i) {
+         kProduct_[i] += weight*(qkBatch_[i][0]*qkBatch_[nk + i][0] 
+                               + qkBatch_[i][1]*qkBatch_[nk + i][1]);
+      }
    }
 
    /*
@@ -364,45 +615,170 @@ namespace Pspc {
       UTIL_CHECK(qNew.isAllocated());
       UTIL_CHECK(q.capacity() == nx);
       UTIL_CHECK(qNew.capacity() == nx);
+
+      if (hasCosineTransform_) {
+         stepCosine(q, qNew);
+         return;
+      }
       UTIL_CHECK(qr_.capacity() == nx);
-      UTIL_CHECK(expW_.capacity() == nx);
+
+      // Boltzmann factor tables, possibly owned by another block
+      RField<D> const & expW = tablesPtr_->expW_;
+      RField<D> const & expW2 = tablesPtr_->expW2_;
+      RField<D> const & expKsq = tablesPtr_->expKsq_;
+      RField<D> const & expKsq2 = tablesPtr_->expKsq2_;
+      UTIL_CHECK(expW.capacity() == nx);
 
       // Fourier-space mesh sizes
       int nk = qk_.capacity();
-      UTIL_CHECK(expKsq_.capacity() == nk);
+      UTIL_CHECK(expKsq.capacity() == nk);
 
-      // Apply pseudo-spectral algorithm
+      UTIL_CHECK(qrBatch_.capacity() == 2*nx);
+      UTIL_CHECK(qkBatch_.capacity() == 2*nk);
+
+      // Apply pseudo-spectral algorithm, using unnormalized forward 
+      // transforms (1/N is included in expKsq_ and expKsq2_). The full 
+      // step (elements 0 to nx-1 of qrBatch_) and the first of two half
+      // steps (elements nx to 2*nx-1) are transformed as one batch.
+      // Element-wise operations are fused to minimize passes over memory.
       int i;
       for (i = 0; i < nx; ++i) {
-         qr_[i] = q[i]*expW_[i];
-         qr2_[i] = q[i]*expW2_[i];
+         qrBatch_[i] = q[i]*expW[i];
+         qrBatch_[nx + i] = q[i]*expW2[i];
       }
-      fft_.forwardTransform(qr_, qk_);
-      fft_.forwardTransform(qr2_, qk2_);
+      fftBatched_.forwardTransformUnscaled(qrBatch_, qkBatch_);
       for (i = 0; i < nk; ++i) {
-         qk_[i][0] *= expKsq_[i];
-         qk_[i][1] *= expKsq_[i];
-         qk2_[i][0] *= expKsq2_[i];
-         qk2_[i][1] *= expKsq2_[i];
+         qkBatch_[i][0] *= expKsq[i];
+         qkBatch_[i][1] *= expKsq[i];
+         qkBatch_[nk + i][0] *= expKsq2[i];
+         qkBatch_[nk + i][1] *= expKsq2[i];
       }
-      fft_.inverseTransform(qk_, qr_);
-      fft_.inverseTransform(qk2_, qr2_);
+      fftBatched_.inverseTransform(qkBatch_, qrBatch_);
+
+      // Complete full step in place, and second half step input in qr2_
       for (i = 0; i < nx; ++i) {
-         qf_[i] = qr_[i]*expW_[i];
-         qr2_[i] = qr2_[i]*expW_[i];
+         qrBatch_[i] *= expW[i];
+         qr2_[i] = qrBatch_[nx + i]*expW[i];
       }
-
-      fft_.forwardTransform(qr2_, qk2_);
+      fft_.forwardTransformUnscaled(qr2_, qk2_);
       for (i = 0; i < nk; ++i) {
-         qk2_[i][0] *= expKsq2_[i];
-         qk2_[i][1] *= expKsq2_[i];
+         qk2_[i][0] *= expKsq2[i];
+         qk2_[i][1] *= expKsq2[i];
       }
-      fft_.inverseTransform(qk2_, qr2_);
+
+      // Inverse transform directly into qNew, then apply the last 
+      // factor of expW2_ and Richardson extrapolation in one pass.
+      fft_.inverseTransform(qk2_, qNew);
+      const double c = 1.0/3.0;
       for (i = 0; i < nx; ++i) {
-         qr2_[i] = qr2_[i]*expW2_[i];
+         qNew[i] = (4.0*qNew[i]*expW2[i] - qrBatch_[i])*c;
+      }
+   }
+
+   /*
+   * Compute one step of the MDE using cosine transforms.
+   */
+   template <int D>
+   void Block<D>::stepCosine(const QField& q, QField& qNew)
+   {
+      int nx = mesh().size();
+      int ne = fct_.evenSize();
+      UTIL_CHECK(qeBatch_.capacity() == 2*ne);
+      UTIL_CHECK(foldRanks_.capacity() == nx);
+
+      // Boltzmann factor tables, possibly owned by another block
+      RField<D> const & expW = tablesPtr_->expW_;
+      RField<D> const & expW2 = tablesPtr_->expW2_;
+      Pspc::Field<double> const & expKsq = tablesPtr_->expKsqEven_;
+      Pspc::Field<double> const & expKsq2 = tablesPtr_->expKsq2Even_;
+      UTIL_CHECK(expW.capacity() == nx);
+      UTIL_CHECK(expKsq.capacity() == ne);
+
+      // Same algorithm as step(), applied to values on the even mesh.
+      // The unnormalized cosine transform of these values is equal to 
+      // the unnormalized DFT of the full field, and applying it twice 
+      // multiplies by nx, which is included in expKsq and expKsq2.
+      int i, r;
+      for (i = 0; i < ne; ++i) {
+         r = evenRanks_[i];
+         qeBatch_[i] = q[r]*expW[r];
+         qeBatch_[ne + i] = q[r]*expW2[r];
+      }
+      fctBatch_.forwardTransformUnscaled(qeBatch_, qkeBatch_);
+      for (i = 0; i < ne; ++i) {
+         qkeBatch_[i] *= expKsq[i];
+         qkeBatch_[ne + i] *= expKsq2[i];
+      }
+      fctBatch_.inverseTransform(qkeBatch_, qeBatch_);
+
+      // Complete full step in place, and second half step input in qe2_
+      for (i = 0; i < ne; ++i) {
+         r = evenRanks_[i];
+         qeBatch_[i] *= expW[r];
+         qe2_[i] = qeBatch_[ne + i]*expW[r];
+      }
+      fct_.forwardTransformUnscaled(qe2_, qke2_);
+      for (i = 0; i < ne; ++i) {
+         qke2_[i] *= expKsq2[i];
+      }
+      fct_.inverseTransform(qke2_, qe2_);
+
+      // Apply last factor of expW2 and Richardson extrapolation
+      const double c = 1.0/3.0;
+      for (i = 0; i < ne; ++i) {
+         r = evenRanks_[i];
+         qe2_[i] = (4.0*qe2_[i]*expW2[r] - qeBatch_[i])*c;
       }
+
+      // Expand to the full mesh, using reflection symmetry
       for (i = 0; i < nx; ++i) {
-         qNew[i] = (4.0*qr2_[i] - qf_[i])/3.0;
+         qNew[i] = qe2_[foldRanks_[i]];
+      }
+   }
+
+   /*
+   * Make maps between the full mesh and the even mesh.
+   */
+   template <int D>
+   void Block<D>::makeEvenMaps()
+   {
+      IntVec<D> const & meshDimensions = mesh().dimensions();
+      Mesh<D> evenMesh(fct_.evenDimensions());
+      Mesh<D> kMesh(kMeshDimensions_);
+      int ne = evenMesh.size();
+      int nx = mesh().size();
+      if (evenRanks_.isAllocated()) {
+         evenRanks_.deallocate();
+         evenKRanks_.deallocate();
+         foldRanks_.deallocate();
+      }
+      evenRanks_.allocate(ne);
+      evenKRanks_.allocate(ne);
+      foldRanks_.allocate(nx);
+
+      MeshIterator<D> iter;
+      IntVec<D> position;
+      int i, j;
+
+      // Points of the even mesh, 0 <= x[j] <= N[j]/2
+      iter.setDimensions(evenMesh.dimensions());
+      for (iter.begin(); !iter.atEnd(); ++iter) {
+         i = iter.rank();
+         position = iter.position();
+         evenRanks_[i] = mesh().rank(position);
+         evenKRanks_[i] = kMesh.rank(position);
+      }
+
+      // Image of each point of the full mesh in the even mesh
+      iter.setDimensions(meshDimensions);
+      for (iter.begin(); !iter.atEnd(); ++iter) {
+         position = iter.position();
+         for (j = 0; j < D; ++j) {
+            if (2*position[j] > meshDimensions[j]) {
+               position[j] = meshDimensions[j] - position[j];
+            }
+         }
+         foldRanks_[iter.rank()] = evenMesh.rank(position);
       }
    }
 
@@ -10,6 +10,7 @@
 
 #include "Polymer.h"
 #include "Solvent.h"
+#include "WaveList.h"
 #include <pscf/solvers/MixtureTmpl.h>
 #include <pscf/inter/Interaction.h>
 #include <util/containers/DArray.h>
@@ -90,16 +91,59 @@ namespace Pspc
       * e.g., by reading its parameters from a file, so that the
       * mesh dimensions are known on entry.
       *
+      * Blocks with the same monomer type, statistical segment length
+      * and contour step size are set to share one set of Boltzmann 
+      * factor tables, which is computed once per change in w fields
+      * or unit cell, by the first such block.
+      *
       * \param mesh associated Mesh<D> object (stores address).
       */
       void setMesh(Mesh<D> const & mesh);
 
+      /**
+      * Set the length of one block of one polymer.
+      *
+      * The number of contour steps in the block is unchanged, so its 
+      * step size is changed in proportion to its length. Sharing of
+      * Boltzmann factor tables among blocks is re-established, and the
+      * unit cell is set up again if setupUnitCell was called previously.
+      * This must be called after setMesh.
+      *
+      * \param polymerId index of polymer species
+      * \param blockId index of block within polymer
+      * \param length new block length
+      */
+      void setBlockLength(int polymerId, int blockId, double length);
+
+      /**
+      * Choose whether blocks use cosine transforms to solve the MDE.
+      *
+      * Cosine transforms give correct results only if all w fields are
+      * even in each Bravais coordinate separately, as they are if the
+      * fields have the symmetry of a space group for which 
+      * SpaceGroup<D>::hasAxisReflections() is true. They require an even
+      * number of grid points in each direction. See Block<D>. This must
+      * be called before setMesh. The default is false.
+      *
+      * \param cosine use cosine transforms?
+      */
+      void setCosineTransforms(bool cosine);
+
+      /**
+      * Do blocks use cosine transforms to solve the MDE?
+      */
+      bool hasCosineTransforms() const;
+
       /**
       * Set unit cell parameters used in solver.
       * 
       * This function resets unit cell information in the solvers for 
       * every species in the system. It should be called once after
-      * every change in the unit cell.
+      * every change in the unit cell. 
+      *
+      * Values of |G|^2 for all wavevectors are computed once, in the 
+      * WaveList shared by all blocks. Minimum images of wavevectors 
+      * are identified on the first call after each call to setMesh.
       *
       * \param unitCell UnitCell<D> object that contains Bravais lattice.
       */
@@ -109,12 +153,11 @@ namespace Pspc
       * Compute partition functions and concentrations.
       *
       * This function calls the compute function of every molecular
-      * species, and then adds the resulting block concentration fields
-      * for blocks of the same monomer type to compute a total monomer
-      * concentration (or volume fraction) for each monomer type.
-      * Upon return, values are set for volume fraction and chemical 
-      * potential (mu) members of each species, and for the 
-      * concentration fields for each Block and Solvent. The total
+      * species, which adds the concentration field of each block 
+      * directly to the total concentration (or volume fraction) for 
+      * the monomer type of that block. Upon return, values are set 
+      * for volume fraction and chemical potential (mu) members of 
+      * each species. Block::cField() arrays are not updated. The total
       * concentration for each monomer type is returned in the
       * cFields output parameter. Monomer "concentrations" are returned 
       * in units of inverse steric volume per monomer in an incompressible
@@ -152,6 +195,35 @@ namespace Pspc
       */
       double vMonomer() const;
 
+      /**
+      * Get the list of wavevectors shared by all blocks.
+      */
+      WaveList<D> const & waveList() const;
+
+      /**
+      * Get interval between stored steps of checkpointed propagators.
+      *
+      * Equal to 1 (the default) if all propagator steps are stored.
+      */
+      int checkpointInterval() const;
+
+      /**
+      * Are propagator q-fields stored in single precision?
+      */
+      bool isSinglePrecision() const;
+
+      /**
+      * Write a report of memory used to store propagators.
+      *
+      * Reports the memory allocated for all propagators, relative to 
+      * the value for full double precision storage, and the number of 
+      * extra MDE steps required to recompute q-fields between 
+      * checkpoints. Call after setMesh.
+      *
+      * \param out output stream
+      */
+      void writeStorageReport(std::ostream& out);
+
       // Inherited public member functions with non-dependent names
       using MixtureTmpl< Polymer<D>, Solvent<D> >::nMonomer;
       using MixtureTmpl< Polymer<D>, Solvent<D> >::nPolymer;
@@ -173,9 +245,21 @@ namespace Pspc
       /// Optimal contour length step size.
       double ds_;
 
+      /// Interval between stored steps of propagator(0) of each block.
+      int checkpointInterval_;
+
+      /// Are propagator q-fields stored in single precision?
+      bool isSinglePrecision_;
+
+      /// Do blocks use cosine transforms?
+      bool hasCosineTransforms_;
+
       /// Array to store total stress
       FArray<double, 6> stress_;
 
+      /// Wavevectors, and values of |G|^2, shared by all blocks.
+      WaveList<D> waveList_;
+
       /// Pointer to associated Mesh<D> object.
       Mesh<D> const * meshPtr_;
 
@@ -185,6 +269,9 @@ namespace Pspc
       /// Return associated domain by reference.
       Mesh<D> const & mesh() const;
 
+      /// Set blocks with identical Boltzmann factors to share tables.
+      void shareTables();
+
    };
 
    // Inline member function
@@ -194,6 +281,25 @@ namespace Pspc
    inline double Mixture<D>::vMonomer() const
    {  return vMonomer_; }
 
+   // Get the list of wavevectors shared by all blocks.
+   template <int D>
+   inline WaveList<D> const & Mixture<D>::waveList() const
+   {  return waveList_; }
+
+   // Get interval between stored steps of checkpointed propagators.
+   template <int D>
+   inline int Mixture<D>::checkpointInterval() const
+   {  return checkpointInterval_; }
+
+   // Are propagator q-fields stored in single precision?
+   template <int D>
+   inline bool Mixture<D>::isSinglePrecision() const
+   {  return isSinglePrecision_; }
+
+   template <int D>
+   inline bool Mixture<D>::hasCosineTransforms() const
+   {  return hasCosineTransforms_; }
+
    // Stress with respect to unit cell parameter n.
    template <int D>
    inline double Mixture<D>::stress(int n) const
@@ -12,6 +12,7 @@
 #include <pscf/mesh/Mesh.h>
 
 #include <cmath>
+#include <iomanip>
 
 namespace Pscf {
 namespace Pspc
@@ -21,6 +22,9 @@ namespace Pspc
    Mixture<D>::Mixture()
     : vMonomer_(1.0),
       ds_(-1.0),
+      checkpointInterval_(1),
+      isSinglePrecision_(false),
+      hasCosineTransforms_(false),
       meshPtr_(0),
       unitCellPtr_(0)
    {  setClassName("Mixture"); }
@@ -36,12 +40,24 @@ namespace Pspc
       vMonomer_ = 1.0; // Default value
       readOptional(in, "vMonomer", vMonomer_);
       read(in, "ds", ds_);
+      checkpointInterval_ = 1; // Default value
+      readOptional(in, "checkpointInterval", checkpointInterval_);
+      isSinglePrecision_ = false; // Default value
+      readOptional(in, "singlePrecision", isSinglePrecision_);
 
       UTIL_CHECK(nMonomer() > 0);
       UTIL_CHECK(nPolymer()+ nSolvent() > 0);
       UTIL_CHECK(ds_ > 0);
+      UTIL_CHECK(checkpointInterval_ > 0);
    }
 
+   /*
+   * Choose whether blocks use cosine transforms.
+   */
+   template <int D>
+   void Mixture<D>::setCosineTransforms(bool cosine)
+   {  hasCosineTransforms_ = cosine; }
+
    template <int D>
    void Mixture<D>::setMesh(Mesh<D> const& mesh)
    {
@@ -51,11 +67,72 @@ namespace Pspc
 
       meshPtr_ = &mesh;
 
+      // Allocate wavevector list. Minimum images are computed in
+      // the next call to setupUnitCell.
+      waveList_.allocate(mesh);
+
       // Set discretization for all blocks
       int i, j;
       for (i = 0; i < nPolymer(); ++i) {
          for (j = 0; j < polymer(i).nBlock(); ++j) {
-            polymer(i).block(j).setDiscretization(ds_, mesh);
+            polymer(i).block(j).setCosineTransform(hasCosineTransforms_);
+            polymer(i).block(j).setDiscretization(ds_, mesh, 
+                                                  checkpointInterval_,
+                                                  isSinglePrecision_);
+         }
+      }
+
+      shareTables();
+   }
+
+   /*
+   * Set length of one block, and update Boltzmann factor tables.
+   */
+   template <int D>
+   void Mixture<D>::setBlockLength(int polymerId, int blockId, 
+                                   double length)
+   {
+      UTIL_CHECK(meshPtr_);
+      polymer(polymerId).block(blockId).setLength(length);
+
+      // The step size ds of this block has changed, so table sharing
+      // among blocks must be re-established.
+      int i, j;
+      for (i = 0; i < nPolymer(); ++i) {
+         for (j = 0; j < polymer(i).nBlock(); ++j) {
+            polymer(i).block(j).ownTables();
+         }
+      }
+      shareTables();
+
+      if (unitCellPtr_) {
+         setupUnitCell(*unitCellPtr_);
+      }
+   }
+
+   /*
+   * Blocks with the same monomer type, statistical segment length and 
+   * step size ds share Boltzmann factor tables, which are owned by the 
+   * first such block in order of (polymer, block) index. 
+   */
+   template <int D>
+   void Mixture<D>::shareTables()
+   {
+      int i, j, k, l, nb;
+      bool found;
+      for (i = 0; i < nPolymer(); ++i) {
+         for (j = 0; j < polymer(i).nBlock(); ++j) {
+            Block<D>& block = polymer(i).block(j);
+            found = false;
+            for (k = 0; k <= i && !found; ++k) {
+               nb = (k < i) ? polymer(k).nBlock() : j;
+               for (l = 0; l < nb && !found; ++l) {
+                  if (block.canShareTables(polymer(k).block(l))) {
+                     block.shareTables(polymer(k).block(l));
+                     found = true;
+                  }
+               }
+            }
          }
       }
 
@@ -65,11 +142,20 @@ namespace Pspc
    void Mixture<D>::setupUnitCell(const UnitCell<D>& unitCell)
    {
 
+      UTIL_CHECK(meshPtr_);
+      UTIL_CHECK(waveList_.isAllocated());
+
       // Set association to unitCell
       unitCellPtr_ = &unitCell;
 
+      // Compute |G|^2 for all wavevectors, once for all blocks
+      if (!waveList_.hasMinimumImages()) {
+         waveList_.computeMinimumImages(unitCell);
+      }
+      waveList_.computeKSq(unitCell);
+
       for (int i = 0; i < nPolymer(); ++i) {
-         polymer(i).setupUnitCell(unitCell);
+         polymer(i).setupUnitCell(unitCell, waveList_);
       }
    }
 
@@ -89,7 +175,7 @@ namespace Pspc
 
       int nx = mesh().size();
       int nm = nMonomer();
-      int i, j, k;
+      int i, j;
 
       // Clear all monomer concentration fields
       for (i = 0; i < nm; ++i) {
@@ -100,25 +186,10 @@ namespace Pspc
          }
       }
 
-      // Solve MDE for all polymers
+      // Solve MDE for all polymers, and add block concentrations
+      // to the monomer concentration fields
       for (i = 0; i < nPolymer(); ++i) {
-         polymer(i).compute(wFields);
-      }
-
-      // Accumulate monomer concentration fields
-      double phi;
-      for (i = 0; i < nPolymer(); ++i) {
-         phi = polymer(i).phi();
-         for (j = 0; j < polymer(i).nBlock(); ++j) {
-            int monomerId = polymer(i).block(j).monomerId();
-            UTIL_CHECK(monomerId >= 0);
-            UTIL_CHECK(monomerId < nm);
-            CField& monomerField = cFields[monomerId];
-            CField& blockField = polymer(i).block(j).cField();
-            for (k = 0; k < nx; ++k) {
-               monomerField[k] += phi * blockField[k];
-            }
-         }
+         polymer(i).compute(wFields, cFields);
       }
 
       // To do: Add compute functions and accumulation for solvents.
@@ -137,6 +208,12 @@ namespace Pspc
          stress_[i] = 0.0;
       }
 
+      // Compute derivatives of |G|^2, once per unit cell
+      UTIL_CHECK(unitCellPtr_);
+      if (!waveList_.hasdKSq()) {
+         waveList_.computedKSq(*unitCellPtr_);
+      }
+
       // Compute stress for all polymers, after solving MDE
       for (i = 0; i < nPolymer(); ++i) {
          polymer(i).computeStress();
@@ -150,6 +227,59 @@ namespace Pspc
       }
    }
 
+   /*
+   * Write a report of memory used to store propagators.
+   */
+   template <int D>
+   void Mixture<D>::writeStorageReport(std::ostream& out)
+   {
+      UTIL_CHECK(meshPtr_);
+
+      // Count memory and MDE steps for all blocks
+      double memory = 0.0;     // memory allocated for q-fields
+      double memoryFull = 0.0; // memory for full double precision storage
+      long nStep = 0;          // MDE steps to solve all propagators
+      long nExtra = 0;         // steps recomputed per pass over segments
+      double nx = double(mesh().size());
+      int i, j, k, ns, nSegment;
+      for (i = 0; i < nPolymer(); ++i) {
+         for (j = 0; j < polymer(i).nBlock(); ++j) {
+            Block<D> const & block = polymer(i).block(j);
+            ns = block.ns();
+            memory += block.propagator(0).memory();
+            memory += block.propagator(1).memory();
+            memoryFull += 2.0*double(ns)*nx*sizeof(double);
+            nStep += 2*(ns - 1);
+            if (block.propagator(0).isCheckpointed()) {
+               k = block.propagator(0).checkpointInterval();
+               nSegment = (ns - 2)/k + 1;
+               nExtra += ns - 1 - nSegment;
+            }
+         }
+      }
+      double mb = 1.0/(1024.0*1024.0);
+
+      std::ios_base::fmtflags flags = out.flags();
+      std::streamsize precision = out.precision();
+      out << std::fixed << std::setprecision(1);
+
+      out << std::endl;
+      out << "Propagator storage (checkpointInterval = " 
+          << checkpointInterval_ << ", singlePrecision = " 
+          << isSinglePrecision_ << ")" << std::endl;
+      out << "  memory [MB]           " << memory*mb
+          << "   (full storage " << memoryFull*mb << ")" 
+          << std::endl;
+      out << "  MDE steps per solve   " << nStep << std::endl;
+      out << "  extra MDE steps per concentration or stress evaluation " 
+          << nExtra << "   (" << 100.0*double(nExtra)/double(nStep) 
+          << "%)" << std::endl;
+      out << std::endl;
+
+      out.flags(flags);
+      out.precision(precision);
+   }
+
 } // namespace Pspc
 } // namespace Pscf
 #endif
@@ -44,6 +44,8 @@ namespace Pspc {
 
       typedef typename Block<D>::WField  WField;
 
+      typedef typename Block<D>::CField  CField;
+
       /**
       * Default constructor.
       */
@@ -78,8 +80,10 @@ namespace Pspc {
       * polymer.
       *
       * \param unitCell crystallographic unit cell
+      * \param waveList wavevector list, with up to date |G|^2 values
       */ 
-      void setupUnitCell(UnitCell<D> const & unitCell);
+      void setupUnitCell(UnitCell<D> const & unitCell, 
+                         WaveList<D> const & waveList);
 
       /**
       * Compute solution to MDE and block concentrations.
@@ -96,6 +100,21 @@ namespace Pspc {
       */ 
       void compute(DArray<WField> const & wFields);
 
+      /**
+      * Compute solution to MDE and add concentrations to monomer fields.
+      *
+      * This function solves the MDE for all propagators, as for the
+      * compute(wFields) function, but adds the volume fraction field 
+      * of each block directly to the element of cFields for the 
+      * monomer type of that block, rather than storing it in the 
+      * Block. Block::cField() arrays are not modified. 
+      *
+      * \param wFields array of chemical potential fields (input)
+      * \param cFields array of monomer concentration fields (incremented)
+      */ 
+      void compute(DArray<WField> const & wFields, 
+                   DArray<CField>& cFields);
+
       /**
       * Compute stress from a polymer chain.
       *
@@ -138,6 +157,7 @@ namespace Pspc {
 
       using Base::phi_;
       using Base::mu_;
+      using Base::solvePropagators;
 
    };
 
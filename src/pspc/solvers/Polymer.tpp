@@ -41,13 +41,14 @@ namespace Pspc {
    * Set unit cell dimensions in all solvers.
    */ 
    template <int D>
-   void Polymer<D>::setupUnitCell(UnitCell<D> const & unitCell)
+   void Polymer<D>::setupUnitCell(UnitCell<D> const & unitCell,
+                                  WaveList<D> const & waveList)
    {
       // Set association to unitCell
       unitCellPtr_ = &unitCell;
 
       for (int j = 0; j < nBlock(); ++j) {
-         block(j).setupUnitCell(unitCell);
+         block(j).setupUnitCell(unitCell, waveList);
       }
    }
 
@@ -68,6 +69,31 @@ namespace Pspc {
       solve();
    }
 
+   /*
+   * Compute solution to MDE, and add block concentrations to cFields.
+   */ 
+   template <int D>
+   void Polymer<D>::compute(DArray<WField> const & wFields, 
+                            DArray<CField>& cFields)
+   {
+      // Setup solvers for all blocks
+      int monomerId;
+      for (int j = 0; j < nBlock(); ++j) {
+         monomerId = block(j).monomerId();
+         block(j).setupSolver(wFields[monomerId]);
+      }
+
+      // Solve MDE for all propagators, and compute phi or mu
+      double q = solvePropagators();
+
+      // Accumulate block concentrations into monomer fields
+      double prefactor = phi_ / (q*length());
+      for (int j = 0; j < nBlock(); ++j) {
+         monomerId = block(j).monomerId();
+         block(j).accumulateConcentration(prefactor, cFields[monomerId]);
+      }
+   }
+
    /*
    * Compute stress from a polymer chain.
    */
@@ -10,6 +10,7 @@
 
 #include <pscf/solvers/PropagatorTmpl.h> // base class template
 #include <pspc/field/RField.h>           // member template
+#include <pspc/field/Field.h>            // member template
 #include <util/containers/DArray.h>      // member template
 #include <util/containers/FArray.h>      // member template
 
@@ -76,11 +77,26 @@ namespace Pspc
 
       /**
       * Allocate memory used by this propagator.
+      *
+      * If checkpointInterval == 1 (the default), q-fields for all ns 
+      * contour steps are stored. If checkpointInterval = k > 1, only 
+      * the q-fields for steps that are multiples of k (checkpoints) and 
+      * the tail are stored, plus a work array of k q-fields that is used
+      * to recompute segments between checkpoints by computeSegment.
+      *
+      * If isSinglePrecision is true, stored q-fields are rounded to
+      * single precision (float), and are accessed by qFloat(i) rather
+      * than q(i). The MDE is still solved in double precision, and 
+      * double precision copies of the head and tail are retained.
       * 
       * \param ns number of contour length steps
       * \param mesh spatial discretization mesh
+      * \param checkpointInterval interval between stored steps
+      * \param isSinglePrecision store q-fields in single precision?
       */ 
-      void allocate(int ns, const Mesh<D>& mesh);
+      void allocate(int ns, const Mesh<D>& mesh, 
+                    int checkpointInterval = 1, 
+                    bool isSinglePrecision = false);
 
       /**
       * Solve the modified diffusion equation (MDE) for this block.
@@ -114,13 +130,51 @@ namespace Pspc
       */ 
       double computeQ();
 
+      /**
+      * Recompute q-fields for a segment that begins at a checkpoint.
+      *
+      * Starting from the stored q-field at step begin, which must be a
+      * multiple of checkpointInterval(), this function recomputes the 
+      * q-fields for steps begin, ..., begin + n - 1, with 
+      * n = min(checkpointInterval(), ns - 1 - begin), and stores them
+      * in the array accessed by segment(m), m = 0, ..., n - 1. The 
+      * q-field at step begin + n is stored and is not recomputed. The 
+      * propagator must be solved, and the w-fields and unit cell of the 
+      * block must not have changed since it was solved.
+      *
+      * \param begin index of first step (a checkpoint)
+      * \return number n of q-fields in segment
+      */
+      int computeSegment(int begin);
+
+      /**
+      * Return q-field m of the segment computed by computeSegment.
+      *
+      * \param m step index relative to beginning of segment
+      */
+      const QField& segment(int m) const;
+
       /**
       * Return q-field at specified step.
       *
+      * In checkpointed mode, only q-fields at checkpoints and at the 
+      * tail are stored, and so step i must be one of these steps. 
+      * Not available in single precision mode.
+      *
       * \param i step index
       */
       const QField& q(int i) const;
 
+      /**
+      * Return single precision q-field at specified step.
+      *
+      * Only available in single precision mode. As for q(i), step i 
+      * must be a checkpoint or the tail in checkpointed mode.
+      *
+      * \param i step index
+      */
+      const Pspc::Field<float>& qFloat(int i) const;
+
       /**
       * Return q-field at beginning of block (initial condition).
       */
@@ -141,6 +195,35 @@ namespace Pspc
       */
       bool isAllocated() const;
 
+      /**
+      * Is the q-field for step i stored (rather than recomputed)?
+      *
+      * \param i step index
+      */
+      bool isStored(int i) const;
+
+      /**
+      * Are only q-fields at checkpoints stored (checkpointInterval > 1)?
+      */
+      bool isCheckpointed() const;
+
+      /**
+      * Get interval between steps at which q-fields are stored.
+      */
+      int checkpointInterval() const;
+
+      /**
+      * Are stored q-fields rounded to single precision?
+      */
+      bool isSinglePrecision() const;
+
+      /**
+      * Get memory allocated for q-fields, in bytes.
+      *
+      * Includes stored q-fields and segment work space.
+      */
+      double memory() const;
+
       // Inherited public functions with non-dependent names
 
       using PropagatorTmpl< Propagator<D> >::nSource;
@@ -159,11 +242,16 @@ namespace Pspc
 
    private:
      
-      // Array of statistical weight fields 
+      // Array of stored statistical weight fields. In single precision
+      // mode, only the head and tail are stored here, in that order.
       DArray<QField> qFields_;
 
-      // Workspace
-      QField work_;
+      // Array of stored fields in single precision mode
+      DArray< Pspc::Field<float> > qFloats_;
+
+      // Workspace for recomputed segments in checkpointed mode, and for
+      // intermediate steps in single precision mode.
+      DArray<QField> segment_;
 
       /// Pointer to associated Block.
       Block<D>* blockPtr_;
@@ -174,9 +262,30 @@ namespace Pspc
       /// Number of contour length steps = # grid points - 1.
       int ns_;
 
+      /// Interval between stored steps (1 if all are stored).
+      int checkpointInterval_;
+
+      /// Are stored q-fields rounded to single precision?
+      bool isSinglePrecision_;
+
       /// Is this propagator allocated?
       bool isAllocated_;
 
+      /**
+      * Propagate from the head to the tail, given the head q-field.
+      */
+      void propagate();
+
+      /**
+      * Return index within qFields_ (or qFloats_) of stored step i.
+      */
+      int storageIndex(int i) const;
+
+      /**
+      * Store a copy of the q-field for step i in single precision.
+      */
+      void storeFloat(int i, QField const & q);
+
    };
 
    // Inline member functions
@@ -195,7 +304,20 @@ namespace Pspc
    template <int D>
    inline 
    typename Propagator<D>::QField const& Propagator<D>::tail() const
-   {  return qFields_[ns_-1]; }
+   {  return qFields_[qFields_.capacity()-1]; }
+
+   /*
+   * Return index within qFields_ (or qFloats_) of stored step i.
+   */
+   template <int D>
+   inline 
+   int Propagator<D>::storageIndex(int i) const
+   {
+      if (checkpointInterval_ == 1) return i;
+      if (i == ns_ - 1) return (ns_ - 2)/checkpointInterval_ + 1;
+      UTIL_ASSERT(i % checkpointInterval_ == 0);
+      return i/checkpointInterval_;
+   }
 
    /*
    * Return q-field at specified step.
@@ -203,7 +325,30 @@ namespace Pspc
    template <int D>
    inline 
    typename Propagator<D>::QField const& Propagator<D>::q(int i) const
-   {  return qFields_[i]; }
+   {
+      UTIL_ASSERT(!isSinglePrecision_);
+      return qFields_[storageIndex(i)]; 
+   }
+
+   /*
+   * Return single precision q-field at specified step.
+   */
+   template <int D>
+   inline 
+   Pspc::Field<float> const& Propagator<D>::qFloat(int i) const
+   {
+      UTIL_ASSERT(isSinglePrecision_);
+      return qFloats_[storageIndex(i)]; 
+   }
+
+   /*
+   * Return q-field m of the most recently computed segment.
+   */
+   template <int D>
+   inline 
+   typename Propagator<D>::QField const& 
+   Propagator<D>::segment(int m) const
+   {  return segment_[m]; }
 
    /*
    * Get the associated Block object.
@@ -221,6 +366,29 @@ namespace Pspc
    bool Propagator<D>::isAllocated() const
    {  return isAllocated_; }
 
+   /*
+   * Is the q-field for step i stored?
+   */
+   template <int D>
+   inline 
+   bool Propagator<D>::isStored(int i) const
+   {  return (i % checkpointInterval_ == 0) || (i == ns_ - 1); }
+
+   template <int D>
+   inline 
+   bool Propagator<D>::isCheckpointed() const
+   {  return (checkpointInterval_ > 1); }
+
+   template <int D>
+   inline 
+   int Propagator<D>::checkpointInterval() const
+   {  return checkpointInterval_; }
+
+   template <int D>
+   inline 
+   bool Propagator<D>::isSinglePrecision() const
+   {  return isSinglePrecision_; }
+
    /*
    * Associate this propagator with a block and direction
    */
@@ -26,6 +26,8 @@ namespace Pspc {
     : blockPtr_(0),
       meshPtr_(0),
       ns_(0),
+      checkpointInterval_(1),
+      isSinglePrecision_(false),
       isAllocated_(false)
    {}
 
@@ -36,16 +38,62 @@ namespace Pspc {
    Propagator<D>::~Propagator()
    {}
 
+   /*
+   * Allocate memory for stored q-fields and segment workspace.
+   */
    template <int D>
-   void Propagator<D>::allocate(int ns, const Mesh<D>& mesh)
+   void Propagator<D>::allocate(int ns, const Mesh<D>& mesh,
+                                int checkpointInterval,
+                                bool isSinglePrecision)
    {
+      UTIL_CHECK(ns > 1);
+      UTIL_CHECK(checkpointInterval > 0);
       ns_ = ns;
       meshPtr_ = &mesh;
+      checkpointInterval_ = checkpointInterval;
+      isSinglePrecision_ = isSinglePrecision;
+      if (checkpointInterval_ > ns - 1) {
+         checkpointInterval_ = ns - 1;
+      }
 
-      qFields_.allocate(ns);
-      for (int i = 0; i < ns; ++i) {
+      // Number of stored q-fields: checkpoints 0, k, 2k, ... < ns - 1, 
+      // plus the tail (step ns - 1)
+      int nStored;
+      if (checkpointInterval_ == 1) {
+         nStored = ns;
+      } else {
+         nStored = (ns - 2)/checkpointInterval_ + 2;
+      }
+
+      int i;
+      if (isSinglePrecision_) {
+         qFloats_.allocate(nStored);
+         for (i = 0; i < nStored; ++i) {
+            qFloats_[i].allocate(mesh.size());
+         }
+         qFields_.allocate(2);
+      } else {
+         qFields_.allocate(nStored);
+      }
+      for (i = 0; i < qFields_.capacity(); ++i) {
          qFields_[i].allocate(mesh.dimensions());
       }
+
+      // Segment workspace, with at least two elements if intermediate
+      // double precision steps are not stored in qFields_
+      int nSegment = 0;
+      if (checkpointInterval_ > 1) {
+         nSegment = checkpointInterval_;
+      }
+      if (isSinglePrecision_ && nSegment < 2) {
+         nSegment = 2;
+      }
+      if (nSegment > 0) {
+         segment_.allocate(nSegment);
+         for (i = 0; i < nSegment; ++i) {
+            segment_[i].allocate(mesh.dimensions());
+         }
+      }
       isAllocated_ = true;
    }
 
@@ -86,9 +134,7 @@ namespace Pspc {
    {
       UTIL_CHECK(isAllocated());
       computeHead();
-      for (int iStep = 0; iStep < ns_ - 1; ++iStep) {
-         block().step(qFields_[iStep], qFields_[iStep + 1]);
-      }
+      propagate();
       setIsSolved(true);
    }
 
@@ -108,12 +154,108 @@ namespace Pspc {
       }
 
       // Setup solver and solve
-      for (int iStep = 0; iStep < ns_ - 1; ++iStep) {
-         block().step(qFields_[iStep], qFields_[iStep + 1]);
-      }
+      propagate();
       setIsSolved(true);
    }
 
+   /*
+   * Propagate from head to tail, storing q-fields at checkpoints.
+   */
+   template <int D>
+   void Propagator<D>::propagate()
+   {
+      if (checkpointInterval_ == 1 && !isSinglePrecision_) {
+         for (int iStep = 0; iStep < ns_ - 1; ++iStep) {
+            block().step(qFields_[iStep], qFields_[iStep + 1]);
+         }
+      } else {
+         if (isSinglePrecision_) {
+            storeFloat(0, qFields_[0]);
+         }
+
+         // Steps that are not stored in double precision are written to
+         // segment_[i % n], with n = segment_.capacity(), which never
+         // coincides with the input of the same step.
+         int nSegment = segment_.capacity();
+         QField const * qPtr = &qFields_[0];
+         QField* qNewPtr;
+         for (int i = 1; i < ns_; ++i) {
+            if (i == ns_ - 1) {
+               qNewPtr = &qFields_[qFields_.capacity() - 1];
+            } else
+            if (isStored(i) && !isSinglePrecision_) {
+               qNewPtr = &qFields_[storageIndex(i)];
+            } else {
+               qNewPtr = &segment_[i % nSegment];
+            }
+            block().step(*qPtr, *qNewPtr);
+            if (isSinglePrecision_ && isStored(i)) {
+               storeFloat(i, *qNewPtr);
+            }
+            qPtr = qNewPtr;
+         }
+      }
+   }
+
+   /*
+   * Round a double precision q-field to single precision and store it.
+   */
+   template <int D>
+   void Propagator<D>::storeFloat(int i, QField const & q)
+   {
+      Pspc::Field<float>& qf = qFloats_[storageIndex(i)];
+      int nx = meshPtr_->size();
+      for (int j = 0; j < nx; ++j) {
+         qf[j] = (float) q[j];
+      }
+   }
+
+   /*
+   * Recompute q-fields in a segment, starting from a checkpoint.
+   */
+   template <int D>
+   int Propagator<D>::computeSegment(int begin)
+   {
+      UTIL_CHECK(isSolved());
+      UTIL_CHECK(isCheckpointed());
+      UTIL_CHECK(begin >= 0 && begin < ns_ - 1);
+      UTIL_CHECK(begin % checkpointInterval_ == 0);
+
+      int n = ns_ - 1 - begin;
+      if (n > checkpointInterval_) {
+         n = checkpointInterval_;
+      }
+      if (begin == 0) {
+         segment_[0] = head();
+      } else
+      if (isSinglePrecision_) {
+         Pspc::Field<float> const & qf = qFloats_[storageIndex(begin)];
+         QField& q = segment_[0];
+         int nx = meshPtr_->size();
+         for (int j = 0; j < nx; ++j) {
+            q[j] = (double) qf[j];
+         }
+      } else {
+         segment_[0] = qFields_[storageIndex(begin)];
+      }
+      for (int m = 1; m < n; ++m) {
+         block().step(segment_[m-1], segment_[m]);
+      }
+      return n;
+   }
+
+   /*
+   * Get memory allocated for q-fields, in bytes.
+   */
+   template <int D>
+   double Propagator<D>::memory() const
+   {
+      double nx = (double) meshPtr_->size();
+      double nDouble = qFields_.capacity() + segment_.capacity();
+      double nFloat = qFloats_.capacity();
+      return nx*(nDouble*sizeof(double) + nFloat*sizeof(float));
+   }
+
    /*
    * Integrate to calculate monomer concentration for this block
    */
@@ -0,0 +1,224 @@
+#ifndef PSPC_WAVE_LIST_H
+#define PSPC_WAVE_LIST_H
+
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include <pscf/math/IntVec.h>             // member
+#include <util/containers/DArray.h>       // member
+#include <util/containers/DMatrix.h>      // member
+
+namespace Pscf {
+   template <int D> class Mesh;
+   template <int D> class UnitCell;
+}
+
+namespace Pscf {
+namespace Pspc {
+
+   using namespace Util;
+
+   /**
+   * List of wavevectors on the k-space mesh of a real-to-complex FFT.
+   *
+   * A WaveList stores the minimum image of every wavevector on the
+   * k-space mesh used by FFT<D>, and values of the square magnitude
+   * |G|^2 of each such wavevector and of its derivatives with respect
+   * to unit cell parameters. Minimum images are computed only once for
+   * each mesh, by computeMinimumImages, using the unit cell at the time
+   * of that call. Values of |G|^2 and its derivatives are recomputed
+   * from the stored integer images after each change in unit cell
+   * parameters, by computeKSq and computedKSq.
+   *
+   * A WaveList is owned by a Mixture<D>, and is shared by all Block<D>
+   * objects in that mixture. This is the CPU counterpart of the class
+   * Pspg::WaveList<D>.
+   *
+   * \ingroup Pspc_Solver_Module
+   */
+   template <int D>
+   class WaveList
+   {
+   public:
+
+      /**
+      * Constructor.
+      */
+      WaveList();
+
+      /**
+      * Destructor.
+      */
+      ~WaveList();
+
+      /**
+      * Allocate memory for a mesh, and mark all data as outdated.
+      *
+      * \param mesh spatial discretization mesh (r-space)
+      */
+      void allocate(Mesh<D> const & mesh);
+
+      /**
+      * Compute minimum images of all wavevectors.
+      *
+      * This is done only once for each mesh, because it requires a
+      * search over periodic images of each wavevector.
+      *
+      * \param unitCell unit cell used to identify minimum images
+      */
+      void computeMinimumImages(UnitCell<D> const & unitCell);
+
+      /**
+      * Compute |G|^2 for all wavevectors, for a new unit cell.
+      *
+      * Values of derivatives of |G|^2 are marked as outdated.
+      *
+      * \param unitCell current unit cell
+      */
+      void computeKSq(UnitCell<D> const & unitCell);
+
+      /**
+      * Compute derivatives of |G|^2 with respect to cell parameters.
+      *
+      * \param unitCell current unit cell
+      */
+      void computedKSq(UnitCell<D> const & unitCell);
+
+      /**
+      * Get the minimum image of wavevector i.
+      *
+      * \param i index of wavevector on the k-space mesh
+      */
+      IntVec<D> const & minImage(int i) const;
+
+      /**
+      * Get the array of values of |G|^2, indexed by k-space mesh rank.
+      */
+      DArray<double> const & kSq() const;
+
+      /**
+      * Get derivatives of |G|^2 with respect to unit cell parameters.
+      *
+      * Element (i, n) is the derivative of |G|^2 for wavevector i
+      * with respect to unit cell parameter n. Values are multiplied
+      * by 2 for wavevectors whose partner -G is not on the k-space
+      * mesh, and thus contributes implicitly to sums over that mesh.
+      */
+      DMatrix<double> const & dKSq() const;
+
+      /**
+      * Get the dimensions of the k-space mesh.
+      */
+      IntVec<D> const & kMeshDimensions() const;
+
+      /**
+      * Get the number of points on the k-space mesh.
+      */
+      int kSize() const;
+
+      /**
+      * Has memory been allocated?
+      */
+      bool isAllocated() const;
+
+      /**
+      * Have minimum images been computed for the current mesh?
+      */
+      bool hasMinimumImages() const;
+
+      /**
+      * Are values of |G|^2 up to date?
+      */
+      bool hasKSq() const;
+
+      /**
+      * Are derivatives of |G|^2 up to date?
+      */
+      bool hasdKSq() const;
+
+   private:
+
+      /// Minimum images of wavevectors, indexed by k-space mesh rank.
+      DArray< IntVec<D> > minImages_;
+
+      /// Does the partner -G of each wavevector lie outside the k-mesh?
+      DArray<bool> hasImplicitPartner_;
+
+      /// Values of |G|^2.
+      DArray<double> kSq_;
+
+      /// Derivatives of |G|^2 with respect to unit cell parameters.
+      DMatrix<double> dKSq_;
+
+      /// Dimensions of the r-space mesh.
+      IntVec<D> meshDimensions_;
+
+      /// Dimensions of the k-space mesh.
+      IntVec<D> kMeshDimensions_;
+
+      /// Number of points on the k-space mesh.
+      int kSize_;
+
+      /// Have minimum images been computed?
+      bool hasMinimumImages_;
+
+      /// Are values of kSq_ up to date?
+      bool hasKSq_;
+
+      /// Are values of dKSq_ up to date?
+      bool hasdKSq_;
+
+   };
+
+   // Inline member functions
+
+   template <int D>
+   inline IntVec<D> const & WaveList<D>::minImage(int i) const
+   {  return minImages_[i]; }
+
+   template <int D>
+   inline DArray<double> const & WaveList<D>::kSq() const
+   {  return kSq_; }
+
+   template <int D>
+   inline DMatrix<double> const & WaveList<D>::dKSq() const
+   {  return dKSq_; }
+
+   template <int D>
+   inline IntVec<D> const & WaveList<D>::kMeshDimensions() const
+   {  return kMeshDimensions_; }
+
+   template <int D>
+   inline int WaveList<D>::kSize() const
+   {  return kSize_; }
+
+   template <int D>
+   inline bool WaveList<D>::isAllocated() const
+   {  return kSize_ > 0; }
+
+   template <int D>
+   inline bool WaveList<D>::hasMinimumImages() const
+   {  return hasMinimumImages_; }
+
+   template <int D>
+   inline bool WaveList<D>::hasKSq() const
+   {  return hasKSq_; }
+
+   template <int D>
+   inline bool WaveList<D>::hasdKSq() const
+   {  return hasdKSq_; }
+
+   #ifndef PSPC_WAVE_LIST_TPP
+   // Suppress implicit instantiation
+   extern template class WaveList<1>;
+   extern template class WaveList<2>;
+   extern template class WaveList<3>;
+   #endif
+
+}
+}
+#endif
@@ -0,0 +1,184 @@
+#ifndef PSPC_WAVE_LIST_TPP
+#define PSPC_WAVE_LIST_TPP
+
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "WaveList.h"
+#include <pscf/mesh/Mesh.h>
+#include <pscf/mesh/MeshIterator.h>
+#include <pscf/crystal/UnitCell.h>
+#include <pscf/crystal/shiftToMinimum.h>
+#include <util/containers/FMatrix.h>
+
+namespace Pscf {
+namespace Pspc {
+
+   using namespace Util;
+
+   /*
+   * Constructor.
+   */
+   template <int D>
+   WaveList<D>::WaveList()
+    : meshDimensions_(0),
+      kMeshDimensions_(0),
+      kSize_(0),
+      hasMinimumImages_(false),
+      hasKSq_(false),
+      hasdKSq_(false)
+   {}
+
+   /*
+   * Destructor.
+   */
+   template <int D>
+   WaveList<D>::~WaveList()
+   {}
+
+   /*
+   * Allocate memory for a mesh.
+   */
+   template <int D>
+   void WaveList<D>::allocate(Mesh<D> const & mesh)
+   {
+      UTIL_CHECK(mesh.size() > 0);
+
+      // Compute dimensions of k-space mesh
+      meshDimensions_ = mesh.dimensions();
+      int kSize = 1;
+      for (int i = 0; i < D; ++i) {
+         if (i < D - 1) {
+            kMeshDimensions_[i] = meshDimensions_[i];
+         } else {
+            kMeshDimensions_[i] = meshDimensions_[i]/2 + 1;
+         }
+         kSize *= kMeshDimensions_[i];
+      }
+
+      if (kSize != kSize_) {
+         if (kSize_ > 0) {
+            minImages_.deallocate();
+            hasImplicitPartner_.deallocate();
+            kSq_.deallocate();
+            dKSq_.deallocate();
+         }
+         minImages_.allocate(kSize);
+         hasImplicitPartner_.allocate(kSize);
+         kSq_.allocate(kSize);
+         dKSq_.allocate(kSize, 6);
+         kSize_ = kSize;
+      }
+
+      hasMinimumImages_ = false;
+      hasKSq_ = false;
+      hasdKSq_ = false;
+   }
+
+   /*
+   * Compute minimum images of all wavevectors on the k-space mesh.
+   */
+   template <int D>
+   void WaveList<D>::computeMinimumImages(UnitCell<D> const & unitCell)
+   {
+      UTIL_CHECK(isAllocated());
+
+      MeshIterator<D> iter;
+      iter.setDimensions(kMeshDimensions_);
+      IntVec<D> G, partner;
+      int i, p;
+      for (iter.begin(); !iter.atEnd(); ++iter) {
+         i = iter.rank();
+         G = iter.position();
+         minImages_[i] = shiftToMinimum(G, meshDimensions_, unitCell);
+
+         // Identify waves for which -G is not on the k-space mesh
+         for (p = 0; p < D; ++p) {
+            if (G[p] != 0) {
+               partner[p] = meshDimensions_[p] - G[p];
+            } else {
+               partner[p] = 0;
+            }
+         }
+         hasImplicitPartner_[i] = (partner[D-1] > kMeshDimensions_[D-1]);
+      }
+
+      hasMinimumImages_ = true;
+      hasKSq_ = false;
+      hasdKSq_ = false;
+   }
+
+   /*
+   * Compute |G|^2 for all wavevectors.
+   */
+   template <int D>
+   void WaveList<D>::computeKSq(UnitCell<D> const & unitCell)
+   {
+      UTIL_CHECK(hasMinimumImages_);
+
+      // Compute dot products of reciprocal basis vectors
+      FMatrix<double, D, D> kk;
+      int p, q, r;
+      for (p = 0; p < D; ++p) {
+         for (q = 0; q < D; ++q) {
+            kk(p, q) = 0.0;
+            for (r = 0; r < D; ++r) {
+               kk(p, q) += unitCell.kBasis(p)[r]*unitCell.kBasis(q)[r];
+            }
+         }
+      }
+
+      // Evaluate quadratic form for all stored images
+      double value;
+      for (int i = 0; i < kSize_; ++i) {
+         IntVec<D> const & G = minImages_[i];
+         value = 0.0;
+         for (p = 0; p < D; ++p) {
+            for (q = 0; q < D; ++q) {
+               value += double(G[p]*G[q])*kk(p, q);
+            }
+         }
+         kSq_[i] = value;
+      }
+
+      hasKSq_ = true;
+      hasdKSq_ = false;
+   }
+
+   /*
+   * Compute derivatives of |G|^2 with respect to unit cell parameters.
+   */
+   template <int D>
+   void WaveList<D>::computedKSq(UnitCell<D> const & unitCell)
+   {
+      UTIL_CHECK(hasMinimumImages_);
+
+      int nParameter = unitCell.nParameter();
+      double value;
+      int i, n, p, q;
+      for (i = 0; i < kSize_; ++i) {
+         IntVec<D> const & G = minImages_[i];
+         for (n = 0; n < nParameter; ++n) {
+            value = 0.0;
+            for (p = 0; p < D; ++p) {
+               for (q = 0; q < D; ++q) {
+                  value += double(G[p]*G[q])*unitCell.dkkBasis(n, p, q);
+               }
+            }
+            if (hasImplicitPartner_[i]) {
+               value *= 2.0;
+            }
+            dKSq_(i, n) = value;
+         }
+      }
+
+      hasdKSq_ = true;
+   }
+
+}
+}
+#endif
@@ -1,5 +1,6 @@
 
 pspc_solvers_= \
+  pspc/solvers/WaveList.cpp \
   pspc/solvers/Block.cpp \
   pspc/solvers/Propagator.cpp \
   pspc/solvers/Polymer.cpp \
@@ -0,0 +1,16 @@
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "CompositionSweep.tpp"
+
+namespace Pscf {
+namespace Pspc {
+   template class CompositionSweep<1>;
+   template class CompositionSweep<2>;
+   template class CompositionSweep<3>;
+}
+}
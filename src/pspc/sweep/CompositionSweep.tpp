@@ -0,0 +1,70 @@
+#ifndef PSPC_COMPOSITION_SWEEP_TPP
+#define PSPC_COMPOSITION_SWEEP_TPP
+
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "CompositionSweep.h"
+#include <pspc/System.h>
+
+namespace Pscf {
+namespace Pspc
+{
+
+   using namespace Util;
+
+   template <int D>
+   CompositionSweep<D>::CompositionSweep(System<D>& system)
+    : Sweep<D>(system)
+   {  setClassName("CompositionSweep"); }
+
+   template <int D>
+   CompositionSweep<D>::~CompositionSweep()
+   {}
+
+   /*
+   * Read parameters.
+   */
+   template <int D>
+   void CompositionSweep<D>::readParameters(std::istream& in)
+   {
+      // Read ns, baseFileName and optional parameters
+      Sweep<D>::readParameters(in);
+
+      int np = mixture().nPolymer();
+      phi0_.allocate(np);
+      dPhi_.allocate(np);
+      readDArray(in, "dPhi", dPhi_, np);
+   }
+
+   /*
+   * Initialization at beginning sweep. Set phi0 to current composition.
+   */
+   template <int D>
+   void CompositionSweep<D>::setup()
+   {
+      int np = mixture().nPolymer();
+      for (int i = 0; i < np; ++i) {
+         phi0_[i] = mixture().polymer(i).phi();
+      }
+   }
+
+   /*
+   * Set state for specified value of s.
+   */
+   template <int D>
+   void CompositionSweep<D>::setState(double s)
+   {
+      int np = mixture().nPolymer();
+      for (int i = 0; i < np; ++i) {
+         mixture().polymer(i).setPhi(phi0_[i] + s*dPhi_[i]);
+      }
+   }
+
+} // namespace Pspc
+} // namespace Pscf
+#endif
@@ -0,0 +1,97 @@
+#ifndef PSPC_LENGTH_SWEEP_H
+#define PSPC_LENGTH_SWEEP_H
+
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "Sweep.h"                        // base class
+#include <util/global.h>
+
+namespace Pscf {
+namespace Pspc
+{
+
+   using namespace Util;
+
+   /**
+   * Sweep in which the length of one block changes linearly with s.
+   *
+   * The length of block blockId of polymer polymerId at path coordinate
+   * s is length0 + s*dLength, in which length0 is the value at the 
+   * beginning of the sweep. The number of contour steps in the block is
+   * held fixed (see Mixture<D>::setBlockLength).
+   *
+   * \ingroup Pspc_Sweep_Module
+   */
+   template <int D>
+   class LengthSweep : public Sweep<D>
+   {
+
+   public:
+
+      /**
+      * Constructor.
+      *
+      * \param system parent System object
+      */
+      LengthSweep(System<D>& system);
+
+      /**
+      * Destructor.
+      */
+      ~LengthSweep();
+
+      /**
+      * Read parameters.
+      *
+      * \param in input stream
+      */
+      virtual void readParameters(std::istream& in);
+
+      /**
+      * Initialization at beginning sweep.
+      */
+      virtual void setup();
+
+      /**
+      * Set block length for specified value of s.
+      *
+      * \param s path length coordinate, in [0,1]
+      */
+      virtual void setState(double s);
+
+   private:
+
+      /// Index of polymer containing the block.
+      int polymerId_;
+
+      /// Index of block within the polymer.
+      int blockId_;
+
+      /// Block length at beginning of sweep (s=0).
+      double length0_;
+
+      /// Change in block length over sweep s=[0,1].
+      double dLength_;
+
+      using Sweep<D>::system;
+      using Sweep<D>::mixture;
+      using Sweep<D>::setClassName;
+      using ParamComposite::read;
+
+   };
+
+   #ifndef PSPC_LENGTH_SWEEP_TPP
+   // Suppress implicit instantiation
+   extern template class LengthSweep<1>;
+   extern template class LengthSweep<2>;
+   extern template class LengthSweep<3>;
+   #endif
+
+} // namespace Pspc
+} // namespace Pscf
+#endif
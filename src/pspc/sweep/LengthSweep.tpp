@@ -0,0 +1,71 @@
+#ifndef PSPC_LENGTH_SWEEP_TPP
+#define PSPC_LENGTH_SWEEP_TPP
+
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "LengthSweep.h"
+#include <pspc/System.h>
+
+namespace Pscf {
+namespace Pspc
+{
+
+   using namespace Util;
+
+   template <int D>
+   LengthSweep<D>::LengthSweep(System<D>& system)
+    : Sweep<D>(system),
+      polymerId_(-1),
+      blockId_(-1),
+      length0_(0.0),
+      dLength_(0.0)
+   {  setClassName("LengthSweep"); }
+
+   template <int D>
+   LengthSweep<D>::~LengthSweep()
+   {}
+
+   /*
+   * Read parameters.
+   */
+   template <int D>
+   void LengthSweep<D>::readParameters(std::istream& in)
+   {
+      // Read ns, baseFileName and optional parameters
+      Sweep<D>::readParameters(in);
+
+      read(in, "polymerId", polymerId_);
+      read(in, "blockId", blockId_);
+      read(in, "dLength", dLength_);
+      UTIL_CHECK(polymerId_ >= 0);
+      UTIL_CHECK(polymerId_ < mixture().nPolymer());
+      UTIL_CHECK(blockId_ >= 0);
+      UTIL_CHECK(blockId_ < mixture().polymer(polymerId_).nBlock());
+   }
+
+   /*
+   * Initialization at beginning sweep. Set length0 to current block length.
+   */
+   template <int D>
+   void LengthSweep<D>::setup()
+   {
+      length0_ = mixture().polymer(polymerId_).block(blockId_).length();
+   }
+
+   /*
+   * Set state for specified value of s.
+   */
+   template <int D>
+   void LengthSweep<D>::setState(double s)
+   {
+      mixture().setBlockLength(polymerId_, blockId_, length0_ + s*dLength_);
+   }
+
+} // namespace Pspc
+} // namespace Pscf
+#endif
@@ -0,0 +1,16 @@
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "MuSweep.tpp"
+
+namespace Pscf {
+namespace Pspc {
+   template class MuSweep<1>;
+   template class MuSweep<2>;
+   template class MuSweep<3>;
+}
+}
@@ -0,0 +1,92 @@
+#ifndef PSPC_MU_SWEEP_H
+#define PSPC_MU_SWEEP_H
+
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "Sweep.h"                        // base class
+#include <util/containers/DArray.h>       // member
+#include <util/global.h>
+
+namespace Pscf {
+namespace Pspc
+{
+
+   using namespace Util;
+
+   /**
+   * Sweep in which polymer chemical potentials change linearly with s.
+   *
+   * The chemical potential of polymer i at path coordinate s is 
+   * mu0[i] + s*dMu[i], in which mu0[i] is the value at the beginning of
+   * the sweep. All polymer species must be in the open (grand canonical)
+   * ensemble.
+   *
+   * \ingroup Pspc_Sweep_Module
+   */
+   template <int D>
+   class MuSweep : public Sweep<D>
+   {
+
+   public:
+
+      /**
+      * Constructor.
+      *
+      * \param system parent System object
+      */
+      MuSweep(System<D>& system);
+
+      /**
+      * Destructor.
+      */
+      ~MuSweep();
+
+      /**
+      * Read parameters.
+      *
+      * \param in input stream
+      */
+      virtual void readParameters(std::istream& in);
+
+      /**
+      * Initialization at beginning sweep.
+      */
+      virtual void setup();
+
+      /**
+      * Set polymer chemical potentials for specified value of s.
+      *
+      * \param s path length coordinate, in [0,1]
+      */
+      virtual void setState(double s);
+
+   private:
+
+      /// Polymer chemical potentials at beginning of sweep (s=0).
+      DArray<double> mu0_;
+
+      /// Change in polymer chemical potentials over sweep s=[0,1].
+      DArray<double> dMu_;
+
+      using Sweep<D>::system;
+      using Sweep<D>::mixture;
+      using Sweep<D>::setClassName;
+      using ParamComposite::readDArray;
+
+   };
+
+   #ifndef PSPC_MU_SWEEP_TPP
+   // Suppress implicit instantiation
+   extern template class MuSweep<1>;
+   extern template class MuSweep<2>;
+   extern template class MuSweep<3>;
+   #endif
+
+} // namespace Pspc
+} // namespace Pscf
+#endif
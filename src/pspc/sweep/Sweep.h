@@ -0,0 +1,191 @@
+#ifndef PSPC_SWEEP_H
+#define PSPC_SWEEP_H
+
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include <util/param/ParamComposite.h>    // base class
+#include <util/containers/DArray.h>       // member
+#include <util/containers/FSArray.h>      // member
+#include <util/containers/RingBuffer.h>   // member
+#include <util/global.h>
+
+#include <string>
+
+namespace Pscf {
+namespace Pspc
+{
+
+   template <int D> class System;
+   template <int D> class Mixture;
+
+   using namespace Util;
+
+   /**
+   * Solve a sequence of problems along a line in parameter space.
+   *
+   * A sweep solves the SCF equations for a sequence of states along a 
+   * path in parameter space parameterized by a variable s in [0,1], in 
+   * which s = 0 is the initial state of the system. Subclasses define 
+   * the path by implementing setState(s).
+   *
+   * The initial guess for each new state is obtained by polynomial 
+   * extrapolation of the w fields and, if the unit cell is flexible, 
+   * of the unit cell parameters, through up to historyCapacity previous
+   * converged states. The w fields are extrapolated in symmetry-adapted
+   * basis format, unless the iterator mixes r-grid fields without 
+   * symmetrizing them, in which case r-grid fields are used. The step 
+   * size is halved after a failure to converge. If nItrTarget > 0, the
+   * step size is also adjusted after each converged state, by a factor
+   * nItrTarget/nItr (limited to [0.5, 2.0]) in which nItr is the number
+   * of iterations required to converge that state.
+   *
+   * \ingroup Pspc_Sweep_Module
+   */
+   template <int D>
+   class Sweep : public ParamComposite
+   {
+
+   public:
+
+      /**
+      * Constructor.
+      * 
+      * \param system parent System object
+      */
+      Sweep(System<D>& system);
+
+      /**
+      * Destructor.
+      */
+      ~Sweep();
+
+      /**
+      * Read parameters.
+      *
+      * Reads ns and baseFileName, and optional parameters historyCapacity,
+      * nItrTarget, dsMin and dsMax.
+      *
+      * \param in input stream
+      */
+      virtual void readParameters(std::istream& in);
+
+      /**
+      * Setup operation at beginning of sweep.
+      *
+      * Subclasses should record the initial (s=0) values of any 
+      * parameters that are changed by setState.
+      */
+      virtual void setup(){};
+
+      /**
+      * Set system parameters.
+      *
+      * \param s path length coordinate, in range [0,1]
+      */
+      virtual void setState(double s) = 0;
+
+      /**
+      * Output information after obtaining a converged solution.
+      *
+      * \param fileName base name of output files
+      * \param s value of path length parameter s
+      */
+      virtual void outputSolution(std::string const & fileName, double s);
+
+      /**
+      * Output data to a running summary.
+      *
+      * \param out  output file, open for writing
+      * \param i  integer index
+      * \param s  value of path length parameter s
+      */
+      virtual void outputSummary(std::ostream& out, int i, double s);
+
+      /**
+      * Solve all states along the path, from s=0 to s=1.
+      *
+      * Initial w fields for the state s=0 must be set before entry.
+      */
+      virtual void solve();
+
+   protected:
+
+      /// Number of steps (nominal step size ds = 1/ns).
+      int ns_;
+
+      /// Base name for output files.
+      std::string baseFileName_;
+
+      /**
+      * Get parent System by reference.
+      */
+      System<D>& system()
+      {  return *systemPtr_; }
+
+      /**
+      * Get Mixture by reference.
+      */
+      Mixture<D>& mixture();
+
+   private:
+
+      /// Maximum number of previous states used for extrapolation.
+      int historyCapacity_;
+
+      /// Target number of iterations per state (0 -> fixed step).
+      int nItrTarget_;
+
+      /// Minimum step size. 
+      double dsMin_;
+
+      /// Maximum step size.
+      double dsMax_;
+
+      /// Values of s for previous converged states.
+      RingBuffer<double> sHistory_;
+
+      /// Basis or r-grid w fields of previous converged states.
+      RingBuffer< DArray< DArray<double> > > wHistory_;
+
+      /// Unit cell parameters of previous converged states.
+      RingBuffer< FSArray<double, 6> > cellHistory_;
+
+      /// Work array of s values, in the order of sHistory_.
+      DArray<double> sValues_;
+
+      /// Extrapolation coefficients.
+      DArray<double> coeffs_;
+
+      /// Pointer to parent System.
+      System<D>* systemPtr_;
+
+      /**
+      * Store the current state, with path length coordinate s.
+      */
+      void saveState(double s);
+
+      /**
+      * Set w fields and unit cell by extrapolation to s.
+      *
+      * \param s path length coordinate of new state
+      * \param nPoint number of stored states to use (<= size of history)
+      */
+      void setGuess(double s, int nPoint);
+
+   };
+
+   #ifndef PSPC_SWEEP_TPP
+   // Suppress implicit instantiation
+   extern template class Sweep<1>;
+   extern template class Sweep<2>;
+   extern template class Sweep<3>;
+   #endif
+
+} // namespace Pspc
+} // namespace Pscf
+#endif
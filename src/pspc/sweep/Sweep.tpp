@@ -0,0 +1,362 @@
+#ifndef PSPC_SWEEP_TPP
+#define PSPC_SWEEP_TPP
+
+/*
+* PSCF - Polymer Self-Consistent Field Theory
+*
+* Copyright 2016 - 2019, The Regents of the University of Minnesota
+* Distributed under the terms of the GNU General Public License.
+*/
+
+#include "Sweep.h"
+#include <pspc/System.h>
+#include <pspc/iterator/AmIterator.h>
+#include <pscf/math/continuation.h>
+#include <util/misc/ioUtil.h>
+#include <util/format/Int.h>
+#include <util/format/Dbl.h>
+
+#include <cmath>
+
+namespace Pscf {
+namespace Pspc
+{
+
+   using namespace Util;
+
+   /*
+   * Constructor.
+   */
+   template <int D>
+   Sweep<D>::Sweep(System<D>& system)
+    : ns_(0),
+      baseFileName_(),
+      historyCapacity_(3),
+      nItrTarget_(0),
+      dsMin_(0.0),
+      dsMax_(0.0),
+      systemPtr_(&system)
+   {  setClassName("Sweep"); }
+
+   /*
+   * Destructor.
+   */
+   template <int D>
+   Sweep<D>::~Sweep()
+   {}
+
+   /*
+   * Read parameters.
+   */
+   template <int D>
+   void Sweep<D>::readParameters(std::istream& in)
+   {
+      read<int>(in, "ns", ns_);
+      read<std::string>(in, "baseFileName", baseFileName_);
+      UTIL_CHECK(ns_ > 0);
+
+      historyCapacity_ = 3; // default value (quadratic extrapolation)
+      readOptional<int>(in, "historyCapacity", historyCapacity_);
+      UTIL_CHECK(historyCapacity_ > 0);
+
+      nItrTarget_ = 0; // default value (fixed step size)
+      readOptional<int>(in, "nItrTarget", nItrTarget_);
+      UTIL_CHECK(nItrTarget_ >= 0);
+
+      double ds = 1.0/double(ns_);
+      dsMin_ = 0.2*ds; // default value 
+      readOptional<double>(in, "dsMin", dsMin_);
+      dsMax_ = (nItrTarget_ > 0) ? 4.0*ds : ds; // default value
+      if (dsMax_ > 1.0) dsMax_ = 1.0;
+      readOptional<double>(in, "dsMax", dsMax_);
+      UTIL_CHECK(dsMin_ > 0.0);
+      UTIL_CHECK(dsMax_ >= dsMin_);
+
+      sHistory_.allocate(historyCapacity_);
+      wHistory_.allocate(historyCapacity_);
+      cellHistory_.allocate(historyCapacity_);
+      sValues_.allocate(historyCapacity_);
+      coeffs_.allocate(historyCapacity_);
+   }
+
+   /*
+   * Get Mixture by reference.
+   */
+   template <int D>
+   Mixture<D>& Sweep<D>::mixture()
+   {  return systemPtr_->mixture(); }
+
+   /*
+   * Solve all states along the path.
+   */
+   template <int D>
+   void Sweep<D>::solve()
+   {
+      UTIL_CHECK(system().hasWFields());
+      UTIL_CHECK(sHistory_.capacity() > 0);
+
+      // Discard any states from a previous sweep
+      sHistory_.clear();
+      wHistory_.clear();
+      cellHistory_.clear();
+
+      double ds = 1.0/double(ns_);
+      if (ds > dsMax_) ds = dsMax_;
+      Log::file() << std::endl;
+      Log::file() << "ns = " << ns_ << std::endl;
+      Log::file() << "ds = " << ds  << std::endl;
+
+      // Record initial parameters
+      setup();
+
+      // Open summary file
+      std::ofstream outFile;
+      std::string fileName = baseFileName_;
+      fileName += "log";
+      system().fileMaster().openOutputFile(fileName, outFile);
+
+      // Solve for initial state of sweep
+      double s = 0.0;
+      int i = 0;
+      int error;
+      Log::file() << std::endl;
+      Log::file() << "Begin s = " << s << std::endl;
+      error = system().iterator().solve();
+      if (error) {
+         UTIL_THROW("Failure to converge initial state of sweep");
+      }
+      system().computeFreeEnergy();
+      saveState(s);
+      fileName = baseFileName_;
+      fileName += toString(i);
+      outputSolution(fileName, s);
+      outputSummary(outFile, i, s);
+
+      // Loop over states on path
+      int nItr;
+      while (s < 1.0 - 1.0E-8) {
+
+         // Do not step past the end of the path
+         if (s + ds > 1.0) {
+            ds = 1.0 - s;
+         }
+
+         error = 1;
+         while (error) {
+
+            Log::file() << std::endl;
+            Log::file() << "Attempt s = " << s + ds << std::endl;
+
+            // Set parameters and initial guess for the new state
+            setState(s + ds);
+            setGuess(s + ds, sHistory_.size());
+
+            // Attempt solution
+            error = system().iterator().solve();
+
+            if (error) {
+
+               // Upon failure, decrease ds by half
+               ds *= 0.5;
+               if (ds < dsMin_) {
+                  // Restore the last converged state before throwing
+                  setState(s);
+                  setGuess(s, 1);
+                  UTIL_THROW("Step size too small in sweep");
+               }
+
+            } else {
+
+               // Upon success, save new state and output
+               s += ds;
+               ++i;
+               system().computeFreeEnergy();
+               saveState(s);
+               fileName = baseFileName_;
+               fileName += toString(i);
+               outputSolution(fileName, s);
+               outputSummary(outFile, i, s);
+
+               // Adjust step size to the target number of iterations
+               if (nItrTarget_ > 0) {
+                  nItr = system().iterator().nIteration();
+                  ds = adjustStepSize(ds, nItr, nItrTarget_, 
+                                      dsMin_, dsMax_);
+               }
+
+            }
+         }
+      }
+      outFile.close();
+   }
+
+   /*
+   * Store the current converged state.
+   */
+   template <int D>
+   void Sweep<D>::saveState(double s)
+   {
+      sHistory_.append(s);
+      if (system().iterator().isSymmetric()) {
+         wHistory_.append(system().wFields());
+      } else {
+         // Store r-grid w fields, which may have lower symmetry than
+         // the space group used to construct the basis
+         DArray< RField<D> > const & wFieldsRGrid = system().wFieldsRGrid();
+         int nMonomer = mixture().nMonomer();
+         int nx = system().mesh().size();
+         DArray< DArray<double> > w;
+         w.allocate(nMonomer);
+         for (int i = 0; i < nMonomer; ++i) {
+            w[i].allocate(nx);
+            for (int j = 0; j < nx; ++j) {
+               w[i][j] = wFieldsRGrid[i][j];
+            }
+         }
+         wHistory_.append(w);
+      }
+      cellHistory_.append(system().unitCell().parameters());
+   }
+
+   /*
+   * Set w fields and unit cell by extrapolation from previous states.
+   */
+   template <int D>
+   void Sweep<D>::setGuess(double s, int nPoint)
+   {
+      UTIL_CHECK(nPoint > 0);
+      UTIL_CHECK(nPoint <= sHistory_.size());
+
+      int k;
+      for (k = 0; k < nPoint; ++k) {
+         sValues_[k] = sHistory_[k];
+      }
+      lagrangeCoefficients(sValues_, nPoint, s, coeffs_);
+      if (nPoint > 1) {
+         Log::file() << "Extrapolation order " << nPoint - 1 << std::endl;
+      }
+
+      int nMonomer = mixture().nMonomer();
+      int i, j;
+      double w;
+      if (system().iterator().isSymmetric()) {
+
+         // Extrapolate w fields, in symmetry-adapted basis format
+         DArray< DArray<double> >& wFields = system().wFields();
+         int nStar = system().basis().nStar();
+         for (i = 0; i < nMonomer; ++i) {
+            for (j = 0; j < nStar; ++j) {
+               w = 0.0;
+               for (k = 0; k < nPoint; ++k) {
+                  w += coeffs_[k]*wHistory_[k][i][j];
+               }
+               wFields[i][j] = w;
+            }
+         }
+         system().fieldIo().convertBasisToRGrid(wFields, 
+                                                system().wFieldsRGrid());
+
+      } else {
+
+         // Extrapolate r-grid w fields, without projection onto the 
+         // basis, so that states of lower symmetry are preserved
+         DArray< RField<D> >& wFieldsRGrid = system().wFieldsRGrid();
+         int nx = system().mesh().size();
+         for (i = 0; i < nMonomer; ++i) {
+            for (j = 0; j < nx; ++j) {
+               w = 0.0;
+               for (k = 0; k < nPoint; ++k) {
+                  w += coeffs_[k]*wHistory_[k][i][j];
+               }
+               wFieldsRGrid[i][j] = w;
+            }
+         }
+
+      }
+
+      // Extrapolate unit cell parameters of a flexible unit cell
+      if (system().iterator().isFlexible()) {
+         UnitCell<D>& unitCell = system().unitCell();
+         FSArray<double, 6> parameters;
+         double p;
+         for (i = 0; i < unitCell.nParameter(); ++i) {
+            p = 0.0;
+            for (k = 0; k < nPoint; ++k) {
+               p += coeffs_[k]*cellHistory_[k][i];
+            }
+            parameters.append(p);
+         }
+         unitCell.setParameters(parameters);
+         mixture().setupUnitCell(unitCell);
+         system().basis().update();
+      }
+   }
+
+   /*
+   * Output parameters, thermodynamic properties and fields.
+   */
+   template <int D>
+   void Sweep<D>::outputSolution(std::string const & fileName, double s)
+   {
+      std::ofstream out;
+      std::string outFileName;
+
+      // Write parameter file, with thermodynamic properties at end
+      outFileName = fileName;
+      outFileName += ".prm";
+      system().fileMaster().openOutputFile(outFileName, out);
+      system().writeParam(out);
+      out << std::endl;
+      system().outputThermo(out);
+      out.close();
+
+      if (system().iterator().isSymmetric()) {
+
+         // Write concentration fields
+         outFileName = fileName;
+         outFileName += ".c";
+         system().fieldIo().writeFieldsBasis(outFileName, 
+                                             system().cFields());
+
+         // Write chemical potential fields
+         outFileName = fileName;
+         outFileName += ".w";
+         system().fieldIo().writeFieldsBasis(outFileName, 
+                                             system().wFields());
+
+      } else {
+
+         // Write fields in r-grid format, since the basis format would
+         // discard any component of lower symmetry than the space group
+         outFileName = fileName;
+         outFileName += ".rc";
+         system().fieldIo().writeFieldsRGrid(outFileName, 
+                                             system().cFieldsRGrid());
+         outFileName = fileName;
+         outFileName += ".rw";
+         system().fieldIo().writeFieldsRGrid(outFileName, 
+                                             system().wFieldsRGrid());
+
+      }
+   }
+
+   /*
+   * Output one line of the summary file.
+   */
+   template <int D>
+   void Sweep<D>::outputSummary(std::ostream& out, int i, double s)
+   {
+      out << Int(i, 5) << Dbl(s)
+          << Dbl(system().fHelmholtz(), 20, 10)
+          << Dbl(system().pressure(), 20, 10);
+      UnitCell<D> const & unitCell = system().unitCell();
+      for (int m = 0; m < unitCell.nParameter(); ++m) {
+         out << Dbl(unitCell.parameters()[m], 20, 10);
+      }
+      out << Int(system().iterator().nIteration(), 6);
+      out << std::endl;
+   }
+
+} // namespace Pspc
+} // namespace Pscf
+#endif
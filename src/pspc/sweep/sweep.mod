@@ -0,0 +1,14 @@
+
+namespace Pscf{
+namespace Pspc{
+
+   /**
+   * \defgroup Pspc_Sweep_Module Sweep
+   *
+   * Sweep (continuation) classes.
+   *
+   * \ingroup Pscf_Pspc_Module
+   */
+
+}
+}
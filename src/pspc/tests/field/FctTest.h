@@ -0,0 +1,173 @@
+#ifndef PSPC_FCT_TEST_H
+#define PSPC_FCT_TEST_H
+
+#include <test/UnitTest.h>
+#include <test/UnitTestRunner.h>
+
+#include <pspc/field/FCT.h>
+#include <pspc/field/FFT.h>
+#include <pspc/field/Field.h>
+#include <pspc/field/RField.h>
+#include <pspc/field/RFieldDft.h>
+#include <pscf/mesh/Mesh.h>
+#include <pscf/mesh/MeshIterator.h>
+#include <util/math/Constants.h>
+
+#include <cmath>
+
+using namespace Util;
+using namespace Pscf;
+using namespace Pscf::Pspc;
+
+class FctTest : public UnitTest
+{
+public:
+
+   void setUp() {}
+   void tearDown() {}
+
+   void testConstructor();
+   void testTransform2D();
+   void testBatch3D();
+
+};
+
+void FctTest::testConstructor()
+{
+   printMethod(TEST_FUNC);
+
+   FCT<2> v;
+   TEST_ASSERT(!v.isSetup());
+
+   IntVec<2> d;
+   d[0] = 6;
+   d[1] = 8;
+   TEST_ASSERT(FCT<2>::isValidMesh(d));
+   v.setup(d, 1);
+   TEST_ASSERT(v.isSetup());
+   TEST_ASSERT(v.evenDimensions()[0] == 4);
+   TEST_ASSERT(v.evenDimensions()[1] == 5);
+   TEST_ASSERT(v.evenSize() == 20);
+
+   d[1] = 9;
+   TEST_ASSERT(!FCT<2>::isValidMesh(d));
+}
+
+/*
+* Compare cosine transform of an even field to its FFT.
+*/
+void FctTest::testTransform2D()
+{
+   printMethod(TEST_FUNC);
+
+   IntVec<2> d;
+   d[0] = 6;
+   d[1] = 8;
+   Mesh<2> mesh(d);
+
+   FCT<2> v;
+   v.setup(d, 1);
+   Mesh<2> evenMesh(v.evenDimensions());
+   int ne = evenMesh.size();
+
+   // Field that is even in each coordinate separately
+   RField<2> r;
+   r.allocate(d);
+   MeshIterator<2> iter(d);
+   IntVec<2> x;
+   double twoPi = 2.0*Constants::Pi;
+   for (iter.begin(); !iter.atEnd(); ++iter) {
+      x = iter.position();
+      r[iter.rank()] = 1.0 + 0.5*cos(twoPi*double(x[0])/double(d[0]))
+                     + 0.3*cos(twoPi*double(2*x[1])/double(d[1]))
+                     + 0.2*cos(twoPi*double(x[0])/double(d[0]))
+                          *cos(twoPi*double(3*x[1])/double(d[1]));
+   }
+
+   // Values on even mesh
+   Pscf::Pspc::Field<double> in, out, inCopy;
+   in.allocate(ne);
+   out.allocate(ne);
+   inCopy.allocate(ne);
+   iter.setDimensions(evenMesh.dimensions());
+   for (iter.begin(); !iter.atEnd(); ++iter) {
+      in[iter.rank()] = r[mesh.rank(iter.position())];
+   }
+
+   v.forwardTransform(in, out);
+
+   // Compare to FFT of the full field
+   RFieldDft<2> k;
+   k.allocate(d);
+   FFT<2> fft;
+   fft.setup(r, k);
+   fft.forwardTransform(r, k);
+   Mesh<2> kMesh(k.dftDimensions());
+   for (iter.begin(); !iter.atEnd(); ++iter) {
+      int i = kMesh.rank(iter.position());
+      TEST_ASSERT(eq(out[iter.rank()], k[i][0]));
+      TEST_ASSERT(std::abs(k[i][1]) < 1.0E-10);
+   }
+
+   // Inverse
+   v.inverseTransform(out, inCopy);
+   for (int i = 0; i < ne; ++i) {
+      TEST_ASSERT(eq(in[i], inCopy[i]));
+   }
+}
+
+void FctTest::testBatch3D()
+{
+   printMethod(TEST_FUNC);
+
+   IntVec<3> d;
+   d[0] = 4;
+   d[1] = 6;
+   d[2] = 4;
+   int nBatch = 2;
+
+   FCT<3> v;
+   v.setup(d, nBatch);
+   int ne = v.evenSize();
+   TEST_ASSERT(ne == 3*4*3);
+
+   Pscf::Pspc::Field<double> in, out, inCopy;
+   in.allocate(nBatch*ne);
+   out.allocate(nBatch*ne);
+   inCopy.allocate(nBatch*ne);
+   for (int i = 0; i < nBatch*ne; ++i) {
+      in[i] = cos(0.3*double(i)) + double(i/ne);
+   }
+
+   // Compare to separate transforms of each field
+   v.forwardTransformUnscaled(in, out);
+   FCT<3> w;
+   w.setup(d, 1);
+   Pscf::Pspc::Field<double> in1, out1;
+   in1.allocate(ne);
+   out1.allocate(ne);
+   for (int j = 0; j < nBatch; ++j) {
+      for (int i = 0; i < ne; ++i) {
+         in1[i] = in[j*ne + i];
+      }
+      w.forwardTransformUnscaled(in1, out1);
+      for (int i = 0; i < ne; ++i) {
+         TEST_ASSERT(eq(out[j*ne + i], out1[i]));
+      }
+   }
+
+   // Unscaled forward and inverse transforms multiply by mesh size
+   v.inverseTransform(out, inCopy);
+   double scale = 1.0/double(d[0]*d[1]*d[2]);
+   for (int i = 0; i < nBatch*ne; ++i) {
+      TEST_ASSERT(eq(in[i], inCopy[i]*scale));
+   }
+}
+
+TEST_BEGIN(FctTest)
+TEST_ADD(FctTest, testConstructor)
+TEST_ADD(FctTest, testTransform2D)
+TEST_ADD(FctTest, testBatch3D)
+TEST_END(FctTest)
+
+#endif
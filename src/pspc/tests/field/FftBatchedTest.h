@@ -0,0 +1,194 @@
+#ifndef PSPC_FFT_BATCHED_TEST_H
+#define PSPC_FFT_BATCHED_TEST_H
+
+#include <test/UnitTest.h>
+#include <test/UnitTestRunner.h>
+
+#include <pspc/field/FFTBatched.h>
+#include <pspc/field/FFT.h>
+#include <pspc/field/Field.h>
+#include <pspc/field/RField.h>
+#include <pspc/field/RFieldDft.h>
+
+#include <util/containers/DArray.h>
+#include <util/math/Constants.h>
+
+using namespace Util;
+using namespace Pscf::Pspc;
+
+class FftBatchedTest : public UnitTest
+{
+public:
+
+   void setUp() {}
+   void tearDown() {}
+
+   void testContiguous2D();
+   void testArray3D();
+   void testSetupTwice2D();
+
+};
+
+void FftBatchedTest::testContiguous2D()
+{
+   printMethod(TEST_FUNC);
+
+   IntVec<2> d;
+   d[0] = 6;
+   d[1] = 9;
+   int nBatch = 3;
+
+   FFTBatched<2> v;
+   v.setup(d, nBatch);
+   TEST_ASSERT(v.isSetup());
+   TEST_ASSERT(v.batchSize() == nBatch);
+   int nx = v.rSize();
+   int nk = v.kSize();
+   TEST_ASSERT(nx == 54);
+   TEST_ASSERT(nk == 30);
+
+   Pscf::Pspc::Field<double> in, inCopy;
+   Pscf::Pspc::Field<fftw_complex> out;
+   in.allocate(nBatch*nx);
+   inCopy.allocate(nBatch*nx);
+   out.allocate(nBatch*nk);
+   for (int i = 0; i < nBatch*nx; ++i) {
+      in[i] = cos(0.3*double(i)) + double(i/nx);
+   }
+
+   v.forwardTransform(in, out);
+
+   // Compare to separate transforms of each field
+   RField<2> r;
+   RFieldDft<2> k;
+   r.allocate(d);
+   k.allocate(d);
+   FFT<2> fft;
+   fft.setup(r, k);
+   for (int j = 0; j < nBatch; ++j) {
+      for (int i = 0; i < nx; ++i) {
+         r[i] = in[j*nx + i];
+      }
+      fft.forwardTransform(r, k);
+      for (int i = 0; i < nk; ++i) {
+         TEST_ASSERT(eq(out[j*nk + i][0], k[i][0]));
+         TEST_ASSERT(eq(out[j*nk + i][1], k[i][1]));
+      }
+   }
+
+   v.inverseTransform(out, inCopy);
+   for (int i = 0; i < nBatch*nx; ++i) {
+      TEST_ASSERT(eq(in[i], inCopy[i]));
+   }
+}
+
+void FftBatchedTest::testArray3D()
+{
+   printMethod(TEST_FUNC);
+
+   IntVec<3> d;
+   d[0] = 4;
+   d[1] = 6;
+   d[2] = 5;
+   int nBatch = 2;
+
+   DArray< RField<3> > in, inCopy;
+   DArray< RFieldDft<3> > out;
+   in.allocate(nBatch);
+   inCopy.allocate(nBatch);
+   out.allocate(nBatch);
+   for (int j = 0; j < nBatch; ++j) {
+      in[j].allocate(d);
+      inCopy[j].allocate(d);
+      out[j].allocate(d);
+      for (int i = 0; i < in[j].capacity(); ++i) {
+         in[j][i] = sin(0.2*double(i*(j+1))) + 1.0;
+      }
+   }
+
+   FFTBatched<3> v;
+   v.setup(d, nBatch);
+   v.forwardTransform(in, out);
+
+   // Compare to separate transforms of each field
+   RFieldDft<3> k;
+   k.allocate(d);
+   FFT<3> fft;
+   for (int j = 0; j < nBatch; ++j) {
+      fft.forwardTransform(in[j], k);
+      for (int i = 0; i < k.capacity(); ++i) {
+         TEST_ASSERT(eq(out[j][i][0], k[i][0]));
+         TEST_ASSERT(eq(out[j][i][1], k[i][1]));
+      }
+   }
+
+   v.inverseTransform(out, inCopy);
+   for (int j = 0; j < nBatch; ++j) {
+      for (int i = 0; i < in[j].capacity(); ++i) {
+         TEST_ASSERT(eq(in[j][i], inCopy[j][i]));
+      }
+   }
+}
+
+void FftBatchedTest::testSetupTwice2D()
+{
+   printMethod(TEST_FUNC);
+
+   IntVec<2> d;
+   d[0] = 6;
+   d[1] = 9;
+
+   RField<2> r;
+   RFieldDft<2> k;
+   r.allocate(d);
+   k.allocate(d);
+   FFT<2> fft;
+   fft.setup(r, k);
+
+   // Setup with a smaller and then a larger batch size reallocates the
+   // work arrays and plans
+   FFTBatched<2> v;
+   int nBatch;
+   for (int m = 0; m < 3; ++m) {
+      nBatch = (m == 1) ? 2 : 2*m + 3;
+      v.setup(d, nBatch);
+      TEST_ASSERT(v.isSetup());
+      TEST_ASSERT(v.batchSize() == nBatch);
+
+      int nx = v.rSize();
+      int nk = v.kSize();
+      Pscf::Pspc::Field<double> in, inCopy;
+      Pscf::Pspc::Field<fftw_complex> out;
+      in.allocate(nBatch*nx);
+      inCopy.allocate(nBatch*nx);
+      out.allocate(nBatch*nk);
+      for (int i = 0; i < nBatch*nx; ++i) {
+         in[i] = cos(0.3*double(i)) + double(i/nx);
+      }
+
+      v.forwardTransform(in, out);
+      for (int j = 0; j < nBatch; ++j) {
+         for (int i = 0; i < nx; ++i) {
+            r[i] = in[j*nx + i];
+         }
+         fft.forwardTransform(r, k);
+         for (int i = 0; i < nk; ++i) {
+            TEST_ASSERT(eq(out[j*nk + i][0], k[i][0]));
+            TEST_ASSERT(eq(out[j*nk + i][1], k[i][1]));
+         }
+      }
+
+      v.inverseTransform(out, inCopy);
+      for (int i = 0; i < nBatch*nx; ++i) {
+         TEST_ASSERT(eq(in[i], inCopy[i]));
+      }
+   }
+}
+
+TEST_BEGIN(FftBatchedTest)
+TEST_ADD(FftBatchedTest, testContiguous2D)
+TEST_ADD(FftBatchedTest, testArray3D)
+TEST_ADD(FftBatchedTest, testSetupTwice2D)
+TEST_END(FftBatchedTest)
+
+#endif
@@ -0,0 +1,112 @@
+/*
+* Benchmark for thread scaling of FFT<D> forward and inverse transforms.
+*
+* Usage:
+*
+*    FftBench maxThread nRepeat N[0] [N[1] [N[2]]]
+*
+* For each number of threads 1 ... maxThread, this program creates new
+* FFTW plans for a mesh with dimensions N[0] x ... x N[D-1], in which
+* D is the number of mesh dimensions given, and reports the average wall
+* clock time for one forward plus one inverse transform, averaged over
+* nRepeat transforms. The resulting table may be used to choose the
+* value of the nThread parameter for a given mesh.
+*
+* Values of maxThread greater than 1 require compilation with OpenMP
+* enabled (i.e., with PSCF_OPENMP defined).
+*/
+
+#include <pspc/field/FFT.h>
+#include <pspc/field/RField.h>
+#include <pspc/field/RFieldDft.h>
+
+#include <util/misc/Timer.h>
+#include <util/format/Int.h>
+#include <util/format/Dbl.h>
+#include <util/global.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+using namespace Util;
+using namespace Pscf;
+using namespace Pscf::Pspc;
+
+template <int D>
+void runBench(int maxThread, int nRepeat, IntVec<D> const & dimensions)
+{
+   RField<D> rField;
+   RFieldDft<D> kField;
+   rField.allocate(dimensions);
+   kField.allocate(dimensions);
+
+   std::cout << "mesh  = " << dimensions << std::endl;
+   std::cout << "nThread    time [s]     speedup" << std::endl;
+
+   double time1 = 0.0;
+   for (int nThread = 1; nThread <= maxThread; ++nThread) {
+      FFT<D>::setNThread(nThread);
+
+      // Create new plans for each thread count
+      FFT<D> fft;
+      fft.setup(rField, kField);
+
+      for (int i = 0; i < rField.capacity(); ++i) {
+         rField[i] = cos(double(i));
+      }
+
+      // Warm up once before timing
+      fft.forwardTransform(rField, kField);
+      fft.inverseTransform(kField, rField);
+
+      Timer timer;
+      timer.start();
+      for (int j = 0; j < nRepeat; ++j) {
+         fft.forwardTransform(rField, kField);
+         fft.inverseTransform(kField, rField);
+      }
+      timer.stop();
+      double time = timer.time()/double(nRepeat);
+      if (nThread == 1) {
+         time1 = time;
+      }
+
+      std::cout << Int(nThread, 7)
+                << Dbl(time, 12, 4)
+                << Dbl(time1/time, 12, 4) << std::endl;
+   }
+}
+
+int main(int argc, char* argv[])
+{
+   if (argc < 4 || argc > 6) {
+      std::cout << "Usage: FftBench maxThread nRepeat N[0] [N[1] [N[2]]]"
+                << std::endl;
+      return 1;
+   }
+   int maxThread = atoi(argv[1]);
+   int nRepeat = atoi(argv[2]);
+   UTIL_CHECK(maxThread > 0);
+   UTIL_CHECK(nRepeat > 0);
+
+   int dim = argc - 3;
+   if (dim == 1) {
+      IntVec<1> d;
+      d[0] = atoi(argv[3]);
+      runBench<1>(maxThread, nRepeat, d);
+   } else
+   if (dim == 2) {
+      IntVec<2> d;
+      d[0] = atoi(argv[3]);
+      d[1] = atoi(argv[4]);
+      runBench<2>(maxThread, nRepeat, d);
+   } else {
+      IntVec<3> d;
+      d[0] = atoi(argv[3]);
+      d[1] = atoi(argv[4]);
+      d[2] = atoi(argv[5]);
+      runBench<3>(maxThread, nRepeat, d);
+   }
+   return 0;
+}
@@ -25,6 +25,8 @@ public:
    void testTransform1D();
    void testTransform2D();
    void testTransform3D();
+   void testThreadedTransform3D();
+   void testMeasuredTransform2D();
 
 };
 
@@ -157,11 +159,114 @@ void FftTest::testTransform3D() {
    }
 }
 
+void FftTest::testThreadedTransform3D() {
+   printMethod(TEST_FUNC);
+
+   RField<3> in;
+   RFieldDft<3> out;
+   IntVec<3> d;
+   d[0] = 8;
+   d[1] = 6;
+   d[2] = 10;
+   in.allocate(d);
+   out.allocate(d);
+
+   for (int i = 0; i < in.capacity(); ++i) {
+      in[i] = cos(0.1*double(i));
+   }
+
+   // Reference transform with one thread
+   TEST_ASSERT(FFT<3>::nThread() == 1);
+   RFieldDft<3> ref;
+   ref.allocate(d);
+   {
+      FFT<3> v;
+      v.setup(in, ref);
+      v.forwardTransform(in, ref);
+   }
+
+   // Transform with plans created for several threads
+   #ifdef PSCF_OPENMP
+   FFT<3>::setNThread(2);
+   TEST_ASSERT(FFT<3>::nThread() == 2);
+   #endif
+   FFT<3> v;
+   v.setup(in, out);
+   v.forwardTransform(in, out);
+   for (int i = 0; i < out.capacity(); ++i) {
+      TEST_ASSERT(eq(out[i][0], ref[i][0]));
+      TEST_ASSERT(eq(out[i][1], ref[i][1]));
+   }
+   RField<3> inCopy;
+   inCopy.allocate(d);
+   v.inverseTransform(out, inCopy);
+   for (int i = 0; i < in.capacity(); ++i) {
+      TEST_ASSERT(eq(in[i], inCopy[i]));
+   }
+   FFT<3>::setNThread(1);
+}
+
+void FftTest::testMeasuredTransform2D() {
+   printMethod(TEST_FUNC);
+
+   RField<2> in;
+   RFieldDft<2> out;
+   IntVec<2> d;
+   d[0] = 12;
+   d[1] = 9;
+   in.allocate(d);
+   out.allocate(d);
+
+   for (int i = 0; i < in.capacity(); ++i) {
+      in[i] = cos(0.2*double(i)) + 0.5;
+   }
+
+   // Reference transform with default (estimate) plans
+   TEST_ASSERT(FFT<2>::planFlags() == FFTW_ESTIMATE);
+   RFieldDft<2> ref;
+   ref.allocate(d);
+   {
+      FFT<2> v;
+      v.setup(in, ref);
+      v.forwardTransform(in, ref);
+   }
+
+   // Planning with FFTW_MEASURE must not overwrite input data
+   FFT<2>::setPlanRigor("measure");
+   TEST_ASSERT(FFT<2>::planFlags() == FFTW_MEASURE);
+   RField<2> inCopy;
+   inCopy.allocate(d);
+   inCopy = in;
+   FFT<2> v;
+   v.setup(in, out);
+   for (int i = 0; i < in.capacity(); ++i) {
+      TEST_ASSERT(eq(in[i], inCopy[i]));
+   }
+   v.forwardTransform(in, out);
+   for (int i = 0; i < out.capacity(); ++i) {
+      TEST_ASSERT(eq(out[i][0], ref[i][0]));
+      TEST_ASSERT(eq(out[i][1], ref[i][1]));
+   }
+   v.inverseTransform(out, inCopy);
+   for (int i = 0; i < in.capacity(); ++i) {
+      TEST_ASSERT(eq(in[i], inCopy[i]));
+   }
+
+   // Wisdom round trip
+   FFT<2>::writeWisdom("out/wisdom_12x9");
+   TEST_ASSERT(FFT<2>::readWisdom("out/wisdom_12x9"));
+   TEST_ASSERT(!FFT<2>::readWisdom("out/nonexistent"));
+
+   FFT<2>::setPlanRigor("estimate");
+}
+
 TEST_BEGIN(FftTest)
 TEST_ADD(FftTest, testConstructor)
 TEST_ADD(FftTest, testTransform1D)
 TEST_ADD(FftTest, testTransform2D)
 TEST_ADD(FftTest, testTransform3D)
+TEST_ADD(FftTest, testThreadedTransform3D)
+TEST_ADD(FftTest, testMeasuredTransform2D)
 TEST_END(FftTest)
 
 #endif
@@ -0,0 +1,176 @@
+/*
+* Benchmark for conversion between symmetry-adapted basis and k-grid.
+*
+* Usage:
+*
+*    FieldIoBench nRepeat nField groupName cellFile N[0] [N[1] [N[2]]]
+*
+* This program constructs a Basis for a mesh with dimensions N[0] x ...
+* x N[D-1], in which D is the number of mesh dimensions given, using the
+* space group groupName (a group name or group file name) and a unit cell
+* read from file cellFile. It reports the average wall clock time for
+* conversion of nField fields from basis to k-grid and back, using the
+* direct loop over stars used by FieldIo::convertBasisToKGridStars and
+* FieldIo::convertKGridToBasisStars, and using the precomputed maps used
+* by the FieldIo::convertBasisToKGrid and FieldIo::convertKGridToBasis
+* functions for arrays of fields, and the maximum difference between the
+* results of the two methods.
+*/
+
+#include <pspc/field/FieldIo.h>
+#include <pspc/field/FFT.h>
+#include <pspc/field/RFieldDft.h>
+
+#include <pscf/crystal/Basis.h>
+#include <pscf/crystal/UnitCell.h>
+#include <pscf/mesh/Mesh.h>
+
+#include <util/containers/DArray.h>
+#include <util/misc/FileMaster.h>
+#include <util/misc/Timer.h>
+#include <util/format/Int.h>
+#include <util/format/Dbl.h>
+#include <util/global.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+using namespace Util;
+using namespace Pscf;
+using namespace Pscf::Pspc;
+
+template <int D>
+void runBench(int nRepeat, int nField, std::string groupName,
+              std::string cellFileName, IntVec<D> const & dimensions)
+{
+   UnitCell<D> unitCell;
+   std::ifstream in(cellFileName.c_str());
+   UTIL_CHECK(in.is_open());
+   in >> unitCell;
+   in.close();
+
+   Mesh<D> mesh(dimensions);
+   Basis<D> basis;
+   basis.makeBasis(mesh, unitCell, groupName);
+   int nStar = basis.nStar();
+
+   FFT<D> fft;
+   FileMaster fileMaster;
+   FieldIo<D> fieldIo;
+   fieldIo.associate(unitCell, mesh, fft, groupName, basis, fileMaster);
+
+   DArray< DArray<double> > components;
+   DArray< DArray<double> > componentsAlt;
+   DArray< RFieldDft<D> > dfts;
+   DArray< RFieldDft<D> > dftsAlt;
+   components.allocate(nField);
+   componentsAlt.allocate(nField);
+   dfts.allocate(nField);
+   dftsAlt.allocate(nField);
+   int i, j, k;
+   for (k = 0; k < nField; ++k) {
+      components[k].allocate(nStar);
+      componentsAlt[k].allocate(nStar);
+      dfts[k].allocate(dimensions);
+      dftsAlt[k].allocate(dimensions);
+      for (i = 0; i < nStar; ++i) {
+         if (basis.star(i).cancel) {
+            components[k][i] = 0.0;
+         } else {
+            components[k][i] = cos(1.3*double(i) + double(k));
+         }
+      }
+   }
+
+   std::cout << "mesh   = " << dimensions << std::endl;
+   std::cout << "nStar  = " << nStar << std::endl;
+   std::cout << "nWave  = " << basis.nWave() << std::endl;
+   std::cout << "nField = " << nField << std::endl;
+
+   // Direct loop over stars, one field at a time
+   for (k = 0; k < nField; ++k) {
+      fieldIo.convertBasisToKGridStars(components[k], dftsAlt[k]);
+      fieldIo.convertKGridToBasisStars(dftsAlt[k], componentsAlt[k]);
+   }
+   Timer timer;
+   timer.start();
+   for (j = 0; j < nRepeat; ++j) {
+      for (k = 0; k < nField; ++k) {
+         fieldIo.convertBasisToKGridStars(components[k], dftsAlt[k]);
+         fieldIo.convertKGridToBasisStars(dftsAlt[k], componentsAlt[k]);
+      }
+   }
+   timer.stop();
+   double starTime = timer.time()/double(nRepeat);
+
+   // Precomputed maps, all fields at once (first call makes maps)
+   fieldIo.convertBasisToKGrid(components, dfts);
+   fieldIo.convertKGridToBasis(dfts, components);
+   timer.clear();
+   timer.start();
+   for (j = 0; j < nRepeat; ++j) {
+      fieldIo.convertBasisToKGrid(components, dfts);
+      fieldIo.convertKGridToBasis(dfts, components);
+   }
+   timer.stop();
+   double mapTime = timer.time()/double(nRepeat);
+
+   // Maximum differences between results of the two methods
+   double maxDiff = 0.0;
+   for (k = 0; k < nField; ++k) {
+      for (i = 0; i < dfts[k].capacity(); ++i) {
+         maxDiff = std::max(maxDiff,
+                            std::abs(dfts[k][i][0] - dftsAlt[k][i][0]));
+         maxDiff = std::max(maxDiff,
+                            std::abs(dfts[k][i][1] - dftsAlt[k][i][1]));
+      }
+      for (i = 0; i < nStar; ++i) {
+         maxDiff = std::max(maxDiff,
+                          std::abs(components[k][i] - componentsAlt[k][i]));
+      }
+   }
+
+   std::cout << "method      time [s]     speedup" << std::endl;
+   std::cout << "stars " << Dbl(starTime, 14, 4)
+             << Dbl(1.0, 12, 4) << std::endl;
+   std::cout << "maps  " << Dbl(mapTime, 14, 4)
+             << Dbl(starTime/mapTime, 12, 4) << std::endl;
+   std::cout << "max difference = " << maxDiff << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+   if (argc < 6 || argc > 8) {
+      std::cout << "Usage: FieldIoBench nRepeat nField groupName cellFile"
+                << " N[0] [N[1] [N[2]]]" << std::endl;
+      return 1;
+   }
+   int nRepeat = atoi(argv[1]);
+   int nField = atoi(argv[2]);
+   std::string groupName = argv[3];
+   std::string cellFileName = argv[4];
+   UTIL_CHECK(nRepeat > 0);
+   UTIL_CHECK(nField > 0);
+
+   int dim = argc - 5;
+   if (dim == 1) {
+      IntVec<1> d;
+      d[0] = atoi(argv[5]);
+      runBench<1>(nRepeat, nField, groupName, cellFileName, d);
+   } else
+   if (dim == 2) {
+      IntVec<2> d;
+      d[0] = atoi(argv[5]);
+      d[1] = atoi(argv[6]);
+      runBench<2>(nRepeat, nField, groupName, cellFileName, d);
+   } else {
+      IntVec<3> d;
+      d[0] = atoi(argv[5]);
+      d[1] = atoi(argv[6]);
+      d[2] = atoi(argv[7]);
+      runBench<3>(nRepeat, nField, groupName, cellFileName, d);
+   }
+   return 0;
+}
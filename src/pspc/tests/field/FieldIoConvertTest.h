@@ -0,0 +1,164 @@
+#ifndef PSPC_FIELD_IO_CONVERT_TEST_H
+#define PSPC_FIELD_IO_CONVERT_TEST_H
+
+#include <test/UnitTest.h>
+#include <test/UnitTestRunner.h>
+
+#include <pspc/field/FieldIo.h>
+#include <pspc/field/FFT.h>
+#include <pspc/field/RFieldDft.h>
+
+#include <pscf/crystal/Basis.h>
+#include <pscf/crystal/SpaceGroup.h>
+#include <pscf/crystal/UnitCell.h>
+#include <pscf/mesh/Mesh.h>
+
+#include <util/containers/DArray.h>
+#include <util/misc/FileMaster.h>
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+using namespace Util;
+using namespace Pscf;
+using namespace Pscf::Pspc;
+
+class FieldIoConvertTest : public UnitTest
+{
+
+public:
+
+   void setUp()
+   {}
+
+   void tearDown()
+   {}
+
+   /*
+   * Compare conversions by FieldIo maps to conversions by stars.
+   */
+   template <int D>
+   void checkConversion(Mesh<D>& mesh, UnitCell<D>& unitCell,
+                        std::string& groupName, Basis<D>& basis,
+                        int nField)
+   {
+      FFT<D> fft;
+      FileMaster fileMaster;
+      FieldIo<D> fieldIo;
+      fieldIo.associate(unitCell, mesh, fft, groupName, basis, fileMaster);
+
+      int nStar = basis.nStar();
+      DArray< DArray<double> > components;
+      DArray< DArray<double> > componentsAlt;
+      DArray< RFieldDft<D> > dfts;
+      RFieldDft<D> dftAlt;
+      DArray<double> componentAlt;
+      components.allocate(nField);
+      componentsAlt.allocate(nField);
+      dfts.allocate(nField);
+      dftAlt.allocate(mesh.dimensions());
+      componentAlt.allocate(nStar);
+      int i, k;
+      for (k = 0; k < nField; ++k) {
+         components[k].allocate(nStar);
+         componentsAlt[k].allocate(nStar);
+         dfts[k].allocate(mesh.dimensions());
+         for (i = 0; i < nStar; ++i) {
+            if (basis.star(i).cancel) {
+               components[k][i] = 0.0;
+            } else {
+               components[k][i] = cos(1.3*double(i) + double(k));
+            }
+         }
+      }
+
+      // Basis -> k-grid
+      fieldIo.convertBasisToKGrid(components, dfts);
+      for (k = 0; k < nField; ++k) {
+         fieldIo.convertBasisToKGridStars(components[k], dftAlt);
+         for (i = 0; i < dftAlt.capacity(); ++i) {
+            TEST_ASSERT(eq(dfts[k][i][0], dftAlt[i][0]));
+            TEST_ASSERT(eq(dfts[k][i][1], dftAlt[i][1]));
+         }
+      }
+
+      // K-grid -> basis
+      fieldIo.convertKGridToBasis(dfts, componentsAlt);
+      for (k = 0; k < nField; ++k) {
+         fieldIo.convertKGridToBasisStars(dfts[k], componentAlt);
+         for (i = 0; i < nStar; ++i) {
+            TEST_ASSERT(eq(componentsAlt[k][i], componentAlt[i]));
+         }
+      }
+
+      // Single field conversion
+      fieldIo.convertBasisToKGrid(components[0], dftAlt);
+      for (i = 0; i < dftAlt.capacity(); ++i) {
+         TEST_ASSERT(eq(dfts[0][i][0], dftAlt[i][0]));
+         TEST_ASSERT(eq(dfts[0][i][1], dftAlt[i][1]));
+      }
+      fieldIo.convertKGridToBasis(dftAlt, componentAlt);
+      for (i = 0; i < nStar; ++i) {
+         TEST_ASSERT(eq(componentsAlt[0][i], componentAlt[i]));
+      }
+   }
+
+   void testConvert2D()
+   {
+      printMethod(TEST_FUNC);
+
+      // Identity group, with pairs of stars related by inversion
+      UnitCell<2> unitCell;
+      std::istringstream cellIn("rectangular  4.2  4.8");
+      cellIn >> unitCell;
+
+      IntVec<2> d;
+      d[0] = 5;
+      d[1] = 6;
+      Mesh<2> mesh(d);
+
+      std::string groupName = "I";
+      Basis<2> basis;
+      basis.makeBasis(mesh, unitCell, groupName);
+      TEST_ASSERT(basis.isValid());
+
+      checkConversion(mesh, unitCell, groupName, basis, 3);
+   }
+
+   void testConvert3D()
+   {
+      printMethod(TEST_FUNC);
+
+      UnitCell<3> unitCell;
+      std::istringstream cellIn("cubic  4.0");
+      cellIn >> unitCell;
+
+      IntVec<3> d;
+      d[0] = 8;
+      d[1] = 8;
+      d[2] = 8;
+      Mesh<3> mesh(d);
+
+      SpaceGroup<3> group;
+      std::ifstream in;
+      openInputFile("in/I_m_-3_m", in);
+      in >> group;
+      in.close();
+
+      std::string groupName = "I_m_-3_m";
+      Basis<3> basis;
+      basis.makeBasis(mesh, unitCell, group);
+      TEST_ASSERT(basis.isValid());
+
+      checkConversion(mesh, unitCell, groupName, basis, 2);
+   }
+
+};
+
+TEST_BEGIN(FieldIoConvertTest)
+TEST_ADD(FieldIoConvertTest, testConvert2D)
+TEST_ADD(FieldIoConvertTest, testConvert3D)
+TEST_END(FieldIoConvertTest)
+
+#endif
@@ -56,6 +56,12 @@ void FieldTest::testAllocate()
       v.allocate(capacity);
       TEST_ASSERT(v.capacity() == capacity );
       TEST_ASSERT(v.isAllocated());
+      v.deallocate();
+      TEST_ASSERT(!v.isAllocated());
+      TEST_ASSERT(v.capacity() == 0 );
+      v.allocate(2*capacity);
+      TEST_ASSERT(v.capacity() == 2*capacity );
+      TEST_ASSERT(v.isAllocated());
    }
 } 
 
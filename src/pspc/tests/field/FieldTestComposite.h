@@ -7,6 +7,10 @@
 #include "RFieldTest.h"
 #include "RFieldDftTest.h"
 #include "FftTest.h"
+#include "FftBatchedTest.h"
+#include "FctTest.h"
+#include "FieldIoConvertTest.h"
+#include "GridSymmetrizerTest.h"
 //#include "FieldUtilTest.h"
 
 TEST_COMPOSITE_BEGIN(FieldTestComposite)
@@ -14,6 +18,10 @@ TEST_COMPOSITE_ADD_UNIT(FieldTest);
 TEST_COMPOSITE_ADD_UNIT(RFieldTest);
 TEST_COMPOSITE_ADD_UNIT(RFieldDftTest);
 TEST_COMPOSITE_ADD_UNIT(FftTest);
+TEST_COMPOSITE_ADD_UNIT(FftBatchedTest);
+TEST_COMPOSITE_ADD_UNIT(FctTest);
+TEST_COMPOSITE_ADD_UNIT(FieldIoConvertTest);
+TEST_COMPOSITE_ADD_UNIT(GridSymmetrizerTest);
 //TEST_COMPOSITE_ADD_UNIT(FieldUtilTest);
 TEST_COMPOSITE_END
 
@@ -0,0 +1,168 @@
+#ifndef PSPC_GRID_SYMMETRIZER_TEST_H
+#define PSPC_GRID_SYMMETRIZER_TEST_H
+
+#include <test/UnitTest.h>
+#include <test/UnitTestRunner.h>
+
+#include <pspc/field/GridSymmetrizer.h>
+#include <pspc/field/FieldIo.h>
+#include <pspc/field/FFT.h>
+#include <pspc/field/RField.h>
+
+#include <pscf/crystal/Basis.h>
+#include <pscf/crystal/SpaceGroup.h>
+#include <pscf/crystal/UnitCell.h>
+#include <pscf/mesh/Mesh.h>
+
+#include <util/containers/DArray.h>
+#include <util/misc/FileMaster.h>
+
+#include <cmath>
+#include <sstream>
+
+using namespace Util;
+using namespace Pscf;
+using namespace Pscf::Pspc;
+
+class GridSymmetrizerTest : public UnitTest
+{
+
+public:
+
+   void setUp()
+   {}
+
+   void tearDown()
+   {}
+
+   /*
+   * Check that orbit averages yield fields invariant under the group.
+   *
+   * An arbitrary r-grid field is symmetrized, then converted to the
+   * symmetry-adapted basis and back, which must leave it unchanged.
+   */
+   template <int D>
+   void checkProjection(Mesh<D>& mesh, UnitCell<D>& unitCell,
+                        std::string groupName)
+   {
+      SpaceGroup<D> group;
+      readGroup(groupName, group);
+
+      GridSymmetrizer<D> symmetrizer;
+      symmetrizer.setup(group, mesh);
+      TEST_ASSERT(symmetrizer.isSetup());
+      TEST_ASSERT(symmetrizer.meshSize() == mesh.size());
+
+      Basis<D> basis;
+      basis.makeBasis(mesh, unitCell, group);
+      TEST_ASSERT(basis.isValid());
+
+      FFT<D> fft;
+      FileMaster fileMaster;
+      FieldIo<D> fieldIo;
+      fieldIo.associate(unitCell, mesh, fft, groupName, basis, 
+                        fileMaster);
+
+      int n = mesh.size();
+      DArray< RField<D> > fields, projections;
+      DArray< DArray<double> > components;
+      fields.allocate(1);
+      projections.allocate(1);
+      components.allocate(1);
+      fields[0].allocate(mesh.dimensions());
+      projections[0].allocate(mesh.dimensions());
+      components[0].allocate(basis.nStar());
+      RField<D>& field = fields[0];
+      RField<D>& projection = projections[0];
+      for (int i = 0; i < n; ++i) {
+         field[i] = cos(0.7*double(i)) + 0.1*double(i % 5);
+      }
+
+      // Conversion to a basis requires an invariant field
+      symmetrizer.symmetrize(field);
+      fieldIo.convertRGridToBasis(fields, components);
+      fieldIo.convertBasisToRGrid(components, projections);
+      for (int i = 0; i < n; ++i) {
+         TEST_ASSERT(std::abs(field[i] - projection[i]) < 1.0E-8);
+      }
+
+      // Symmetrizing an invariant field leaves it unchanged
+      symmetrizer.symmetrize(projection);
+      for (int i = 0; i < n; ++i) {
+         TEST_ASSERT(std::abs(field[i] - projection[i]) < 1.0E-8);
+      }
+   }
+
+   void testSetup1D()
+   {
+      printMethod(TEST_FUNC);
+
+      IntVec<1> d;
+      d[0] = 8;
+      Mesh<1> mesh(d);
+
+      SpaceGroup<1> group;
+      readGroup("P_-1", group);
+
+      GridSymmetrizer<1> symmetrizer;
+      TEST_ASSERT(!symmetrizer.isSetup());
+      symmetrizer.setup(group, mesh);
+
+      // Orbits {0}, {4}, {1,7}, {2,6} and {3,5}
+      TEST_ASSERT(symmetrizer.nOrbit() == 5);
+
+      RField<1> field;
+      field.allocate(d);
+      for (int i = 0; i < 8; ++i) {
+         field[i] = double(i);
+      }
+      symmetrizer.symmetrize(field);
+      TEST_ASSERT(eq(field[0], 0.0));
+      TEST_ASSERT(eq(field[4], 4.0));
+      TEST_ASSERT(eq(field[1], 4.0));
+      TEST_ASSERT(eq(field[7], 4.0));
+      TEST_ASSERT(eq(field[3], 4.0));
+   }
+
+   void testProjection2D()
+   {
+      printMethod(TEST_FUNC);
+
+      UnitCell<2> unitCell;
+      std::istringstream cellIn("hexagonal  1.7");
+      cellIn >> unitCell;
+
+      IntVec<2> d;
+      d[0] = 12;
+      d[1] = 12;
+      Mesh<2> mesh(d);
+
+      checkProjection(mesh, unitCell, "p_6_m_m");
+   }
+
+   void testProjection3D()
+   {
+      printMethod(TEST_FUNC);
+
+      UnitCell<3> unitCell;
+      std::istringstream cellIn("cubic  4.0");
+      cellIn >> unitCell;
+
+      IntVec<3> d;
+      d[0] = 8;
+      d[1] = 8;
+      d[2] = 8;
+      Mesh<3> mesh(d);
+
+      checkProjection(mesh, unitCell, "I_m_-3_m");
+   }
+
+};
+
+TEST_BEGIN(GridSymmetrizerTest)
+TEST_ADD(GridSymmetrizerTest, testSetup1D)
+TEST_ADD(GridSymmetrizerTest, testProjection2D)
+TEST_ADD(GridSymmetrizerTest, testProjection3D)
+TEST_END(GridSymmetrizerTest)
+
+#endif
@@ -14,6 +14,12 @@
 #include <util/math/Constants.h>
 
 #include <fstream>
+#include <sstream>
+#include <cmath>
+
+#ifdef PSCF_OPENMP
+#include <omp.h>
+#endif
 
 using namespace Util;
 using namespace Pscf;
@@ -377,6 +383,323 @@ public:
  
    }
 
+   void testSolverStarThreaded1D()
+   {
+      printMethod(TEST_FUNC);
+
+      // Without OpenMP, both solutions would be computed serially
+      #ifdef PSCF_OPENMP
+      Mixture<1> mixture;
+
+      std::ifstream in;
+      openInputFile("in/MixtureStar", in);
+      mixture.readParam(in);
+      UnitCell<1> unitCell;
+      in >> unitCell;
+      IntVec<1> d;
+      in >> d;
+      in.close();
+
+      Mesh<1> mesh;
+      mesh.setDimensions(d);
+      mixture.setMesh(mesh);
+      mixture.setupUnitCell(unitCell);
+
+      int nMonomer = mixture.nMonomer();
+      DArray<Mixture<1>::WField> wFields;
+      DArray<Mixture<1>::CField> cFields;
+      DArray<Mixture<1>::CField> cFieldsRef;
+      wFields.allocate(nMonomer);
+      cFields.allocate(nMonomer);
+      cFieldsRef.allocate(nMonomer);
+      int nx = mesh.size();
+      for (int i = 0; i < nMonomer; ++i) {
+         wFields[i].allocate(nx);
+         cFields[i].allocate(nx);
+         cFieldsRef[i].allocate(nx);
+      }
+      double cs;
+      for (int i = 0; i < nx; ++i) {
+         cs = cos(2.0*Constants::Pi*double(i)/double(nx));
+         wFields[0][i] = 0.5 + cs;
+         wFields[1][i] = 0.5 - cs;
+      }
+
+      // Reference solution, solving propagators in sequence
+      int nThreadSave = omp_get_max_threads();
+      omp_set_num_threads(1);
+      mixture.compute(wFields, cFields);
+      for (int i = 0; i < nMonomer; ++i) {
+         cFieldsRef[i] = cFields[i];
+      }
+
+      // Solution with concurrent solution of arm propagators
+      omp_set_num_threads(3);
+      mixture.compute(wFields, cFields);
+      omp_set_num_threads(nThreadSave);
+
+      for (int i = 0; i < nMonomer; ++i) {
+         for (int j = 0; j < nx; ++j) {
+            TEST_ASSERT(eq(cFields[i][j], cFieldsRef[i][j]));
+         }
+      }
+
+      // Test if same Q is obtained from all propagators
+      Polymer<1>& polymer = mixture.polymer(0);
+
+      // Identical arm blocks share Boltzmann factor tables
+      TEST_ASSERT(polymer.block(0).ownsTables());
+      TEST_ASSERT(polymer.block(1).ownsTables());
+      TEST_ASSERT(!polymer.block(2).ownsTables());
+
+      double Q = polymer.propagator(0, 0).computeQ();
+      for (int i = 0; i < polymer.nBlock(); ++i) {
+         TEST_ASSERT(eq(Q, polymer.propagator(i, 0).computeQ()));
+         TEST_ASSERT(eq(Q, polymer.propagator(i, 1).computeQ()));
+      }
+      #endif
+   }
+
+   void testSolverCheckpoint2D()
+   {
+      printMethod(TEST_FUNC);
+
+      // Reference mixture with full propagator storage
+      Mixture<2> mixtureRef;
+      std::ifstream in;
+      openInputFile("in/Mixture2d", in);
+      mixtureRef.readParam(in);
+      UnitCell<2> unitCell;
+      in >> unitCell;
+      IntVec<2> d;
+      in >> d;
+      in.close();
+
+      // Identical mixture with checkpointed propagator storage
+      Mixture<2> mixture;
+      openInputFile("in/Mixture2dCheckpoint", in);
+      mixture.readParam(in);
+      in.close();
+      TEST_ASSERT(mixtureRef.checkpointInterval() == 1);
+      TEST_ASSERT(mixture.checkpointInterval() == 7);
+
+      Mesh<2> mesh;
+      mesh.setDimensions(d);
+      mixtureRef.setMesh(mesh);
+      mixtureRef.setupUnitCell(unitCell);
+      mixture.setMesh(mesh);
+      mixture.setupUnitCell(unitCell);
+
+      Propagator<2> const & p = mixture.polymer(0).propagator(0, 0);
+      TEST_ASSERT(p.isCheckpointed());
+      TEST_ASSERT(!mixture.polymer(0).propagator(0, 1).isCheckpointed());
+      double memoryFull = mixture.polymer(0).propagator(0, 1).memory();
+      TEST_ASSERT(2.0*p.memory() < memoryFull);
+
+      int nMonomer = mixture.nMonomer();
+      DArray<Mixture<2>::WField> wFields;
+      DArray<Mixture<2>::CField> cFields;
+      DArray<Mixture<2>::CField> cFieldsRef;
+      wFields.allocate(nMonomer);
+      cFields.allocate(nMonomer);
+      cFieldsRef.allocate(nMonomer);
+      int nx = mesh.size();
+      for (int i = 0; i < nMonomer; ++i) {
+         wFields[i].allocate(nx);
+         cFields[i].allocate(nx);
+         cFieldsRef[i].allocate(nx);
+      }
+
+      // Generate oscillatory wField
+      int dx = mesh.dimension(0);
+      int dy = mesh.dimension(1);
+      double fx = 2.0*Constants::Pi/double(dx);
+      double fy = 2.0*Constants::Pi/double(dy);
+      double cx, cy;
+      int k = 0;
+      for (int i = 0; i < dx; ++i) {
+         cx = cos(fx*double(i));
+         for (int j = 0; j < dy; ++j) {
+            cy = cos(fy*double(j));
+            wFields[0][k] = 0.5 + cx + cy;
+            wFields[1][k] = 0.5 - cx - cy;
+            ++k;
+         }
+      }
+
+      mixtureRef.compute(wFields, cFieldsRef);
+      mixture.compute(wFields, cFields);
+      for (int i = 0; i < nMonomer; ++i) {
+         for (int j = 0; j < nx; ++j) {
+            TEST_ASSERT(eq(cFields[i][j], cFieldsRef[i][j]));
+         }
+      }
+
+      // Stored tail and partition function are unchanged
+      double Q = mixtureRef.polymer(0).propagator(0, 0).computeQ();
+      TEST_ASSERT(eq(Q, mixture.polymer(0).propagator(0, 0).computeQ()));
+      TEST_ASSERT(eq(Q, mixture.polymer(0).propagator(1, 1).computeQ()));
+
+      mixtureRef.computeStress();
+      mixture.computeStress();
+      for (int i = 0; i < unitCell.nParameter(); ++i) {
+         TEST_ASSERT(eq(mixture.stress(i), mixtureRef.stress(i)));
+      }
+
+      #if 0
+      mixture.writeStorageReport(std::cout);
+      #endif
+   }
+
+   void testSolverAccumulate2D()
+   {
+      printMethod(TEST_FUNC);
+
+      Mixture<2> mixture;
+      std::ifstream in;
+      openInputFile("in/Mixture2d", in);
+      mixture.readParam(in);
+      UnitCell<2> unitCell;
+      in >> unitCell;
+      in.close();
+
+      // Use a mesh with more than one tile of grid points
+      IntVec<2> d;
+      d[0] = 32;
+      d[1] = 24;
+      Mesh<2> mesh;
+      mesh.setDimensions(d);
+      mixture.setMesh(mesh);
+      mixture.setupUnitCell(unitCell);
+
+      int nMonomer = mixture.nMonomer();
+      DArray<Mixture<2>::WField> wFields;
+      DArray<Mixture<2>::CField> cFields;
+      DArray<Mixture<2>::CField> cFieldsRef;
+      wFields.allocate(nMonomer);
+      cFields.allocate(nMonomer);
+      cFieldsRef.allocate(nMonomer);
+      int nx = mesh.size();
+      for (int i = 0; i < nMonomer; ++i) {
+         wFields[i].allocate(nx);
+         cFields[i].allocate(nx);
+         cFieldsRef[i].allocate(nx);
+      }
+
+      // Generate oscillatory wField
+      double fx = 2.0*Constants::Pi/double(d[0]);
+      double fy = 2.0*Constants::Pi/double(d[1]);
+      double cx, cy;
+      int i, j, k;
+      k = 0;
+      for (i = 0; i < d[0]; ++i) {
+         cx = cos(fx*double(i));
+         for (j = 0; j < d[1]; ++j) {
+            cy = cos(fy*double(j));
+            wFields[0][k] = 0.5 + cx + cy;
+            wFields[1][k] = 0.5 - cx - cy;
+            ++k;
+         }
+      }
+
+      // Concentrations accumulated directly into monomer fields
+      mixture.compute(wFields, cFields);
+
+      // Sum of block concentration fields computed by Polymer::compute
+      Polymer<2>& polymer = mixture.polymer(0);
+      polymer.compute(wFields);
+      for (i = 0; i < nMonomer; ++i) {
+         for (k = 0; k < nx; ++k) {
+            cFieldsRef[i][k] = 0.0;
+         }
+      }
+      int monomerId;
+      for (j = 0; j < polymer.nBlock(); ++j) {
+         monomerId = polymer.block(j).monomerId();
+         for (k = 0; k < nx; ++k) {
+            cFieldsRef[monomerId][k] += polymer.block(j).cField()[k];
+         }
+      }
+
+      double sum = 0.0;
+      for (i = 0; i < nMonomer; ++i) {
+         for (k = 0; k < nx; ++k) {
+            TEST_ASSERT(eq(cFields[i][k], cFieldsRef[i][k]));
+            sum += cFields[i][k];
+         }
+      }
+
+      // Spatial average of total concentration equals phi = 1
+      TEST_ASSERT(std::abs(sum/double(nx) - 1.0) < 1.0E-8);
+   }
+
+   void testStressUnitCellChange2D()
+   {
+      printMethod(TEST_FUNC);
+
+      Mixture<2> mixture;
+      Mixture<2> mixtureRef;
+      std::ifstream in;
+      openInputFile("in/Mixture2d", in);
+      mixture.readParam(in);
+      UnitCell<2> unitCell;
+      in >> unitCell;
+      IntVec<2> d;
+      in >> d;
+      in.close();
+      openInputFile("in/Mixture2d", in);
+      mixtureRef.readParam(in);
+      in.close();
+
+      // Modified unit cell
+      UnitCell<2> unitCell2;
+      std::istringstream cellIn("rectangular 4.2 4.8");
+      cellIn >> unitCell2;
+
+      Mesh<2> mesh;
+      mesh.setDimensions(d);
+      mixture.setMesh(mesh);
+      mixture.setupUnitCell(unitCell);
+      mixtureRef.setMesh(mesh);
+      mixtureRef.setupUnitCell(unitCell2);
+
+      int nMonomer = mixture.nMonomer();
+      DArray<Mixture<2>::WField> wFields;
+      DArray<Mixture<2>::CField> cFields;
+      wFields.allocate(nMonomer);
+      cFields.allocate(nMonomer);
+      int nx = mesh.size();
+      for (int i = 0; i < nMonomer; ++i) {
+         wFields[i].allocate(nx);
+         cFields[i].allocate(nx);
+      }
+      double fx = 2.0*Constants::Pi/double(d[0]);
+      int k = 0;
+      for (int i = 0; i < d[0]; ++i) {
+         for (int j = 0; j < d[1]; ++j) {
+            wFields[0][k] = 0.5 + cos(fx*double(i));
+            wFields[1][k] = 0.5 - cos(fx*double(i));
+            ++k;
+         }
+      }
+
+      // Compute stress in original cell, then change cell
+      mixture.compute(wFields, cFields);
+      mixture.computeStress();
+      double stress0 = mixture.stress(0);
+      mixture.setupUnitCell(unitCell2);
+      mixture.compute(wFields, cFields);
+      mixture.computeStress();
+
+      // Compare to mixture that was only used in modified cell
+      mixtureRef.compute(wFields, cFields);
+      mixtureRef.computeStress();
+      TEST_ASSERT(!eq(stress0, mixtureRef.stress(0)));
+      for (int i = 0; i < unitCell2.nParameter(); ++i) {
+         TEST_ASSERT(eq(mixture.stress(i), mixtureRef.stress(i)));
+      }
+   }
+
 };
 
 TEST_BEGIN(MixtureTest)
@@ -386,6 +709,10 @@ TEST_ADD(MixtureTest, testSolver1D)
 TEST_ADD(MixtureTest, testSolver2D)
 TEST_ADD(MixtureTest, testSolver2D_hex)
 TEST_ADD(MixtureTest, testSolver3D)
+TEST_ADD(MixtureTest, testSolverStarThreaded1D)
+TEST_ADD(MixtureTest, testSolverCheckpoint2D)
+TEST_ADD(MixtureTest, testSolverAccumulate2D)
+TEST_ADD(MixtureTest, testStressUnitCellChange2D)
 TEST_END(MixtureTest)
 
 #endif
@@ -7,6 +7,7 @@
 #include <pspc/solvers/Block.h>
 #include <pscf/mesh/MeshIterator.h>
 #include <pspc/solvers/Propagator.h>
+#include <pspc/solvers/WaveList.h>
 #include <pscf/mesh/Mesh.h>
 #include <pscf/crystal/UnitCell.h>
 #include <pscf/math/IntVec.h>
@@ -111,6 +112,15 @@ public:
       in.close();
    }
 
+   template <int D>
+   void setupWaveList(WaveList<D>& waveList, Mesh<D> const & mesh, 
+                      UnitCell<D> const & unitCell)
+   {
+      waveList.allocate(mesh);
+      waveList.computeMinimumImages(unitCell);
+      waveList.computeKSq(unitCell);
+   }
+
    void testSetDiscretization1D()
    {
       printMethod(TEST_FUNC);
@@ -210,7 +220,9 @@ public:
          w[i] = 1.0;
       }
 
-      block.setupUnitCell(unitCell);
+      WaveList<1> waveList;
+      setupWaveList(waveList, mesh, unitCell);
+      block.setupUnitCell(unitCell, waveList);
       block.setupSolver(w);
    }
    
@@ -244,7 +256,9 @@ public:
          w[i] = 1.0;
       }
 
-      block.setupUnitCell(unitCell);
+      WaveList<2> waveList;
+      setupWaveList(waveList, mesh, unitCell);
+      block.setupUnitCell(unitCell, waveList);
       block.setupSolver(w);
    }
 
@@ -279,7 +293,9 @@ public:
          w[i] = 1.0;
       }
 
-      block.setupUnitCell(unitCell);
+      WaveList<3> waveList;
+      setupWaveList(waveList, mesh, unitCell);
+      block.setupUnitCell(unitCell, waveList);
       block.setupSolver(w);
    }
 
@@ -313,7 +329,9 @@ public:
          w[i] = wc;
       }
 
-      block.setupUnitCell(unitCell);
+      WaveList<1> waveList;
+      setupWaveList(waveList, mesh, unitCell);
+      block.setupUnitCell(unitCell, waveList);
       block.setupSolver(w);
 
       // Test step
@@ -399,7 +417,9 @@ public:
          w[i] = wc;
       }
 
-      block.setupUnitCell(unitCell);
+      WaveList<2> waveList;
+      setupWaveList(waveList, mesh, unitCell);
+      block.setupUnitCell(unitCell, waveList);
       block.setupSolver(w);
 
       // Test step
@@ -496,7 +516,9 @@ public:
          w[i] = wc;
       }
 
-      block.setupUnitCell(unitCell);
+      WaveList<3> waveList;
+      setupWaveList(waveList, mesh, unitCell);
+      block.setupUnitCell(unitCell, waveList);
       block.setupSolver(w);
 
       // Test step
@@ -560,6 +582,110 @@ public:
 
    }
 
+   void testShareTables2D()
+   {
+      printMethod(TEST_FUNC);
+
+      // Two identical blocks, and one with a different length
+      Block<2> owner, shared, other;
+      setupBlock2D(owner);
+      setupBlock2D(shared);
+      setupBlock2D(other);
+      other.setLength(3.0);
+
+      Mesh<2> mesh;
+      setupMesh2D(mesh);
+      double ds = 0.02;
+      owner.setDiscretization(ds, mesh);
+      shared.setDiscretization(ds, mesh);
+      other.setDiscretization(ds, mesh);
+
+      TEST_ASSERT(owner.ownsTables());
+      TEST_ASSERT(shared.canShareTables(owner));
+      TEST_ASSERT(eq(other.ds(), owner.ds()));
+      other.setKuhn(1.0);
+      TEST_ASSERT(!other.canShareTables(owner));
+      shared.shareTables(owner);
+      TEST_ASSERT(!shared.ownsTables());
+      TEST_ASSERT(!owner.canShareTables(shared));
+
+      UnitCell<2> unitCell;
+      setupUnitCell2D(unitCell);
+      WaveList<2> waveList;
+      setupWaveList(waveList, mesh, unitCell);
+
+      // Nonuniform w field
+      RField<2> w;
+      w.allocate(mesh.dimensions());
+      MeshIterator<2> iter(mesh.dimensions());
+      double twoPi = 2.0*Constants::Pi;
+      for (iter.begin(); !iter.atEnd(); ++iter){
+         w[iter.rank()] = 0.5 + cos(twoPi*double(iter.position(0))
+                                    /double(mesh.dimension(0)));
+      }
+
+      // Owner must be set up first
+      owner.setupUnitCell(unitCell, waveList);
+      owner.setupSolver(w);
+      shared.setupUnitCell(unitCell, waveList);
+      shared.setupSolver(w);
+
+      owner.propagator(0).solve();
+      shared.propagator(0).solve();
+      for (int i = 0; i < mesh.size(); ++i) {
+         TEST_ASSERT(eq(owner.propagator(0).tail()[i], 
+                        shared.propagator(0).tail()[i]));
+      }
+   }
+
+   void testSolverCosine2D()
+   {
+      printMethod(TEST_FUNC);
+
+      // Identical blocks, using r2c and cosine transforms
+      Block<2> block, cosine;
+      setupBlock2D(block);
+      setupBlock2D(cosine);
+      cosine.setCosineTransform(true);
+      TEST_ASSERT(cosine.hasCosineTransform());
+
+      Mesh<2> mesh;
+      setupMesh2D(mesh);
+      double ds = 0.02;
+      block.setDiscretization(ds, mesh);
+      cosine.setDiscretization(ds, mesh);
+      TEST_ASSERT(!cosine.canShareTables(block));
+
+      UnitCell<2> unitCell;
+      setupUnitCell2D(unitCell);
+      WaveList<2> waveList;
+      setupWaveList(waveList, mesh, unitCell);
+
+      // W field that is even in each coordinate
+      RField<2> w;
+      w.allocate(mesh.dimensions());
+      MeshIterator<2> iter(mesh.dimensions());
+      double twoPi = 2.0*Constants::Pi;
+      double x, y;
+      for (iter.begin(); !iter.atEnd(); ++iter){
+         x = twoPi*double(iter.position(0))/double(mesh.dimension(0));
+         y = twoPi*double(iter.position(1))/double(mesh.dimension(1));
+         w[iter.rank()] = 0.5 + cos(x)*cos(y) + 0.3*cos(2.0*y);
+      }
+
+      block.setupUnitCell(unitCell, waveList);
+      block.setupSolver(w);
+      cosine.setupUnitCell(unitCell, waveList);
+      cosine.setupSolver(w);
+
+      block.propagator(0).solve();
+      cosine.propagator(0).solve();
+      for (int i = 0; i < mesh.size(); ++i) {
+         TEST_ASSERT(eq(block.propagator(0).tail()[i],
+                        cosine.propagator(0).tail()[i]));
+      }
+   }
+
 };
 
 TEST_BEGIN(PropagatorTest)
@@ -571,6 +697,8 @@ TEST_ADD(PropagatorTest, testSetupSolver3D)
 TEST_ADD(PropagatorTest, testSolver1D)
 TEST_ADD(PropagatorTest, testSolver2D)
 TEST_ADD(PropagatorTest, testSolver3D)
+TEST_ADD(PropagatorTest, testShareTables2D)
+TEST_ADD(PropagatorTest, testSolverCosine2D)
 TEST_END(PropagatorTest)
 
 #endif
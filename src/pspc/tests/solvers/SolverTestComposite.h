@@ -3,10 +3,12 @@
 
 #include <test/CompositeTestRunner.h>
 
+#include "WaveListTest.h"
 #include "PropagatorTest.h"
 #include "MixtureTest.h"
 
 TEST_COMPOSITE_BEGIN(SolverTestComposite)
+TEST_COMPOSITE_ADD_UNIT(WaveListTest);
 TEST_COMPOSITE_ADD_UNIT(PropagatorTest);
 TEST_COMPOSITE_ADD_UNIT(MixtureTest);
 TEST_COMPOSITE_END
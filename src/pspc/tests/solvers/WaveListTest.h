@@ -0,0 +1,145 @@
+#ifndef PSPC_WAVE_LIST_TEST_H
+#define PSPC_WAVE_LIST_TEST_H
+
+#include <test/UnitTest.h>
+#include <test/UnitTestRunner.h>
+
+#include <pspc/solvers/WaveList.h>
+#include <pscf/mesh/Mesh.h>
+#include <pscf/mesh/MeshIterator.h>
+#include <pscf/crystal/UnitCell.h>
+#include <pscf/crystal/shiftToMinimum.h>
+#include <pscf/math/IntVec.h>
+
+#include <fstream>
+#include <sstream>
+
+using namespace Util;
+using namespace Pscf;
+using namespace Pscf::Pspc;
+
+class WaveListTest : public UnitTest
+{
+
+public:
+
+   void setUp()
+   {}
+
+   void tearDown()
+   {}
+
+   /*
+   * Compare WaveList values to direct evaluation with UnitCell.
+   */
+   template <int D>
+   void checkWaveList(WaveList<D> const & waveList, Mesh<D> const & mesh,
+                      UnitCell<D> const & unitCell)
+   {
+      IntVec<D> const & kDimensions = waveList.kMeshDimensions();
+      MeshIterator<D> iter;
+      iter.setDimensions(kDimensions);
+      IntVec<D> G, Gmin, partner;
+      double factor;
+      int i, n, p;
+      for (iter.begin(); !iter.atEnd(); ++iter) {
+         i = iter.rank();
+         G = iter.position();
+         Gmin = shiftToMinimum(G, mesh.dimensions(), unitCell);
+         TEST_ASSERT(Gmin == waveList.minImage(i));
+         TEST_ASSERT(eq(waveList.kSq()[i], unitCell.ksq(Gmin)));
+
+         for (p = 0; p < D; ++p) {
+            partner[p] = (G[p] != 0) ? mesh.dimension(p) - G[p] : 0;
+         }
+         factor = (partner[D-1] > kDimensions[D-1]) ? 2.0 : 1.0;
+         for (n = 0; n < unitCell.nParameter(); ++n) {
+            TEST_ASSERT(eq(waveList.dKSq()(i, n),
+                           factor*unitCell.dksq(Gmin, n)));
+         }
+      }
+   }
+
+   void testConstructor()
+   {
+      printMethod(TEST_FUNC);
+
+      WaveList<3> waveList;
+      TEST_ASSERT(!waveList.isAllocated());
+      TEST_ASSERT(!waveList.hasMinimumImages());
+      TEST_ASSERT(!waveList.hasKSq());
+      TEST_ASSERT(!waveList.hasdKSq());
+   }
+
+   void testHexagonal2D()
+   {
+      printMethod(TEST_FUNC);
+
+      IntVec<2> d;
+      d[0] = 12;
+      d[1] = 12;
+      Mesh<2> mesh;
+      mesh.setDimensions(d);
+
+      UnitCell<2> unitCell;
+      std::istringstream cellIn("hexagonal  3.0");
+      cellIn >> unitCell;
+
+      WaveList<2> waveList;
+      waveList.allocate(mesh);
+      TEST_ASSERT(waveList.isAllocated());
+      TEST_ASSERT(waveList.kSize() == 12*7);
+      waveList.computeMinimumImages(unitCell);
+      waveList.computeKSq(unitCell);
+      TEST_ASSERT(waveList.hasKSq());
+      TEST_ASSERT(!waveList.hasdKSq());
+      waveList.computedKSq(unitCell);
+      TEST_ASSERT(waveList.hasdKSq());
+      checkWaveList(waveList, mesh, unitCell);
+   }
+
+   void testOrthorhombic3D()
+   {
+      printMethod(TEST_FUNC);
+
+      IntVec<3> d;
+      d[0] = 6;
+      d[1] = 8;
+      d[2] = 10;
+      Mesh<3> mesh;
+      mesh.setDimensions(d);
+
+      UnitCell<3> unitCell;
+      std::ifstream in;
+      openInputFile("in/Orthorhombic", in);
+      in >> unitCell;
+      in.close();
+
+      WaveList<3> waveList;
+      waveList.allocate(mesh);
+      TEST_ASSERT(waveList.kSize() == 6*8*6);
+      waveList.computeMinimumImages(unitCell);
+      waveList.computeKSq(unitCell);
+      waveList.computedKSq(unitCell);
+      checkWaveList(waveList, mesh, unitCell);
+
+      // Update values for a slightly different cell, without
+      // recomputing minimum images
+      UnitCell<3> unitCell2;
+      std::istringstream cellIn("orthorhombic  3.1   3.9   5.2");
+      cellIn >> unitCell2;
+      waveList.computeKSq(unitCell2);
+      TEST_ASSERT(!waveList.hasdKSq());
+      waveList.computedKSq(unitCell2);
+      checkWaveList(waveList, mesh, unitCell2);
+   }
+
+};
+
+TEST_BEGIN(WaveListTest)
+TEST_ADD(WaveListTest, testConstructor)
+TEST_ADD(WaveListTest, testHexagonal2D)
+TEST_ADD(WaveListTest, testOrthorhombic3D)
+TEST_END(WaveListTest)
+
+#endif
@@ -6,10 +6,14 @@
 
 #include <pspc/System.h>
 #include <pspc/iterator/AmIterator.h>
+#include <pspc/sweep/Sweep.h>
+#include <pscf/math/continuation.h>
+#include <pscf/inter/ChiInteraction.h>
 #include <pscf/mesh/MeshIterator.h>
 //#include <util/format/Dbl.h>
 
 #include <fstream>
+#include <sstream>
 
 using namespace Util;
 using namespace Pscf;
@@ -609,6 +613,349 @@ public:
    }
 
 
+   /*
+   * Compare solutions of the MDE with single and double precision
+   * storage of propagators, for the same w fields.
+   */
+   template <int D>
+   void compareSinglePrecision(std::string const & name)
+   {
+      std::string prefix = "in/precision/";
+      std::ifstream in;
+
+      System<D> ref;
+      openInputFile(prefix + "param_" + name, in);
+      ref.readParam(in);
+      in.close();
+      openInputFile(prefix + "Solve_" + name, in);
+      ref.readCommands(in);
+      in.close();
+      ref.mixture().computeStress();
+      ref.computeFreeEnergy();
+
+      System<D> single;
+      openInputFile(prefix + "param_" + name + "_single", in);
+      single.readParam(in);
+      in.close();
+      TEST_ASSERT(single.mixture().isSinglePrecision());
+      openInputFile(prefix + "Solve_" + name, in);
+      single.readCommands(in);
+      in.close();
+      single.mixture().computeStress();
+      single.computeFreeEnergy();
+
+      // Concentration fields
+      int nMonomer = ref.mixture().nMonomer();
+      int nx = ref.mesh().size();
+      double diff, maxDiff = 0.0;
+      for (int i = 0; i < nMonomer; ++i) {
+         for (int j = 0; j < nx; ++j) {
+            diff = std::abs(ref.cFieldRGrid(i)[j] 
+                            - single.cFieldRGrid(i)[j]);
+            if (diff > maxDiff) maxDiff = diff;
+         }
+      }
+      TEST_ASSERT(maxDiff < 1.0E-6);
+
+      // Stress and free energy
+      int nParameter = ref.unitCell().nParameter();
+      for (int i = 0; i < nParameter; ++i) {
+         diff = std::abs(ref.mixture().stress(i) 
+                         - single.mixture().stress(i));
+         TEST_ASSERT(diff < 1.0E-7);
+      }
+      diff = std::abs(ref.fHelmholtz() - single.fHelmholtz());
+      TEST_ASSERT(diff < 1.0E-7);
+
+      #if 0
+      std::cout << std::endl << "max |dc| = " << maxDiff 
+                << "  |df| = " << diff << std::endl;
+      #endif
+   }
+
+   /*
+   * Iterate from the chi = 12 lamellar solution with chi = 12.5.
+   */
+   void iterateChiStep1D(char const * paramFileName, System<1>& system)
+   {
+      std::ifstream in;
+      openInputFile(paramFileName, in);
+      system.readParam(in);
+      in.close();
+
+      std::ifstream command;
+      openInputFile("in/domainOff/ReadOmega_lam", command);
+      system.readCommands(command);
+      command.close();
+
+      system.interaction().setChi(0, 1, 12.5);
+      TEST_ASSERT(system.iterator().solve() == 0);
+      TEST_ASSERT(system.iterator().nIteration() > 1);
+   }
+
+   void testIterate1D_lam_rgrid()
+   {
+      printMethod(TEST_FUNC);
+      openLogFile("out/testIterate1D_lam_rgrid.log");
+
+      System<1> basisSystem;
+      iterateChiStep1D("in/domainOff/System1D", basisSystem);
+      TEST_ASSERT(basisSystem.iterator().useBasis());
+
+      System<1> gridSystem;
+      iterateChiStep1D("in/domainOff/System1D_rgrid", gridSystem);
+      TEST_ASSERT(!gridSystem.iterator().useBasis());
+
+      // Compare basis components of the two solutions
+      int nMonomer = gridSystem.mixture().nMonomer();
+      int ns = gridSystem.basis().nStar();
+      double diff;
+      double maxDiff = 0.0;
+      for (int i = 0; i < nMonomer; ++i) {
+         for (int j = 0; j < ns; ++j) {
+            diff = std::abs(basisSystem.wFields()[i][j] 
+                            - gridSystem.wFields()[i][j]);
+            if (diff > maxDiff) maxDiff = diff;
+         }
+      }
+      TEST_ASSERT(maxDiff < 1.0E-7);
+
+      // Restarting from the solution should converge immediately
+      TEST_ASSERT(gridSystem.iterator().solve() == 0);
+      TEST_ASSERT(gridSystem.iterator().nIteration() == 1);
+   }
+
+   void testIterate1D_lam_rgrid_nosym()
+   {
+      printMethod(TEST_FUNC);
+      openLogFile("out/testIterate1D_lam_rgrid_nosym.log");
+
+      // Symmetrized r-grid iteration may use cosine transforms
+      System<1> symSystem;
+      iterateChiStep1D("in/domainOff/System1D_rgrid", symSystem);
+      TEST_ASSERT(symSystem.iterator().isSymmetric());
+      TEST_ASSERT(symSystem.mixture().hasCosineTransforms());
+
+      // Without symmetrize, the MDE solver uses r2c FFTs
+      System<1> gridSystem;
+      iterateChiStep1D("in/domainOff/System1D_rgrid_nosym", gridSystem);
+      TEST_ASSERT(!gridSystem.iterator().isSymmetric());
+      TEST_ASSERT(!gridSystem.mixture().hasCosineTransforms());
+      Polymer<1>& polymer = gridSystem.mixture().polymer(0);
+      for (int i = 0; i < polymer.nBlock(); ++i) {
+         TEST_ASSERT(!polymer.block(i).hasCosineTransform());
+      }
+
+      // Both converge to the same solution
+      int nMonomer = gridSystem.mixture().nMonomer();
+      int ns = gridSystem.basis().nStar();
+      double diff;
+      double maxDiff = 0.0;
+      for (int i = 0; i < nMonomer; ++i) {
+         for (int j = 0; j < ns; ++j) {
+            diff = std::abs(symSystem.wFields()[i][j] 
+                            - gridSystem.wFields()[i][j]);
+            if (diff > maxDiff) maxDiff = diff;
+         }
+      }
+      TEST_ASSERT(maxDiff < 1.0E-7);
+
+      // Free energies computed from basis and r-grid fields agree
+      symSystem.computeFreeEnergy();
+      gridSystem.computeFreeEnergy();
+      TEST_ASSERT(std::abs(symSystem.fHelmholtz() 
+                           - gridSystem.fHelmholtz()) < 1.0E-7);
+      TEST_ASSERT(std::abs(symSystem.pressure() 
+                           - gridSystem.pressure()) < 1.0E-7);
+   }
+
+   void testSinglePrecision1D_lam()
+   {
+      printMethod(TEST_FUNC);
+      openLogFile("out/testSinglePrecision1D_lam.log"); 
+      compareSinglePrecision<1>("lam");
+   }
+
+   void testSinglePrecision2D_hex()
+   {
+      printMethod(TEST_FUNC);
+      openLogFile("out/testSinglePrecision2D_hex.log"); 
+      compareSinglePrecision<2>("hex");
+   }
+
+   void testSinglePrecision3D_bcc()
+   {
+      printMethod(TEST_FUNC);
+      openLogFile("out/testSinglePrecision3D_bcc.log"); 
+      compareSinglePrecision<3>("bcc");
+   }
+
+   void testSweepCoefficients()
+   {
+      printMethod(TEST_FUNC);
+
+      // Quadratic extrapolation from s = 0.5, 0.25, 0 to s = 0.75
+      DArray<double> s, c;
+      s.allocate(3);
+      c.allocate(3);
+      s[0] = 0.5;
+      s[1] = 0.25;
+      s[2] = 0.0;
+      lagrangeCoefficients(s, 3, 0.75, c);
+      TEST_ASSERT(std::abs(c[0] - 3.0) < 1.0E-12);
+      TEST_ASSERT(std::abs(c[1] + 3.0) < 1.0E-12);
+      TEST_ASSERT(std::abs(c[2] - 1.0) < 1.0E-12);
+
+      // Linear extrapolation from the two most recent points
+      lagrangeCoefficients(s, 2, 0.75, c);
+      TEST_ASSERT(std::abs(c[0] - 2.0) < 1.0E-12);
+      TEST_ASSERT(std::abs(c[1] + 1.0) < 1.0E-12);
+   }
+
+   /*
+   * Run a sweep, and check that the final state is a solution.
+   */
+   void runSweep1D(char const * paramFileName, System<1>& system)
+   {
+      std::ifstream in; 
+      openInputFile(paramFileName, in);
+      system.readParam(in);
+      in.close();
+
+      std::ifstream command;
+      openInputFile("in/domainOn/Sweep1d", command);
+      system.readCommands(command);
+      command.close();
+
+      // Restarting the iterator from the final state should converge
+      // immediately.
+      TEST_ASSERT(system.iterator().solve() == 0);
+      TEST_ASSERT(system.iterator().nIteration() == 1);
+   }
+
+   void testChiSweep1D_lam()
+   {
+      printMethod(TEST_FUNC);
+      openLogFile("out/testChiSweep1D_lam.log"); 
+
+      System<1> system;
+      runSweep1D("in/domainOn/System1D_chiSweep", system);
+      TEST_ASSERT(std::abs(system.interaction().chi(1, 0) - 13.0) 
+                  < 1.0E-10);
+      TEST_ASSERT(std::abs(system.interaction().chi(0, 1) - 13.0) 
+                  < 1.0E-10);
+   }
+
+   void testLengthSweep1D_lam()
+   {
+      printMethod(TEST_FUNC);
+      openLogFile("out/testLengthSweep1D_lam.log"); 
+
+      System<1> system;
+      runSweep1D("in/domainOn/System1D_lengthSweep", system);
+      double length = system.mixture().polymer(0).block(0).length();
+      TEST_ASSERT(std::abs(length - 0.60) < 1.0E-10);
+   }
+
+   void testCompositionSweep1D_lam()
+   {
+      printMethod(TEST_FUNC);
+      openLogFile("out/testCompositionSweep1D_lam.log"); 
+
+      System<1> system;
+      runSweep1D("in/domainOn/System1D_compositionSweep", system);
+      double phi0 = system.mixture().polymer(0).phi();
+      double phi1 = system.mixture().polymer(1).phi();
+      TEST_ASSERT(std::abs(phi0 - 0.85) < 1.0E-10);
+      TEST_ASSERT(std::abs(phi1 - 0.15) < 1.0E-10);
+   }
+
+   void testMuSweep1D_lam()
+   {
+      printMethod(TEST_FUNC);
+      openLogFile("out/testMuSweep1D_lam.log"); 
+
+      // Initial mu values are those of the final state of the
+      // CompositionSweep test (phi = 0.85, 0.15)
+      System<1> system;
+      runSweep1D("in/domainOn/System1D_muSweep", system);
+      double mu0 = system.mixture().polymer(0).mu();
+      double mu1 = system.mixture().polymer(1).mu();
+      TEST_ASSERT(std::abs(mu0 - 5.1067897790971) < 1.0E-10);
+      TEST_ASSERT(std::abs(mu1 - 0.63451862905413) < 1.0E-10);
+
+      // Raising the homopolymer chemical potential swells it. The
+      // AmIterator holds the spatial average of w fixed, so only the
+      // direction of the change in phi is checked here.
+      double phi0 = system.mixture().polymer(0).phi();
+      double phi1 = system.mixture().polymer(1).phi();
+      TEST_ASSERT(phi1 > 0.15);
+      TEST_ASSERT(phi0 < 0.85);
+   }
+
+   /*
+   * Sweep in r-grid mode without symmetrization, starting from a 
+   * lamellar w field translated by a distance that breaks the P_-1 
+   * symmetry. The converged states must retain the translation.
+   */
+   void testChiSweep1D_rgrid_nosym()
+   {
+      printMethod(TEST_FUNC);
+      openLogFile("out/testChiSweep1D_rgrid_nosym.log"); 
+
+      System<1> system;
+      std::ifstream in; 
+      openInputFile("in/domainOn/System1D_rgrid_chiSweep", in);
+      system.readParam(in);
+      in.close();
+      TEST_ASSERT(!system.iterator().isSymmetric());
+
+      std::istringstream readCommand(
+                "READ_W_BASIS contents/omega/domainOn/omega_lam\nFINISH\n");
+      system.readCommands(readCommand);
+
+      // Translate the r-grid w fields by nShift grid points
+      int nMonomer = system.mixture().nMonomer();
+      int nx = system.mesh().size();
+      int nShift = 3;
+      int i, j;
+      DArray< RField<1> >& w = system.wFieldsRGrid();
+      DArray<double> temp;
+      temp.allocate(nx);
+      for (i = 0; i < nMonomer; ++i) {
+         for (j = 0; j < nx; ++j) {
+            temp[j] = w[i][j];
+         }
+         for (j = 0; j < nx; ++j) {
+            w[i][j] = temp[(j + nShift) % nx];
+         }
+      }
+
+      std::istringstream sweepCommand("SWEEP\nFINISH\n");
+      system.readCommands(sweepCommand);
+      TEST_ASSERT(std::abs(system.interaction().chi(1, 0) - 13.0) 
+                  < 1.0E-10);
+      TEST_ASSERT(system.iterator().solve() == 0);
+      TEST_ASSERT(system.iterator().nIteration() == 1);
+
+      // The final field is not inversion symmetric about the origin,
+      // but is symmetric about the translated origin, at -nShift
+      double asym = 0.0;
+      double asymShifted = 0.0;
+      double diff;
+      for (i = 0; i < nMonomer; ++i) {
+         for (j = 0; j < nx; ++j) {
+            diff = std::abs(w[i][j] - w[i][(nx - j) % nx]);
+            if (diff > asym) asym = diff;
+            diff = std::abs(w[i][(nx + j - nShift) % nx] 
+                            - w[i][(2*nx - j - nShift) % nx]);
+            if (diff > asymShifted) asymShifted = diff;
+         }
+      }
+      TEST_ASSERT(asym > 1.0E-1);
+      TEST_ASSERT(asymShifted < 1.0E-6);
+   }
+
 };
 
 TEST_BEGIN(SystemTest)
@@ -623,6 +970,17 @@ TEST_ADD(SystemTest, testIterate2D_hex_rigid)
 TEST_ADD(SystemTest, testIterate2D_hex_flex)
 TEST_ADD(SystemTest, testIterate3D_bcc_rigid)
 TEST_ADD(SystemTest, testIterate3D_bcc_flex)
+TEST_ADD(SystemTest, testIterate1D_lam_rgrid)
+TEST_ADD(SystemTest, testIterate1D_lam_rgrid_nosym)
+TEST_ADD(SystemTest, testSinglePrecision1D_lam)
+TEST_ADD(SystemTest, testSinglePrecision2D_hex)
+TEST_ADD(SystemTest, testSinglePrecision3D_bcc)
+TEST_ADD(SystemTest, testSweepCoefficients)
+TEST_ADD(SystemTest, testChiSweep1D_lam)
+TEST_ADD(SystemTest, testLengthSweep1D_lam)
+TEST_ADD(SystemTest, testCompositionSweep1D_lam)
+TEST_ADD(SystemTest, testMuSweep1D_lam)
+TEST_ADD(SystemTest, testChiSweep1D_rgrid_nosym)
 
 TEST_END(SystemTest)
 
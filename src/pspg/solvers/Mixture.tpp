@@ -112,7 +112,8 @@ namespace Pspg
          polymer(i).compute(wFields);
       }
 
-      // Accumulate monomer concentration fields
+      // Accumulate monomer concentration fields. Block concentrations
+      // already include the factor phi, through the prefactor phi/(qL).
       for (i = 0; i < nPolymer(); ++i) {
          for (j = 0; j < polymer(i).nBlock(); ++j) {
             int monomerId = polymer(i).block(j).monomerId();
@@ -120,9 +121,9 @@ namespace Pspg
             UTIL_CHECK(monomerId < nm);
             CField& monomerField = cFields[monomerId];
             CField& blockField = polymer(i).block(j).cField();
-            //monomerField[k] += polymer(i).phi() * blockField[k];
+            //monomerField[k] += blockField[k];
             accumulateConc<<<NUMBER_OF_BLOCKS, THREADS_PER_BLOCK>>>(monomerField.cDField(), 
-                        polymer(i).phi(), blockField.cDField(), nx);
+                        1.0, blockField.cDField(), nx);
          }
       }
       // To do: Add compute functions and accumulation for solvents.